@@ -0,0 +1,145 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <JSBundleCache.h>
+
+// Standard Library
+#include <stdexcept>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+JSBundleCache::Loader MakeLoader(std::string content, int &loadCount) {
+  return [content = std::move(content), &loadCount]() {
+    ++loadCount;
+    return std::make_unique<const JSBigStdString>(content);
+  };
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (JSBundleCacheTest) {
+  TEST_METHOD(JSBundleCache_ReusesLoadedBundle) {
+    JSBundleCache cache;
+    int loadCount = 0;
+    auto first = cache.GetOrLoad("index", "1", MakeLoader("var a = 1;", loadCount));
+    auto second = cache.GetOrLoad("index", "1", MakeLoader("var a = 2;", loadCount));
+
+    Assert::AreEqual(1, loadCount);
+    Assert::AreEqual(std::string{"var a = 1;"}, std::string{second->c_str(), second->size()});
+    Assert::AreEqual(first->c_str(), second->c_str());
+    Assert::AreEqual(static_cast<size_t>(10), cache.GetByteCount());
+  }
+
+  TEST_METHOD(JSBundleCache_ReloadsUpdatedBundle) {
+    JSBundleCache cache;
+    int loadCount = 0;
+    cache.GetOrLoad("index", "1", MakeLoader("var a = 1;", loadCount));
+    auto updated = cache.GetOrLoad("index", "2", MakeLoader("var a = 22;", loadCount));
+
+    Assert::AreEqual(2, loadCount);
+    Assert::AreEqual(std::string{"var a = 22;"}, std::string{updated->c_str(), updated->size()});
+    Assert::AreEqual(static_cast<size_t>(1), cache.GetEntryCount());
+    Assert::AreEqual(static_cast<size_t>(11), cache.GetByteCount());
+  }
+
+  TEST_METHOD(JSBundleCache_QueriesVersionOnlyWhenNeeded) {
+    JSBundleCache cache;
+    int loadCount = 0;
+    int versionCount = 0;
+    auto getVersion = [&versionCount]() {
+      ++versionCount;
+      return std::string{"1"};
+    };
+
+    cache.GetOrLoad("index", getVersion, MakeLoader("var a = 1;", loadCount));
+    Assert::AreEqual(1, versionCount);
+
+    cache.GetOrLoad("index", getVersion, MakeLoader("var a = 1;", loadCount));
+    Assert::AreEqual(2, versionCount);
+    Assert::AreEqual(1, loadCount);
+
+    JSBundleCache disabledCache{0, 1024};
+    disabledCache.GetOrLoad("index", getVersion, MakeLoader("var a = 1;", loadCount));
+    Assert::AreEqual(2, versionCount);
+    Assert::AreEqual(2, loadCount);
+  }
+
+  TEST_METHOD(JSBundleCache_ZeroEntriesDisablesCache) {
+    JSBundleCache cache{0, 1024};
+    int loadCount = 0;
+    cache.GetOrLoad("index", "1", MakeLoader("a", loadCount));
+    cache.GetOrLoad("index", "1", MakeLoader("a", loadCount));
+
+    Assert::AreEqual(2, loadCount);
+    Assert::AreEqual(static_cast<size_t>(0), cache.GetEntryCount());
+  }
+
+  TEST_METHOD(JSBundleCache_EvictsLeastRecentlyUsed) {
+    JSBundleCache cache{2, 1024};
+    int loadCount = 0;
+    cache.GetOrLoad("a", "1", MakeLoader("a", loadCount));
+    cache.GetOrLoad("b", "1", MakeLoader("b", loadCount));
+    cache.GetOrLoad("a", "1", MakeLoader("a", loadCount));
+    cache.GetOrLoad("c", "1", MakeLoader("c", loadCount));
+
+    Assert::AreEqual(3, loadCount);
+    Assert::AreEqual(static_cast<size_t>(2), cache.GetEntryCount());
+    Assert::IsTrue(cache.Contains("a"));
+    Assert::IsFalse(cache.Contains("b"));
+    Assert::IsTrue(cache.Contains("c"));
+  }
+
+  TEST_METHOD(JSBundleCache_RespectsByteLimit) {
+    JSBundleCache cache{4, 8};
+    int loadCount = 0;
+    auto bundle = cache.GetOrLoad("large", "1", MakeLoader("0123456789", loadCount));
+    Assert::AreEqual(static_cast<size_t>(10), bundle->size());
+    Assert::IsFalse(cache.Contains("large"));
+
+    cache.GetOrLoad("x", "1", MakeLoader("12345", loadCount));
+    cache.GetOrLoad("y", "1", MakeLoader("12345", loadCount));
+    Assert::IsFalse(cache.Contains("x"));
+    Assert::IsTrue(cache.Contains("y"));
+    Assert::AreEqual(static_cast<size_t>(5), cache.GetByteCount());
+
+    cache.SetLimits(0, 0);
+    Assert::AreEqual(static_cast<size_t>(0), cache.GetEntryCount());
+    Assert::AreEqual(static_cast<size_t>(0), cache.GetByteCount());
+  }
+
+  TEST_METHOD(JSBundleCache_PropagatesLoaderErrors) {
+    JSBundleCache cache;
+    bool isThrown = false;
+    try {
+      cache.GetOrLoad(
+          "missing", "1", []() -> std::unique_ptr<const JSBigString> { throw std::runtime_error("missing"); });
+    } catch (const std::runtime_error &) {
+      isThrown = true;
+    }
+
+    Assert::IsTrue(isThrown);
+    Assert::IsFalse(cache.Contains("missing"));
+  }
+
+  TEST_METHOD(JSBundleCache_RemoveAndClear) {
+    JSBundleCache cache;
+    int loadCount = 0;
+    cache.GetOrLoad("a", "1", MakeLoader("aa", loadCount));
+    cache.GetOrLoad("b", "1", MakeLoader("bbb", loadCount));
+
+    Assert::IsTrue(cache.Remove("a"));
+    Assert::IsFalse(cache.Remove("a"));
+    Assert::AreEqual(static_cast<size_t>(3), cache.GetByteCount());
+
+    cache.Clear();
+    Assert::AreEqual(static_cast<size_t>(0), cache.GetEntryCount());
+  }
+};
+
+} // namespace Microsoft::React::Test
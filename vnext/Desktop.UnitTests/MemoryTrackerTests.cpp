@@ -0,0 +1,127 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <MemoryTracker.h>
+#include <tracing/TraceSink.h>
+#include "InstanceMocks.h"
+
+// Standard Library
+#include <cstring>
+#include <thread>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (MemoryTrackerTest) {
+  TEST_METHOD(MemoryTracker_DetailedTrackingDisabledByDefault) {
+    auto memoryTracker = CreateMemoryTracker(std::make_shared<MockMessageQueueThread>());
+    memoryTracker->Initialize(100);
+    memoryTracker->OnAllocation(16);
+    memoryTracker->OnGarbageCollection();
+
+    Assert::IsFalse(memoryTracker->IsDetailedTrackingEnabled());
+    Assert::AreEqual(static_cast<uint64_t>(0), memoryTracker->GetAllocationStatistics().AllocationCount);
+    Assert::IsTrue(memoryTracker->GetGarbageCollectionSnapshots().empty());
+    Assert::AreEqual(static_cast<size_t>(116), memoryTracker->GetCurrentMemoryUsage());
+  }
+
+  TEST_METHOD(MemoryTracker_AllocationSizeHistogram) {
+    auto memoryTracker = CreateMemoryTracker(std::make_shared<MockMessageQueueThread>());
+    memoryTracker->Initialize(0);
+    memoryTracker->SetDetailedTrackingEnabled(true);
+    memoryTracker->OnAllocation(1);
+    memoryTracker->OnAllocation(8);
+    memoryTracker->OnAllocation(15);
+    memoryTracker->OnAllocation(static_cast<size_t>(1) << 40);
+    memoryTracker->OnDeallocation(8);
+
+    auto statistics = memoryTracker->GetAllocationStatistics();
+    Assert::AreEqual(static_cast<uint64_t>(1), statistics.AllocationSizeHistogram[0]);
+    Assert::AreEqual(static_cast<uint64_t>(2), statistics.AllocationSizeHistogram[3]);
+    Assert::AreEqual(
+        static_cast<uint64_t>(1), statistics.AllocationSizeHistogram[MemoryAllocationHistogramBucketCount - 1]);
+    Assert::AreEqual(static_cast<uint64_t>(4), statistics.AllocationCount);
+    Assert::AreEqual(static_cast<uint64_t>(1), statistics.DeallocationCount);
+    Assert::AreEqual(static_cast<uint64_t>(8), statistics.DeallocatedBytes);
+    Assert::IsTrue(statistics.AllocationRate > 0);
+  }
+
+  TEST_METHOD(MemoryTracker_InitialUsageIsNotAnAllocation) {
+    auto memoryTracker = CreateMemoryTracker(std::make_shared<MockMessageQueueThread>());
+    memoryTracker->SetDetailedTrackingEnabled(true);
+    memoryTracker->Initialize(1000);
+    memoryTracker->OnAllocation(16);
+
+    auto statistics = memoryTracker->GetAllocationStatistics();
+    Assert::AreEqual(static_cast<uint64_t>(1), statistics.AllocationCount);
+    Assert::AreEqual(static_cast<uint64_t>(16), statistics.AllocatedBytes);
+    Assert::AreEqual(static_cast<uint64_t>(1), statistics.AllocationSizeHistogram[4]);
+    Assert::AreEqual(static_cast<size_t>(1016), memoryTracker->GetCurrentMemoryUsage());
+    Assert::AreEqual(static_cast<size_t>(1016), memoryTracker->GetPeakMemoryUsage());
+  }
+
+  TEST_METHOD(MemoryTracker_GarbageCollectionSnapshots) {
+    auto memoryTracker = CreateMemoryTracker(std::make_shared<MockMessageQueueThread>());
+    memoryTracker->Initialize(1000);
+    memoryTracker->SetDetailedTrackingEnabled(true);
+    memoryTracker->OnAllocation(500);
+    memoryTracker->OnDeallocation(100);
+    memoryTracker->OnGarbageCollection();
+    memoryTracker->OnAllocation(50);
+    memoryTracker->OnGarbageCollection();
+
+    auto snapshots = memoryTracker->GetGarbageCollectionSnapshots();
+    Assert::AreEqual(static_cast<size_t>(2), snapshots.size());
+    Assert::AreEqual(static_cast<uint64_t>(1), snapshots[0].Cycle);
+    Assert::AreEqual(static_cast<size_t>(1400), snapshots[0].MemoryUsage);
+    Assert::AreEqual(static_cast<uint64_t>(500), snapshots[0].AllocatedBytesSinceLastCycle);
+    Assert::AreEqual(static_cast<uint64_t>(100), snapshots[0].DeallocatedBytesSinceLastCycle);
+    Assert::AreEqual(static_cast<int64_t>(400), snapshots[0].MemoryUsageDelta);
+    Assert::AreEqual(static_cast<uint64_t>(50), snapshots[1].AllocatedBytesSinceLastCycle);
+    Assert::AreEqual(static_cast<int64_t>(50), snapshots[1].MemoryUsageDelta);
+  }
+
+  TEST_METHOD(MemoryTracker_AllocationRateCallback) {
+    auto memoryTracker = CreateMemoryTracker(std::make_shared<MockMessageQueueThread>());
+    memoryTracker->Initialize(0);
+    memoryTracker->SetDetailedTrackingEnabled(true);
+
+    size_t reportedRate = 0;
+    auto cookie = memoryTracker->AddAllocationRateCallback(
+        1000, std::chrono::milliseconds{0}, [&reportedRate](const MemoryAllocationStatistics &statistics) {
+          reportedRate = statistics.AllocationRate;
+        });
+
+    // The rate is reported when an allocation starts a new slot of the sliding window.
+    memoryTracker->OnAllocation(10000);
+    std::this_thread::sleep_for(MemoryAllocationRateWindow / 5);
+    memoryTracker->OnAllocation(1);
+    Assert::AreEqual(static_cast<size_t>(10000), reportedRate);
+
+    Assert::IsTrue(memoryTracker->RemoveThresholdCallback(cookie));
+    Assert::IsFalse(memoryTracker->RemoveThresholdCallback(cookie));
+  }
+
+  TEST_METHOD(MemoryTracker_WritesTraceEvents) {
+    auto sink = std::make_shared<tracing::RingBufferTraceSink>(16);
+    tracing::SetTraceSink(sink);
+
+    auto memoryTracker = CreateMemoryTracker(std::make_shared<MockMessageQueueThread>());
+    memoryTracker->Initialize(0);
+    memoryTracker->SetDetailedTrackingEnabled(true);
+    memoryTracker->OnAllocation(64);
+    memoryTracker->OnGarbageCollection();
+    tracing::SetTraceSink(nullptr);
+
+    bool hasGarbageCollection = false;
+    for (const auto &event : sink->Snapshot()) {
+      hasGarbageCollection |= strcmp("JSHeap.GarbageCollection", event.Name) == 0;
+    }
+    Assert::IsTrue(hasGarbageCollection);
+  }
+};
+
+} // namespace Microsoft::React::Test
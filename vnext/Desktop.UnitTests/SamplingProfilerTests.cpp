@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <tracing/SamplingProfiler.h>
+
+// Standard Library
+#include <atomic>
+#include <thread>
+
+using namespace facebook::react::tracing;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (SamplingProfilerTest) {
+  TEST_METHOD(SamplingProfiler_ReadsCounters) {
+    SamplingProfiler profiler;
+    int64_t value = 0;
+    auto cookie = profiler.AddCounter("queue", [&value]() { return ++value; });
+    profiler.SampleNow();
+    profiler.SampleNow();
+    Assert::IsTrue(profiler.RemoveCounter(cookie));
+    Assert::IsFalse(profiler.RemoveCounter(cookie));
+    profiler.SampleNow();
+
+    auto samples = profiler.GetSamples();
+    Assert::AreEqual(static_cast<size_t>(3), samples.size());
+    Assert::AreEqual(static_cast<size_t>(1), samples[0].Counters.size());
+    Assert::AreEqual(std::string{"queue"}, samples[0].Counters[0].first);
+    Assert::AreEqual(static_cast<int64_t>(2), samples[1].Counters[0].second);
+    Assert::IsTrue(samples[2].Counters.empty());
+  }
+
+  TEST_METHOD(SamplingProfiler_DropsOldestSamples) {
+    SamplingProfiler profiler{SamplingProfiler::DefaultInterval, 2};
+    int64_t value = 0;
+    profiler.AddCounter("counter", [&value]() { return value++; });
+    for (int i = 0; i < 5; ++i) {
+      profiler.SampleNow();
+    }
+
+    auto samples = profiler.GetSamples();
+    Assert::AreEqual(static_cast<size_t>(2), samples.size());
+    Assert::AreEqual(static_cast<int64_t>(3), samples[0].Counters[0].second);
+    Assert::AreEqual(static_cast<int64_t>(4), samples[1].Counters[0].second);
+  }
+
+  TEST_METHOD(NativeCallScope_TrackedOnlyWhileRunning) {
+    SamplingProfiler profiler{std::chrono::milliseconds{1000}};
+    {
+      NativeCallScope scope{"Module", "untracked"};
+      profiler.SampleNow();
+    }
+
+    profiler.Start();
+    Assert::IsTrue(profiler.IsRunning());
+    Assert::IsTrue(SamplingProfiler::IsNativeCallTrackingEnabled());
+    {
+      NativeCallScope scope{"Module", "tracked"};
+      profiler.SampleNow();
+    }
+    profiler.Stop();
+    Assert::IsFalse(profiler.IsRunning());
+    Assert::IsFalse(SamplingProfiler::IsNativeCallTrackingEnabled());
+
+    auto stacks = profiler.ToCollapsedStacks();
+    Assert::AreNotEqual(std::string::npos, stacks.find("NativeModules;Module;tracked 1\n"));
+    Assert::AreEqual(std::string::npos, stacks.find("untracked"));
+    Assert::AreNotEqual(std::string::npos, stacks.find("Idle "));
+  }
+
+  TEST_METHOD(SamplingProfiler_SamplesOnBackgroundThread) {
+    SamplingProfiler profiler{std::chrono::milliseconds{1}};
+    std::atomic<int64_t> reads{0};
+    profiler.AddCounter("reads", [&reads]() { return ++reads; });
+    profiler.Start();
+    while (reads < 3) {
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    profiler.Stop();
+
+    Assert::IsTrue(profiler.GetSamples().size() >= 3);
+    profiler.Clear();
+    Assert::IsTrue(profiler.GetSamples().empty());
+  }
+
+  TEST_METHOD(SamplingProfiler_ChromeJson) {
+    SamplingProfiler profiler;
+    profiler.AddCounter("JSCallQueue.Pending", []() { return 7; });
+    profiler.SampleNow();
+
+    auto json = profiler.ToChromeTraceJson();
+    Assert::AreNotEqual(
+        std::string::npos, json.find("\"name\":\"JSCallQueue.Pending\",\"cat\":\"sampling\",\"ph\":\"C\""));
+    Assert::AreNotEqual(std::string::npos, json.find("\"args\":{\"value\":7}"));
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,80 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <tracing/StartupTimeline.h>
+
+// Standard Library
+#include <thread>
+
+using namespace facebook::react::tracing;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (StartupTimelineTest) {
+  TEST_METHOD(StartupTimeline_RecordsNestedPhases) {
+    StartupTimeline timeline;
+    timeline.BeginPhase("InstanceLoad");
+    {
+      StartupTimelineScope scope{&timeline, "LoadModules"};
+    }
+    timeline.EndPhase("InstanceLoad");
+
+    auto phases = timeline.GetPhases();
+    Assert::AreEqual(static_cast<size_t>(2), phases.size());
+    Assert::AreEqual(std::string{"InstanceLoad"}, phases[0].Name);
+    Assert::AreEqual(std::string{"LoadModules"}, phases[1].Name);
+    Assert::IsTrue(phases[0].IsComplete);
+    Assert::IsTrue(phases[1].IsComplete);
+    Assert::IsTrue(phases[0].Start <= phases[1].Start);
+    Assert::IsTrue(phases[0].Duration >= phases[1].Duration);
+    Assert::AreEqual(StartupTimeline::CurrentThreadId(), phases[0].ThreadId);
+  }
+
+  TEST_METHOD(StartupTimeline_PhaseCanEndOnOtherThread) {
+    StartupTimeline timeline;
+    timeline.BeginPhase("LoadJSBundle");
+    std::thread([&timeline]() { timeline.EndPhase("LoadJSBundle"); }).join();
+
+    Assert::IsTrue(timeline.GetPhaseDuration("LoadJSBundle").has_value());
+  }
+
+  TEST_METHOD(StartupTimeline_OpenPhaseHasNoDuration) {
+    StartupTimeline timeline;
+    timeline.BeginPhase("InstanceLoad");
+    timeline.BeginPhase("InstanceLoad");
+
+    Assert::AreEqual(static_cast<size_t>(1), timeline.GetPhases().size());
+    Assert::IsFalse(timeline.GetPhaseDuration("InstanceLoad").has_value());
+    Assert::IsFalse(timeline.GetPhaseDuration("Unknown").has_value());
+  }
+
+  TEST_METHOD(StartupTimeline_ChromeTraceJson) {
+    StartupTimeline timeline;
+    {
+      StartupTimelineScope scope{&timeline, "Load\"Modules\""};
+    }
+    timeline.Mark("FirstUIBatchComplete");
+    timeline.BeginPhase("Unfinished");
+
+    auto json = timeline.ToChromeTraceJson();
+    Assert::AreEqual(static_cast<size_t>(0), json.find("{\"traceEvents\":["));
+    Assert::AreNotEqual(std::string::npos, json.find("\"name\":\"Load\\\"Modules\\\"\""));
+    Assert::AreNotEqual(std::string::npos, json.find("\"ph\":\"X\""));
+    Assert::AreNotEqual(
+        std::string::npos, json.find("\"name\":\"FirstUIBatchComplete\",\"cat\":\"startup\",\"ph\":\"i\""));
+    Assert::AreEqual(std::string::npos, json.find("Unfinished"));
+  }
+
+  TEST_METHOD(StartupTimeline_Reset) {
+    StartupTimeline timeline;
+    timeline.Mark("FirstUIBatchComplete");
+    timeline.Reset();
+
+    Assert::IsTrue(timeline.GetPhases().empty());
+    Assert::IsTrue(timeline.GetTotalDuration() == StartupTimeline::Clock::duration::zero());
+  }
+};
+
+} // namespace Microsoft::React::Test
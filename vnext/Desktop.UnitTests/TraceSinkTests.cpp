@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <tracing/TraceSink.h>
+
+// Standard Library
+#include <cstring>
+#include <thread>
+
+using namespace facebook::react::tracing;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+TraceEvent MakeEvent(TraceEventType type, const char *name, uint64_t timestamp, int64_t value = 0) {
+  TraceEvent event;
+  event.Type = type;
+  event.Timestamp = timestamp;
+  event.Value = value;
+  event.SetName(name);
+  return event;
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (TraceSinkTest) {
+  TEST_METHOD(RingBufferTraceSink_KeepsMostRecentEvents) {
+    RingBufferTraceSink sink{4};
+    for (uint64_t i = 0; i < 10; ++i) {
+      sink.Write(MakeEvent(TraceEventType::Counter, "counter", i, static_cast<int64_t>(i)));
+    }
+
+    auto events = sink.Snapshot();
+    Assert::AreEqual(static_cast<size_t>(4), events.size());
+    Assert::AreEqual(static_cast<int64_t>(6), events[0].Value);
+    Assert::AreEqual(static_cast<int64_t>(9), events[3].Value);
+  }
+
+  TEST_METHOD(RingBufferTraceSink_MergesThreadsByTimestamp) {
+    RingBufferTraceSink sink{16};
+    sink.Write(MakeEvent(TraceEventType::SectionBegin, "main", 1));
+    std::thread([&sink]() {
+      sink.Write(MakeEvent(TraceEventType::SectionBegin, "worker", 2));
+      sink.Write(MakeEvent(TraceEventType::SectionEnd, "", 3));
+    }).join();
+    sink.Write(MakeEvent(TraceEventType::SectionEnd, "", 4));
+
+    auto events = sink.Snapshot();
+    Assert::AreEqual(static_cast<size_t>(4), events.size());
+    for (size_t i = 0; i < events.size(); ++i) {
+      Assert::AreEqual(static_cast<uint64_t>(i + 1), events[i].Timestamp);
+    }
+    Assert::AreEqual(0, strcmp("worker", events[1].Name));
+  }
+
+  TEST_METHOD(RingBufferTraceSink_Clear) {
+    RingBufferTraceSink sink{8};
+    sink.Write(MakeEvent(TraceEventType::Instant, "before", 1));
+    sink.Clear();
+    sink.Write(MakeEvent(TraceEventType::Instant, "after", 2));
+
+    auto events = sink.Snapshot();
+    Assert::AreEqual(static_cast<size_t>(1), events.size());
+    Assert::AreEqual(0, strcmp("after", events[0].Name));
+  }
+
+  TEST_METHOD(TraceEvent_TruncatesLongNames) {
+    std::string name(TraceEventNameCapacity * 2, 'x');
+    TraceEvent event;
+    event.SetName(name);
+    Assert::AreEqual(TraceEventNameCapacity - 1, strlen(event.Name));
+  }
+
+  TEST_METHOD(TraceEvents_BinaryRoundTrip) {
+    std::vector<TraceEvent> events{
+        MakeEvent(TraceEventType::AsyncFlowBegin, "flow", 10, 42),
+        MakeEvent(TraceEventType::Counter, "heap", 20, -5)};
+    events[0].Tag = 1 << 10;
+    events[1].ThreadId = 7;
+
+    auto buffer = SerializeTraceEvents(events);
+    std::vector<TraceEvent> result;
+    Assert::IsTrue(DeserializeTraceEvents(buffer.data(), buffer.size(), result));
+    Assert::AreEqual(events.size(), result.size());
+    for (size_t i = 0; i < events.size(); ++i) {
+      Assert::AreEqual(events[i].Timestamp, result[i].Timestamp);
+      Assert::AreEqual(events[i].Tag, result[i].Tag);
+      Assert::AreEqual(events[i].Value, result[i].Value);
+      Assert::AreEqual(events[i].ThreadId, result[i].ThreadId);
+      Assert::IsTrue(events[i].Type == result[i].Type);
+      Assert::AreEqual(0, strcmp(events[i].Name, result[i].Name));
+    }
+
+    Assert::IsFalse(DeserializeTraceEvents(buffer.data(), buffer.size() - 1, result));
+    buffer[0] = 'X';
+    Assert::IsFalse(DeserializeTraceEvents(buffer.data(), buffer.size(), result));
+  }
+
+  TEST_METHOD(TraceEvents_ChromeJson) {
+    auto json = TraceEventsToChromeJson(
+        {MakeEvent(TraceEventType::SectionBegin, "render", 1000),
+         MakeEvent(TraceEventType::SectionEnd, "", 3000),
+         MakeEvent(TraceEventType::AsyncSectionBegin, "fetch", 4000, 12),
+         MakeEvent(TraceEventType::Counter, "heap", 5000, 1024)});
+
+    Assert::AreNotEqual(
+        std::string::npos, json.find("\"name\":\"render\",\"cat\":\"react\",\"ph\":\"B\",\"ts\":1.000"));
+    Assert::AreNotEqual(std::string::npos, json.find("\"ph\":\"E\",\"ts\":3.000"));
+    Assert::AreNotEqual(std::string::npos, json.find("\"ph\":\"b\",\"ts\":4.000,\"pid\":0,\"tid\":0,\"id\":12"));
+    Assert::AreNotEqual(std::string::npos, json.find("\"args\":{\"value\":1024}"));
+  }
+
+  TEST_METHOD(WriteTraceEvent_UsesProcessSink) {
+    auto sink = std::make_shared<RingBufferTraceSink>(8);
+    SetTraceSink(sink);
+    WriteTraceEvent(TraceEventType::Counter, "counter", 0, 3);
+    SetTraceSink(nullptr);
+    WriteTraceEvent(TraceEventType::Counter, "counter", 0, 4);
+
+    auto events = sink->Snapshot();
+    Assert::AreEqual(static_cast<size_t>(1), events.size());
+    Assert::AreEqual(static_cast<int64_t>(3), events[0].Value);
+    Assert::IsNull(GetTraceSink());
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,90 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Modules/Animated/AnimatedEdgeQueue.h>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+using Edge = AnimatedEdgeQueue::Edge;
+
+void TestCheckEdge(const Edge &edge, int64_t parentTag, int64_t childTag, bool connect) {
+  TestCheckEqual(parentTag, edge.ParentTag);
+  TestCheckEqual(childTag, edge.ChildTag);
+  TestCheckEqual(connect, edge.Connect);
+}
+
+} // namespace
+
+TEST_CLASS (AnimatedEdgeQueueTest) {
+  TEST_METHOD(TestKeepOrder) {
+    AnimatedEdgeQueue queue;
+    TestCheck(queue.IsEmpty());
+    queue.Stage({1, 2, true}, false);
+    queue.Stage({3, 4, false}, true);
+    queue.Stage({1, 5, true}, false);
+    TestCheck(!queue.IsEmpty());
+
+    auto edges = queue.Take();
+    TestCheckEqual(3u, edges.size());
+    TestCheckEdge(edges[0], 1, 2, true);
+    TestCheckEdge(edges[1], 3, 4, false);
+    TestCheckEdge(edges[2], 1, 5, true);
+    TestCheck(queue.IsEmpty());
+    TestCheckEqual(0u, queue.Take().size());
+  }
+
+  TEST_METHOD(TestReconnectConnectedEdge) {
+    // The edge is left as it is.
+    AnimatedEdgeQueue queue;
+    queue.Stage({1, 2, false}, true);
+    queue.Stage({3, 4, true}, false);
+    queue.Stage({1, 2, true}, true);
+
+    auto edges = queue.Take();
+    TestCheckEqual(1u, edges.size());
+    TestCheckEdge(edges[0], 3, 4, true);
+  }
+
+  TEST_METHOD(TestReconnectMissingEdge) {
+    // The disconnect does nothing, so the connect must still be applied.
+    AnimatedEdgeQueue queue;
+    queue.Stage({1, 2, false}, false);
+    queue.Stage({1, 2, true}, false);
+
+    auto edges = queue.Take();
+    TestCheckEqual(2u, edges.size());
+    TestCheckEdge(edges[0], 1, 2, false);
+    TestCheckEdge(edges[1], 1, 2, true);
+  }
+
+  TEST_METHOD(TestDisconnectNewEdge) {
+    // A connect followed by a disconnect is not cancelled.
+    AnimatedEdgeQueue queue;
+    queue.Stage({1, 2, true}, false);
+    queue.Stage({1, 2, false}, false);
+
+    auto edges = queue.Take();
+    TestCheckEqual(2u, edges.size());
+    TestCheckEdge(edges[0], 1, 2, true);
+    TestCheckEdge(edges[1], 1, 2, false);
+  }
+
+  TEST_METHOD(TestReconnectStagedEdge) {
+    // The edge connected in the queue is disconnected and connected again.
+    AnimatedEdgeQueue queue;
+    queue.Stage({1, 2, true}, false);
+    queue.Stage({1, 2, false}, false);
+    queue.Stage({1, 2, true}, false);
+    queue.Stage({1, 2, false}, false);
+    queue.Stage({1, 2, true}, false);
+
+    auto edges = queue.Take();
+    TestCheckEqual(1u, edges.size());
+    TestCheckEdge(edges[0], 1, 2, true);
+  }
+};
+
+} // namespace Microsoft::ReactNative
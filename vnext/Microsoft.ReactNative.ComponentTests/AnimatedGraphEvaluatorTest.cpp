@@ -0,0 +1,170 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Modules/Animated/AnimatedGraphEvaluator.h>
+#include <map>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+double GetValue(const AnimatedGraphEvaluator &evaluator, int64_t tag) noexcept {
+  double value = -1000;
+  TestCheck(evaluator.TryGetValue(tag, value));
+  return value;
+}
+
+} // namespace
+
+TEST_CLASS (AnimatedGraphEvaluatorTest) {
+  TEST_METHOD(TestOperators) {
+    AnimatedGraphEvaluator evaluator;
+    evaluator.AddValueNode(1, 6, 0);
+    evaluator.AddValueNode(2, 1, 2);
+    evaluator.AddOperatorNode(3, AnimatedGraphOperator::Addition, {1, 2});
+    evaluator.AddOperatorNode(4, AnimatedGraphOperator::Subtraction, {1, 2});
+    evaluator.AddOperatorNode(5, AnimatedGraphOperator::Multiplication, {1, 2});
+    evaluator.AddOperatorNode(6, AnimatedGraphOperator::Division, {1, 2});
+    evaluator.AddModulusNode(7, 4, 5);
+    evaluator.Update();
+
+    TestCheckEqual(6.0, GetValue(evaluator, 1));
+    TestCheckEqual(3.0, GetValue(evaluator, 2));
+    TestCheckEqual(9.0, GetValue(evaluator, 3));
+    TestCheckEqual(3.0, GetValue(evaluator, 4));
+    TestCheckEqual(18.0, GetValue(evaluator, 5));
+    TestCheckEqual(2.0, GetValue(evaluator, 6));
+    TestCheckEqual(3.0, GetValue(evaluator, 7));
+
+    // The modulus keeps the sign of the input. Division by zero keeps the last value.
+    evaluator.SetRawValue(1, -2);
+    evaluator.SetOffset(2, -1);
+    evaluator.Update();
+    TestCheckEqual(-2.0, GetValue(evaluator, 4));
+    TestCheckEqual(-2.0, GetValue(evaluator, 7));
+    TestCheckEqual(2.0, GetValue(evaluator, 6));
+  }
+
+  TEST_METHOD(TestDependencyOrder) {
+    // Nodes are created before their inputs and connected later. Each update still computes the values
+    // in a single pass.
+    AnimatedGraphEvaluator evaluator;
+    evaluator.AddOperatorNode(10, AnimatedGraphOperator::Multiplication, {11, 12});
+    evaluator.AddOperatorNode(11, AnimatedGraphOperator::Addition, {12, 13});
+    evaluator.AddInterpolationNode(12, {0, 1}, {0, 100}, ExtrapolationType::Extend, ExtrapolationType::Extend);
+    evaluator.AddValueNode(13, 0.5, 0);
+    evaluator.Update();
+    TestCheckEqual(0.0, GetValue(evaluator, 10));
+
+    evaluator.ConnectNodes(13, 12);
+    evaluator.Update();
+    TestCheckEqual(50.0, GetValue(evaluator, 12));
+    TestCheckEqual(50.5, GetValue(evaluator, 11));
+    TestCheckEqual(2525.0, GetValue(evaluator, 10));
+
+    evaluator.SetRawValue(13, 1);
+    evaluator.Update();
+    TestCheckEqual(10100.0, GetValue(evaluator, 10));
+
+    // Nodes with a removed input keep their last values.
+    evaluator.RemoveNode(13);
+    evaluator.Update();
+    TestCheckEqual(10100.0, GetValue(evaluator, 10));
+    TestCheckEqual(3u, evaluator.NodeCount());
+
+    double value;
+    TestCheck(!evaluator.TryGetValue(13, value));
+  }
+
+  TEST_METHOD(TestInterpolation) {
+    AnimatedGraphEvaluator evaluator;
+    evaluator.AddValueNode(1, 0, 0);
+    evaluator.AddInterpolationNode(
+        2, {0, 10, 20, 40}, {0, 100, 100, 0}, ExtrapolationType::Extend, ExtrapolationType::Clamp);
+    evaluator.AddInterpolationNode(
+        3, {0, 10, 20, 40}, {0, 100, 100, 0}, ExtrapolationType::Identity, ExtrapolationType::Identity);
+    evaluator.ConnectNodes(1, 2);
+    evaluator.ConnectNodes(1, 3);
+
+    const std::pair<double, double> extendAndClamp[] = {
+        {-5, -50}, {0, 0}, {5, 50}, {10, 100}, {15, 100}, {30, 50}, {40, 0}, {50, 0}};
+    for (const auto &sample : extendAndClamp) {
+      evaluator.SetRawValue(1, sample.first);
+      evaluator.Update();
+      TestCheckEqual(sample.second, GetValue(evaluator, 2));
+    }
+
+    evaluator.SetRawValue(1, -5);
+    evaluator.Update();
+    TestCheckEqual(-5.0, GetValue(evaluator, 3));
+    evaluator.SetRawValue(1, 50);
+    evaluator.Update();
+    TestCheckEqual(50.0, GetValue(evaluator, 3));
+
+    // A disconnected interpolation keeps its last value.
+    evaluator.DisconnectNodes(1, 3);
+    evaluator.SetRawValue(1, 30);
+    evaluator.Update();
+    TestCheckEqual(50.0, GetValue(evaluator, 3));
+    TestCheckEqual(50.0, GetValue(evaluator, 2));
+  }
+
+  TEST_METHOD(TestDiffClamp) {
+    AnimatedGraphEvaluator evaluator;
+    evaluator.AddValueNode(1, 0, 0);
+    evaluator.AddDiffClampNode(2, 1, 0, 10);
+    evaluator.SetOffset(1, 2);
+
+    const std::pair<double, double> samples[] = {{-5, 0}, {3, 5}, {8, 10}, {30, 10}};
+    for (const auto &sample : samples) {
+      evaluator.SetRawValue(1, sample.first);
+      evaluator.Update();
+      TestCheckEqual(sample.second, GetValue(evaluator, 2));
+    }
+  }
+
+  TEST_METHOD(TestStoppedAnimation) {
+    // The property sets of the value nodes stand in for the composition. A stopped animation leaves its
+    // last value in the property set without setting it on the evaluator.
+    std::map<int64_t, std::pair<double, double>> propertySets{{1, {0, 0}}, {2, {0, 10}}};
+    const auto readPropertySets = [&propertySets](int64_t tag, double &rawValue, double &offset) {
+      rawValue = propertySets[tag].first;
+      offset = propertySets[tag].second;
+    };
+
+    AnimatedGraphEvaluator evaluator;
+    evaluator.AddValueNode(1, 0, 0);
+    evaluator.AddValueNode(2, 0, 10);
+    evaluator.AddInterpolationNode(3, {0, 1}, {0, 100}, ExtrapolationType::Extend, ExtrapolationType::Extend);
+    evaluator.AddOperatorNode(4, AnimatedGraphOperator::Addition, {3, 2});
+    evaluator.ConnectNodes(1, 3);
+    evaluator.SyncValueNodes(readPropertySets);
+    evaluator.Update();
+    TestCheckEqual(10.0, GetValue(evaluator, 4));
+
+    propertySets[1] = {0.5, 0};
+    propertySets[2] = {4, 10};
+    evaluator.SyncValueNodes(readPropertySets);
+    evaluator.Update();
+    TestCheckEqual(50.0, GetValue(evaluator, 3));
+    TestCheckEqual(64.0, GetValue(evaluator, 4));
+
+    // The operator nodes are not read back.
+    evaluator.SyncValueNodes([](int64_t tag, double &, double &) { TestCheck(tag == 1 || tag == 2); });
+  }
+
+  TEST_METHOD(TestCycle) {
+    AnimatedGraphEvaluator evaluator;
+    evaluator.AddValueNode(1, 1, 0);
+    evaluator.AddOperatorNode(2, AnimatedGraphOperator::Addition, {1, 3});
+    evaluator.AddOperatorNode(3, AnimatedGraphOperator::Addition, {2});
+    evaluator.AddOperatorNode(4, AnimatedGraphOperator::Addition, {1, 1});
+    evaluator.Update();
+    TestCheckEqual(0.0, GetValue(evaluator, 2));
+    TestCheckEqual(0.0, GetValue(evaluator, 3));
+    TestCheckEqual(2.0, GetValue(evaluator, 4));
+  }
+};
+
+} // namespace Microsoft::ReactNative
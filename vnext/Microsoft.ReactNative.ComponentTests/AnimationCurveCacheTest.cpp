@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Modules/Animated/AnimationCurveCache.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+constexpr int BenchmarkIterationCount = 20;
+constexpr int SpringCount = 500;
+
+// Samples the spring the same way as SpringAnimationDriver: with exp, sin and cos calls for every frame.
+AnimationCurve SampleSpringCurve(const SpringCurveConfig &config) noexcept {
+  const auto c = config.Damping;
+  const auto m = config.Mass;
+  const auto k = config.Stiffness;
+  const auto v0 = -config.InitialVelocity;
+  const auto x0 = config.Distance;
+
+  const auto zeta = c / (2 * std::sqrt(k * m));
+  const auto omega0 = std::sqrt(k / m);
+  const auto omega1 = omega0 * std::sqrt(1.0 - (zeta * zeta));
+
+  AnimationCurve curve;
+  double time = 0;
+  for (;;) {
+    time += 1.0f / 60.0f;
+    double offset;
+    double velocity;
+    if (zeta < 1) {
+      const auto envelope = std::exp(-zeta * omega0 * time);
+      offset = x0 -
+          envelope * ((v0 + zeta * omega0 * x0) / omega1 * std::sin(omega1 * time) + x0 * std::cos(omega1 * time));
+      velocity = zeta * omega0 * envelope *
+              (std::sin(omega1 * time) * (v0 + zeta * omega0 * x0) / omega1 + x0 * std::cos(omega1 * time)) -
+          envelope * (std::cos(omega1 * time) * (v0 + zeta * omega0 * x0) - omega1 * x0 * std::sin(omega1 * time));
+    } else {
+      const auto envelope = std::exp(-omega0 * time);
+      offset = x0 - envelope * (x0 + (v0 + omega0 * x0) * time);
+      velocity = envelope * (v0 * (time * omega0 - 1) + time * x0 * (omega0 * omega0));
+    }
+
+    curve.push_back(static_cast<float>(offset));
+    const bool isAtRest = std::abs(velocity) <= config.RestSpeedThreshold &&
+        (std::abs(x0 - offset) <= config.RestDisplacementThreshold || k == 0);
+    const bool isOvershooting =
+        config.OvershootClamping && k > 0 && ((x0 > 0 && offset > x0) || (x0 < 0 && offset < x0));
+    if (isAtRest || isOvershooting) {
+      return curve;
+    }
+  }
+}
+
+SpringCurveConfig MakeSpringConfig(double stiffness, double damping, double distance) noexcept {
+  SpringCurveConfig config;
+  config.Stiffness = stiffness;
+  config.Damping = damping;
+  config.Mass = 1;
+  config.Distance = distance;
+  config.RestSpeedThreshold = 0.001;
+  config.RestDisplacementThreshold = 0.001;
+  return config;
+}
+
+void CheckSameCurve(const AnimationCurve &expected, const AnimationCurve &actual) noexcept {
+  // The recurrences may finish a frame apart from the closed form when a sample is right at a threshold.
+  TestCheck(expected.size() <= actual.size() + 1 && actual.size() <= expected.size() + 1);
+  for (size_t i = 0; i < std::min(expected.size(), actual.size()); ++i) {
+    TestCheck(std::abs(expected[i] - actual[i]) < 1e-3);
+  }
+}
+
+} // namespace
+
+TEST_CLASS (AnimationCurveCacheTest) {
+  TEST_METHOD(TestSpringCurveMatchesClosedForm) {
+    // Underdamped, critically damped and overdamped springs in both directions.
+    for (double damping : {5.0, 10.0, 20.0, 40.0}) {
+      for (double distance : {100.0, -250.0}) {
+        const auto config = MakeSpringConfig(100, damping, distance);
+        CheckSameCurve(SampleSpringCurve(config), GenerateSpringCurve(config));
+      }
+    }
+
+    auto clamped = MakeSpringConfig(100, 5, 100);
+    clamped.OvershootClamping = true;
+    clamped.InitialVelocity = -200;
+    CheckSameCurve(SampleSpringCurve(clamped), GenerateSpringCurve(clamped));
+  }
+
+  TEST_METHOD(TestDecayCurve) {
+    DecayCurveConfig config;
+    config.Velocity = 2;
+    config.Deceleration = 0.997;
+    const auto curve = GenerateDecayCurve(config);
+    const auto distance = config.Velocity / (1 - config.Deceleration);
+    TestCheck(!curve.empty());
+    TestCheck(std::abs(distance - curve.back()) < 0.1);
+    for (size_t i = 0; i < curve.size(); ++i) {
+      const auto time = (i + 1) / 60.0;
+      const auto expected = distance * (1 - std::exp(-(1 - config.Deceleration) * (1000 * time)));
+      TestCheck(std::abs(expected - curve[i]) < 1e-3);
+    }
+  }
+
+  TEST_METHOD(TestCacheSharesCurves) {
+    AnimationCurveCache cache;
+    const auto curve1 = cache.GetSpringCurve(MakeSpringConfig(100, 10, 100));
+    const auto curve2 = cache.GetSpringCurve(MakeSpringConfig(100, 10, 100));
+    const auto curve3 = cache.GetSpringCurve(MakeSpringConfig(100, 10, 50));
+    TestCheck(curve1 == curve2);
+    TestCheck(curve1 != curve3);
+    TestCheckEqual(1u, cache.HitCount());
+    TestCheckEqual(2u, cache.MissCount());
+
+    // The cache is bounded. Dropped curves stay alive while animations use them.
+    for (size_t i = 0; i < AnimationCurveCache::MaxCurveCount; ++i) {
+      cache.GetSpringCurve(MakeSpringConfig(100, 10, static_cast<double>(i + 1000)));
+    }
+
+    TestCheck(cache.GetSpringCurve(MakeSpringConfig(100, 10, 100)) != curve1);
+    TestCheckEqual(100.0f, std::round(curve1->back()));
+  }
+
+  // The benchmark is disabled in regular test runs. Run it with
+  // --gtest_also_run_disabled_tests --gtest_filter=AnimationCurveCacheTest.DISABLED_BenchmarkStartSprings
+  TEST_METHOD(DISABLED_BenchmarkStartSprings) {
+    // A list where every item starts one of a few springs, as in an entering animation.
+    std::vector<SpringCurveConfig> configs;
+    for (int i = 0; i < SpringCount; ++i) {
+      configs.push_back(MakeSpringConfig(100 + 50 * (i % 3), 10, 100));
+    }
+
+    const auto runBenchmark = [&configs](char const *name, auto &&getCurve) noexcept {
+      size_t frameCount = 0;
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < BenchmarkIterationCount; ++i) {
+        for (const auto &config : configs) {
+          frameCount += getCurve(config);
+        }
+      }
+
+      auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+      std::printf(
+          "%s: %d x %d springs, %zu frames in %lld us\n",
+          name,
+          BenchmarkIterationCount,
+          SpringCount,
+          frameCount,
+          static_cast<long long>(duration.count()));
+    };
+
+    runBenchmark("Closed form", [](const SpringCurveConfig &config) { return SampleSpringCurve(config).size(); });
+    runBenchmark("Recurrence", [](const SpringCurveConfig &config) { return GenerateSpringCurve(config).size(); });
+
+    AnimationCurveCache cache;
+    runBenchmark("Cached", [&cache](const SpringCurveConfig &config) { return cache.GetSpringCurve(config)->size(); });
+    TestCheckEqual(3u, cache.MissCount());
+  }
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Utils/BatchedEventQueue.h>
+
+namespace winrt::Microsoft::ReactNative {
+
+namespace {
+
+implementation::BatchedEvent MakeEvent(int64_t tag, const wchar_t *eventName = L"topScroll") {
+  return implementation::BatchedEvent{L"RCTEventEmitter", L"receiveEvent", eventName, tag, folly::dynamic(tag)};
+}
+
+} // namespace
+
+TEST_CLASS (BatchedEventQueueTest) {
+  TEST_METHOD(TestPushReportsFirstEvent) {
+    // Only the first event in the empty queue registers the frame callback.
+    BatchedEventQueue queue;
+    TestCheck(queue.Push(MakeEvent(1)));
+    TestCheck(!queue.Push(MakeEvent(2)));
+    TestCheck(!queue.PushCoalescing(MakeEvent(3)));
+
+    bool hasMoreEvents = true;
+    TestCheckEqual(3u, queue.TakeFrameEvents(hasMoreEvents).size());
+    TestCheck(!hasMoreEvents);
+    TestCheck(queue.PushCoalescing(MakeEvent(4)));
+  }
+
+  TEST_METHOD(TestTakeFrameEventsInOrder) {
+    BatchedEventQueue queue;
+    for (int64_t tag = 0; tag < 10; ++tag) {
+      queue.Push(MakeEvent(tag));
+    }
+
+    bool hasMoreEvents = true;
+    auto events = queue.TakeFrameEvents(hasMoreEvents);
+    TestCheck(!hasMoreEvents);
+    TestCheckEqual(10u, events.size());
+    for (size_t i = 0; i < events.size(); ++i) {
+      TestCheckEqual(static_cast<int64_t>(i), events[i].params.asInt());
+    }
+  }
+
+  TEST_METHOD(TestDrainBurstOverFrames) {
+    // A burst of events is delivered in frames of MaxEventCountPerFrame events.
+    // The frame callback is registered again until the queue is empty.
+    constexpr size_t MaxCount = BatchedEventQueue::MaxEventCountPerFrame;
+    TestCheckEqual(256u, MaxCount);
+
+    BatchedEventQueue queue;
+    const int64_t eventCount = static_cast<int64_t>(MaxCount * 2 + 88);
+    for (int64_t tag = 0; tag < eventCount; ++tag) {
+      queue.Push(MakeEvent(tag));
+    }
+
+    bool hasMoreEvents = false;
+    auto events = queue.TakeFrameEvents(hasMoreEvents);
+    TestCheck(hasMoreEvents);
+    TestCheckEqual(MaxCount, events.size());
+    TestCheckEqual(0, events.front().params.asInt());
+
+    // Events added while the queue is not empty do not register the frame callback.
+    TestCheck(!queue.Push(MakeEvent(eventCount)));
+
+    events = queue.TakeFrameEvents(hasMoreEvents);
+    TestCheck(hasMoreEvents);
+    TestCheckEqual(MaxCount, events.size());
+    TestCheckEqual(static_cast<int64_t>(MaxCount), events.front().params.asInt());
+
+    events = queue.TakeFrameEvents(hasMoreEvents);
+    TestCheck(!hasMoreEvents);
+    TestCheckEqual(89u, events.size());
+    TestCheckEqual(eventCount, events.back().params.asInt());
+
+    events = queue.TakeFrameEvents(hasMoreEvents);
+    TestCheck(!hasMoreEvents);
+    TestCheckEqual(0u, events.size());
+    TestCheck(queue.Push(MakeEvent(0)));
+  }
+
+  TEST_METHOD(TestCoalesceLeftoverEvents) {
+    // The events left for the next frames can still be coalesced.
+    BatchedEventQueue queue;
+    for (int64_t tag = 0; tag < 300; ++tag) {
+      queue.PushCoalescing(MakeEvent(tag % 2 == 0 ? 1000 + tag : 7));
+    }
+
+    bool hasMoreEvents = false;
+    auto events = queue.TakeFrameEvents(hasMoreEvents);
+    TestCheck(!hasMoreEvents);
+    TestCheckEqual(151u, events.size());
+    TestCheckEqual(7, events.back().params.asInt());
+
+    for (int64_t tag = 0; tag < 300; ++tag) {
+      queue.PushCoalescing(MakeEvent(tag));
+    }
+
+    events = queue.TakeFrameEvents(hasMoreEvents);
+    TestCheck(hasMoreEvents);
+    queue.PushCoalescing(MakeEvent(299));
+    queue.PushCoalescing(MakeEvent(299, L"topScrollEnd"));
+
+    events = queue.TakeFrameEvents(hasMoreEvents);
+    TestCheck(!hasMoreEvents);
+    TestCheckEqual(45u, events.size());
+    TestCheck(events[43].eventName == L"topScroll");
+    TestCheck(events[44].eventName == L"topScrollEnd");
+  }
+};
+
+} // namespace winrt::Microsoft::ReactNative
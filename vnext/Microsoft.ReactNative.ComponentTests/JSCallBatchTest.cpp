@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <JSI/ChakraRuntimeArgs.h>
+#include <JSI/ChakraRuntimeFactory.h>
+#include <Utils/JSCallBatch.h>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+// A bridge that records the calls. Calls to the 'fail' methods throw an error with the first argument as message.
+constexpr char TestBridgeScript[] = R"JS(
+var calls = [];
+var __fbBatchedBridge = {
+  modules: {},
+  registerCallableModule: function (name, module) {
+    this.modules[name] = module;
+  },
+  __callFunction: function (module, method, args) {
+    calls.push(module + '.' + method + JSON.stringify(args));
+    if (method === 'fail') {
+      throw new Error(args[0]);
+    }
+  },
+};
+)JS";
+
+} // namespace
+
+TEST_CLASS (JSCallBatchTest) {
+  std::unique_ptr<facebook::jsi::Runtime> m_runtime;
+
+  JSCallBatchTest() : m_runtime(::Microsoft::JSI::makeChakraRuntime(::Microsoft::JSI::ChakraRuntimeArgs{})) {}
+
+  std::string Evaluate(const char *script) {
+    facebook::jsi::Value result =
+        m_runtime->evaluateJavaScript(std::make_shared<facebook::jsi::StringBuffer>(script), "JSCallBatchTest.js");
+    return result.isString() ? result.getString(*m_runtime).utf8(*m_runtime) : std::string{};
+  }
+
+  TEST_METHOD(TestForEachJSCall) {
+    folly::dynamic calls = folly::dynamic::array;
+    AppendJSCall(calls, "RCTEventEmitter", "receiveEvent", folly::dynamic::array(5, "topScroll"));
+    AppendJSCall(calls, "RCTDeviceEventEmitter", "emit", folly::dynamic::array("didUpdateDimensions"));
+    TestCheckEqual(6u, calls.size());
+
+    std::vector<std::string> names;
+    std::vector<folly::dynamic> args;
+    ForEachJSCall(
+        std::move(calls), [&](std::string &&module, std::string &&method, folly::dynamic &&callArgs) noexcept {
+          names.push_back(module + "." + method);
+          args.push_back(std::move(callArgs));
+        });
+
+    TestCheckEqual(2u, names.size());
+    TestCheckEqual("RCTEventEmitter.receiveEvent", names[0]);
+    TestCheckEqual("RCTDeviceEventEmitter.emit", names[1]);
+    TestCheck(args[0] == folly::dynamic::array(5, "topScroll"));
+    TestCheck(args[1] == folly::dynamic::array("didUpdateDimensions"));
+  }
+
+  TEST_METHOD(TestDispatcherNeedsBridge) {
+    TestCheck(!InstallJSCallBatchDispatcher(*m_runtime));
+  }
+
+  TEST_METHOD(TestDispatcherCallsEachFunction) {
+    Evaluate(TestBridgeScript);
+    TestCheck(InstallJSCallBatchDispatcher(*m_runtime));
+
+    Evaluate("__fbBatchedBridge.modules.RNWBatchedCalls.callFunctions(['A', 'a', [1], 'B', 'b', [2, 'x']]);");
+    TestCheckEqual("A.a[1]|B.b[2,\"x\"]", Evaluate("calls.join('|')"));
+  }
+
+  TEST_METHOD(TestDispatcherReportsEachError) {
+    // The first error is thrown after the batch, and the other errors are reported to ErrorUtils.
+    Evaluate(TestBridgeScript);
+    Evaluate("var reported = []; var ErrorUtils = { reportError: function (e) { reported.push(e.message); } };");
+    TestCheck(InstallJSCallBatchDispatcher(*m_runtime));
+
+    TestCheckEqual("first", Evaluate(R"JS(
+      var thrown = '';
+      try {
+        __fbBatchedBridge.modules.RNWBatchedCalls.callFunctions(
+            ['A', 'fail', ['first'], 'B', 'b', [], 'C', 'fail', ['second'], 'D', 'fail', ['third']]);
+      } catch (e) {
+        thrown = e.message;
+      }
+      thrown;
+    )JS"));
+    TestCheckEqual("A.fail[\"first\"]|B.b[]|C.fail[\"second\"]|D.fail[\"third\"]", Evaluate("calls.join('|')"));
+    TestCheckEqual("second|third", Evaluate("reported.join('|')"));
+  }
+
+  TEST_METHOD(TestDispatcherLogsErrorsWithoutErrorUtils) {
+    Evaluate(TestBridgeScript);
+    Evaluate("var logged = []; var console = { error: function (e) { logged.push(e.message); } };");
+    TestCheck(InstallJSCallBatchDispatcher(*m_runtime));
+
+    Evaluate(R"JS(
+      try {
+        __fbBatchedBridge.modules.RNWBatchedCalls.callFunctions(['A', 'fail', ['first'], 'B', 'fail', ['second']]);
+      } catch (e) {
+      }
+    )JS");
+    TestCheckEqual("second", Evaluate("logged.join('|')"));
+  }
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <JSValueJson.h>
+#include <chrono>
+#include <cstdio>
+
+namespace winrt::Microsoft::ReactNative {
+
+// Compares JSValue JSON parsing and serialization with folly on large documents similar to
+// AsyncStorage values and networking responses. Timings are printed only, because they depend
+// on the machine running the tests.
+// The benchmarks are disabled in regular test runs. Run them with
+// --gtest_also_run_disabled_tests --gtest_filter=JSValueJsonBenchmark.*
+namespace {
+
+constexpr int BenchmarkIterationCount = 20;
+constexpr int DocumentItemCount = 5000;
+
+std::string MakeLargeDocument() noexcept {
+  std::string json = "{\"items\":[";
+  for (int i = 0; i < DocumentItemCount; ++i) {
+    if (i > 0) {
+      json += ',';
+    }
+
+    json += "{\"id\":" + std::to_string(i) + ",\"name\":\"Item number " + std::to_string(i) +
+        "\",\"price\":" + std::to_string(i * 1.25) + ",\"available\":" + (i % 3 ? "true" : "false") +
+        ",\"description\":\"A \\\"quoted\\\" description with an escape\\n and \\u00e9l\\u00e9ment text\"" +
+        ",\"tags\":[\"one\",\"two\",\"three\"],\"parent\":null}";
+  }
+
+  json += "],\"count\":" + std::to_string(DocumentItemCount) + "}";
+  return json;
+}
+
+template <class TAction>
+void RunBenchmark(char const *name, size_t size, TAction &&action) noexcept {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < BenchmarkIterationCount; ++i) {
+    action();
+  }
+
+  auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+  std::printf(
+      "%s: %d x %zu bytes in %lld us\n",
+      name,
+      BenchmarkIterationCount,
+      size,
+      static_cast<long long>(duration.count()));
+}
+
+} // namespace
+
+TEST_CLASS (JSValueJsonBenchmark) {
+  TEST_METHOD(DISABLED_BenchmarkParseLargeDocument) {
+    std::string json = MakeLargeDocument();
+    size_t follyItemCount = 0;
+    size_t jsValueItemCount = 0;
+
+    RunBenchmark("folly::parseJson", json.size(), [&]() noexcept {
+      folly::dynamic value = folly::parseJson(json);
+      follyItemCount = value["items"].size();
+    });
+
+    RunBenchmark("TryParseJson", json.size(), [&]() noexcept {
+      JSValue value;
+      TestCheck(TryParseJson(json, value));
+      jsValueItemCount = value["items"].AsArray().size();
+    });
+
+    TestCheckEqual(follyItemCount, jsValueItemCount);
+  }
+
+  TEST_METHOD(DISABLED_BenchmarkSerializeLargeDocument) {
+    std::string json = MakeLargeDocument();
+    folly::dynamic follyValue = folly::parseJson(json);
+    JSValue jsValue;
+    TestCheck(TryParseJson(json, jsValue));
+    size_t follyJsonSize = 0;
+    size_t jsValueJsonSize = 0;
+
+    RunBenchmark("folly::toJson", json.size(), [&]() noexcept { follyJsonSize = folly::toJson(follyValue).size(); });
+    RunBenchmark("ToJson", json.size(), [&]() noexcept { jsValueJsonSize = ToJson(jsValue).size(); });
+
+    // The outputs differ in the property order and number formatting, but both must be complete.
+    TestCheck(follyJsonSize > json.size() / 2);
+    TestCheck(jsValueJsonSize > json.size() / 2);
+  }
+};
+
+} // namespace winrt::Microsoft::ReactNative
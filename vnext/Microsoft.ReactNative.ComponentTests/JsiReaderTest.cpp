@@ -4,6 +4,9 @@
 #include "pch.h"
 #include <JSI/ChakraRuntimeArgs.h>
 #include <JSI/ChakraRuntimeFactory.h>
+#include <JSValue.h>
+#include <JSValueArrayBuffer.h>
+#include <JSValueBinary.h>
 #include <JsiReader.h>
 #include <JsiWriter.h>
 #include "CommonReaderTest.h"
@@ -24,6 +27,110 @@ TEST_CLASS (JsiReaderTest) {
   }
 
   IMPORT_READER_TEST_CASES
+
+  TEST_METHOD(ReadWriteBinaryValue) {
+    JSValue value = JSValueObject{
+        {"items", JSValueArray{1, 2.5, "text", nullptr, JSValueObject{{"isEnabled", true}}}}, {"name", "Test"}};
+
+    IJSValueWriter writer = winrt::make<JsiWriter>(*m_runtime);
+    TestCheck(TryWriteBinaryValue(writer, value));
+    IJSValueReader reader = winrt::make<JsiReader>(*m_runtime, writer.as<JsiWriter>()->MoveResult());
+
+    JSValue result;
+    TestCheck(TryReadBinaryValue(reader, result));
+    TestCheck(result == value);
+  }
+
+  TEST_METHOD(ReadBinaryArgument) {
+    IJSValueWriter writer = winrt::make<JsiWriter>(*m_runtime);
+    TestCheck(TryWriteBinaryValue(writer, JSValueArray{42, JSValueObject{{"x", 1}, {"y", "z"}}}));
+    const facebook::jsi::Value *args = nullptr;
+    size_t count = 0;
+    writer.as<JsiWriter>()->AccessResultAsArgs(args, count);
+    TestCheckEqual(2u, count);
+
+    IJSValueReader reader = winrt::make<JsiReader>(*m_runtime, args, count);
+    TestCheck(reader.GetNextArrayItem());
+    TestCheckEqual(42, reader.GetInt64());
+    TestCheck(reader.GetNextArrayItem());
+    JSValue argument;
+    TestCheck(TryReadBinaryValue(reader, argument));
+    JSValue expected = JSValueObject{{"x", 1}, {"y", "z"}};
+    TestCheck(argument == expected);
+    TestCheck(!reader.GetNextArrayItem());
+  }
+
+  TEST_METHOD(ReuseReaderAndWriter) {
+    IJSValueWriter argsWriter = winrt::make<JsiWriter>(*m_runtime);
+    TestCheck(TryWriteBinaryValue(argsWriter, JSValueArray{1, "a"}));
+    const facebook::jsi::Value *args = nullptr;
+    size_t count = 0;
+    argsWriter.as<JsiWriter>()->AccessResultAsArgs(args, count);
+
+    IJSValueReader reader = winrt::make<JsiReader>(*m_runtime, nullptr, 0);
+    IJSValueWriter writer = winrt::make<JsiWriter>(*m_runtime);
+    for (int i = 0; i < 2; ++i) {
+      reader.as<JsiReader>()->Reset(args, count);
+      writer.as<JsiWriter>()->Reset();
+      TestCheck(reader.GetNextArrayItem());
+      TestCheckEqual(1, reader.GetInt64());
+      TestCheck(reader.GetNextArrayItem());
+      TestCheck(reader.GetString() == L"a");
+      TestCheck(!reader.GetNextArrayItem());
+
+      writer.WriteObjectBegin();
+      writer.WritePropertyName(L"index");
+      writer.WriteInt64(i);
+      writer.WriteObjectEnd();
+      IJSValueReader resultReader = winrt::make<JsiReader>(*m_runtime, writer.as<JsiWriter>()->MoveResult());
+      JSValue expected = JSValueObject{{"index", i}};
+      TestCheck(JSValue::ReadFrom(resultReader) == expected);
+    }
+  }
+
+  TEST_METHOD(ReadWriteArrayBuffer) {
+    std::vector<uint8_t> bytes{0, 1, 127, 128, 255};
+    IJSValueWriter writer = winrt::make<JsiWriter>(*m_runtime);
+    writer.WriteArrayBegin();
+    WriteArrayBuffer(writer, bytes);
+    writer.WriteString(L"next");
+    writer.WriteArrayEnd();
+    const facebook::jsi::Value *args = nullptr;
+    size_t count = 0;
+    writer.as<JsiWriter>()->AccessResultAsArgs(args, count);
+    TestCheckEqual(2u, count);
+    TestCheck(args[0].isObject() && args[0].getObject(*m_runtime).isArrayBuffer(*m_runtime));
+
+    IJSValueReader reader = winrt::make<JsiReader>(*m_runtime, args, count);
+    TestCheck(reader.GetNextArrayItem());
+    std::vector<uint8_t> result;
+    TestCheck(TryReadArrayBuffer(
+        reader, [&result](array_view<uint8_t const> data) { result.assign(data.begin(), data.end()); }));
+    TestCheck(result == bytes);
+    TestCheck(reader.GetNextArrayItem());
+    TestCheckEqual(L"next", reader.GetString());
+    TestCheck(!reader.GetNextArrayItem());
+  }
+
+  TEST_METHOD(ReadTypedArrayView) {
+    auto values = m_runtime->evaluateJavaScript(
+        std::make_shared<facebook::jsi::StringBuffer>(
+            "[new Uint8Array([0, 1, 2, 3, 4]).subarray(1, 4),"
+            " {buffer: new ArrayBuffer(4), byteOffset: -1, byteLength: NaN}]"),
+        "");
+    auto array = values.getObject(*m_runtime).getArray(*m_runtime);
+    std::vector<uint8_t> result;
+    auto copyBytes = [&result](array_view<uint8_t const> data) { result.assign(data.begin(), data.end()); };
+
+    // Typed arrays are read from their range of the ArrayBuffer.
+    IJSValueReader viewReader = winrt::make<JsiReader>(*m_runtime, array.getValueAtIndex(*m_runtime, 0));
+    TestCheck(TryReadArrayBuffer(viewReader, copyBytes));
+    TestCheck(result == std::vector<uint8_t>({1, 2, 3}));
+
+    // Other objects with a buffer property are not binary data.
+    IJSValueReader objectReader = winrt::make<JsiReader>(*m_runtime, array.getValueAtIndex(*m_runtime, 1));
+    TestCheck(!TryReadArrayBuffer(objectReader, copyBytes));
+  }
 };
 
 } // namespace winrt::Microsoft::ReactNative
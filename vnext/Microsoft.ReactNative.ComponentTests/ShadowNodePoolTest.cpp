@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Views/ShadowNodePool.h>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+int s_liveNodeCount;
+
+struct TestShadowNode : ShadowNode {
+  TestShadowNode() noexcept {
+    ++s_liveNodeCount;
+  }
+
+  ~TestShadowNode() override {
+    --s_liveNodeCount;
+  }
+
+  void onDropViewInstance() override {}
+  void removeAllChildren() override {}
+  void AddView(ShadowNode &, int64_t) override {}
+  void RemoveChildAt(int64_t) override {}
+  void createView(const winrt::Microsoft::ReactNative::JSValueObject &) override {}
+
+  std::string Text;
+};
+
+struct LargerTestShadowNode : TestShadowNode {
+  char Data[256]{};
+};
+
+} // namespace
+
+TEST_CLASS (ShadowNodePoolTest) {
+  TEST_METHOD(TestReuseReleasedNodes) {
+    s_liveNodeCount = 0;
+    ShadowNodePool pool{2};
+    auto node1 = pool.Create<TestShadowNode>();
+    auto node2 = pool.Create<TestShadowNode>();
+    auto node3 = pool.Create<TestShadowNode>();
+    node1->m_tag = 1;
+    node1->Text = "Some text that does not fit into the small string buffer";
+    TestCheckEqual(3, s_liveNodeCount);
+    TestCheckEqual(0u, pool.HitCount());
+    TestCheckEqual(3u, pool.MissCount());
+
+    // The released nodes are destroyed. Only two of them keep their memory.
+    pool.Release(node1);
+    pool.Release(node2);
+    pool.Release(node3);
+    TestCheckEqual(0, s_liveNodeCount);
+
+    // The reused nodes are new.
+    auto node4 = pool.Create<TestShadowNode>();
+    auto node5 = pool.Create<TestShadowNode>();
+    auto node6 = pool.Create<TestShadowNode>();
+    TestCheckEqual(0, node4->m_tag);
+    TestCheck(node4->Text.empty() && node5->Text.empty());
+    TestCheckEqual(2u, pool.HitCount());
+    TestCheckEqual(4u, pool.MissCount());
+
+    pool.Release(node4);
+    pool.Release(node5);
+    pool.Release(node6);
+    pool.SetCapacity(0);
+    TestCheckEqual(0, s_liveNodeCount);
+  }
+
+  TEST_METHOD(TestReleaseNodesNotCreatedByPool) {
+    s_liveNodeCount = 0;
+    ShadowNodePool pool;
+    pool.Release(new TestShadowNode());
+    TestCheckEqual(0, s_liveNodeCount);
+    TestCheckEqual(0u, pool.HitCount());
+
+    // Nodes of another type than the recycled one are deleted, and their memory is not reused.
+    pool.Release(pool.Create<TestShadowNode>());
+    pool.Release(new LargerTestShadowNode());
+    pool.Release(pool.Create<LargerTestShadowNode>());
+    TestCheckEqual(0, s_liveNodeCount);
+
+    auto node1 = pool.Create<TestShadowNode>();
+    auto node2 = pool.Create<TestShadowNode>();
+    TestCheckEqual(1u, pool.HitCount());
+    TestCheckEqual(2u, pool.MissCount());
+    pool.Release(node1);
+    pool.Release(node2);
+    TestCheckEqual(0, s_liveNodeCount);
+  }
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,409 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <JSValueJson.h>
+#include <Modules/YogaLayoutCore.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+
+using namespace winrt::Microsoft::ReactNative;
+
+namespace Microsoft::ReactNative {
+
+// Measures the layout without XAML by replaying UIManager traces into YogaLayoutCore.
+// A trace is a JSON array of operations with the UIManager argument names:
+//   {"op": "createView", "tag": 2, "props": {...}}
+//   {"op": "updateView", "tag": 2, "props": {...}}
+//   {"op": "setChildren", "containerTag": 1, "reactTags": [2, 3]}
+//   {"op": "manageChildren", "containerTag": 1, "moveFromIndices": [], "moveToIndices": [],
+//    "addChildReactTags": [4], "addAtIndices": [0], "removeAtIndices": [1]}
+//   {"op": "layout", "tag": 1, "width": 400, "height": 800}
+// The traces below are generated to look like a feed list and a settings form. Recorded traces use the same format.
+// Timings are printed only, because they depend on the machine running the tests.
+// The benchmarks are disabled in regular test runs. Run them with
+// --gtest_also_run_disabled_tests --gtest_filter=YogaLayoutCoreBenchmark.*
+namespace {
+
+constexpr int BenchmarkIterationCount = 20;
+constexpr int FeedItemCount = 300;
+constexpr int SettingsSectionCount = 20;
+constexpr int SettingsRowCount = 10;
+
+// Passes the props of a trace to YogaLayoutCore the same way NativeUIManager passes the UIManager props.
+YogaStyleValue ToYogaStyleValue(const JSValue &value) noexcept {
+  switch (value.Type()) {
+    case JSValueType::Null:
+      return YogaStyleValue{};
+    case JSValueType::Double:
+    case JSValueType::Int64:
+      return YogaStyleValue{value.AsDouble()};
+    case JSValueType::String:
+      return YogaStyleValue{*value.TryGetString()};
+    default:
+      return YogaStyleValue{std::string_view{}, YogaStyleValue::Kind::Other};
+  }
+}
+
+void StyleNode(YGNodeRef node, const JSValueObject &props, const YogaStyleErrorHandler &onError) noexcept {
+  for (const auto &pair : props) {
+    StyleYogaNode(node, YogaStyleProp{pair.first, ToYogaStyleValue(pair.second)}, false, onError);
+  }
+}
+
+class YogaTraceReplayer {
+ public:
+  void Replay(const JSValueArray &trace) noexcept {
+    for (const auto &op : trace) {
+      const std::string &name = op["op"].AsString();
+      if (name == "createView") {
+        StyleNode(m_core.CreateNode(op["tag"].AsInt64()), op["props"].AsObject(), OnStyleError);
+      } else if (name == "updateView") {
+        StyleNode(m_core.FindNode(op["tag"].AsInt64()), op["props"].AsObject(), OnStyleError);
+      } else if (name == "setChildren") {
+        SetChildren(op["containerTag"].AsInt64(), op["reactTags"].AsArray());
+      } else if (name == "manageChildren") {
+        ManageChildren(op);
+      } else if (name == "layout") {
+        int64_t rootTag = op["tag"].AsInt64();
+        m_core.CalculateLayout(rootTag, op["width"].AsSingle(), op["height"].AsSingle());
+        m_core.ApplyLayout(rootTag, [this](int64_t, float, float, float, float) noexcept { ++m_layoutCount; });
+      }
+    }
+  }
+
+  size_t NodeCount() const noexcept {
+    return m_core.NodeCount();
+  }
+
+  size_t LayoutCount() const noexcept {
+    return m_layoutCount;
+  }
+
+ private:
+  static void OnStyleError(const std::string &message) noexcept {
+    std::printf("Style error: %s\n", message.c_str());
+  }
+
+  void SetChildren(int64_t containerTag, const JSValueArray &reactTags) noexcept {
+    auto &children = m_children[containerTag];
+    for (const auto &tag : reactTags) {
+      m_core.InsertChild(containerTag, tag.AsInt64(), static_cast<uint32_t>(children.size()));
+      children.push_back(tag.AsInt64());
+    }
+  }
+
+  void ManageChildren(const JSValue &op) noexcept {
+    int64_t containerTag = op["containerTag"].AsInt64();
+    auto &children = m_children[containerTag];
+    const auto &moveFromIndices = op["moveFromIndices"].AsArray();
+    const auto &moveToIndices = op["moveToIndices"].AsArray();
+    const auto &removeAtIndices = op["removeAtIndices"].AsArray();
+
+    // Same as the UIManager: the moved and removed children are detached first, and the moved children
+    // are inserted again together with the added children in the order of their new indices.
+    std::vector<std::pair<int64_t, int64_t>> insertions; // index, tag
+    std::vector<int64_t> detachedTags;
+    for (size_t i = 0; i < moveFromIndices.size(); ++i) {
+      int64_t tag = children[static_cast<size_t>(moveFromIndices[i].AsInt64())];
+      insertions.emplace_back(moveToIndices[i].AsInt64(), tag);
+      detachedTags.push_back(tag);
+    }
+
+    std::vector<int64_t> removedTags;
+    for (const auto &index : removeAtIndices) {
+      int64_t tag = children[static_cast<size_t>(index.AsInt64())];
+      removedTags.push_back(tag);
+      detachedTags.push_back(tag);
+    }
+
+    for (int64_t tag : detachedTags) {
+      children.erase(std::find(children.begin(), children.end(), tag));
+    }
+
+    for (int64_t tag : removedTags) {
+      RemoveSubtree(tag);
+    }
+
+    const auto &addChildReactTags = op["addChildReactTags"].AsArray();
+    const auto &addAtIndices = op["addAtIndices"].AsArray();
+    for (size_t i = 0; i < addChildReactTags.size(); ++i) {
+      insertions.emplace_back(addAtIndices[i].AsInt64(), addChildReactTags[i].AsInt64());
+    }
+
+    std::sort(insertions.begin(), insertions.end());
+    for (const auto &insertion : insertions) {
+      size_t index = std::min(static_cast<size_t>(insertion.first), children.size());
+      m_core.InsertChild(containerTag, insertion.second, static_cast<uint32_t>(index));
+      children.insert(children.begin() + index, insertion.second);
+    }
+  }
+
+  void RemoveSubtree(int64_t tag) noexcept {
+    auto it = m_children.find(tag);
+    if (it != m_children.end()) {
+      auto children = std::move(it->second);
+      m_children.erase(it);
+      for (int64_t child : children) {
+        RemoveSubtree(child);
+      }
+    }
+
+    m_core.RemoveNode(tag);
+  }
+
+ private:
+  YogaLayoutCore m_core;
+  std::unordered_map<int64_t, std::vector<int64_t>> m_children;
+  size_t m_layoutCount{0};
+};
+
+struct YogaTraceBuilder {
+  int64_t CreateView(JSValueObject &&props) noexcept {
+    int64_t tag = NextTag++;
+    Ops.push_back(JSValueObject{{"op", "createView"}, {"tag", tag}, {"props", std::move(props)}});
+    return tag;
+  }
+
+  void UpdateView(int64_t tag, JSValueObject &&props) noexcept {
+    Ops.push_back(JSValueObject{{"op", "updateView"}, {"tag", tag}, {"props", std::move(props)}});
+  }
+
+  void SetChildren(int64_t containerTag, std::vector<int64_t> const &tags) noexcept {
+    JSValueArray reactTags;
+    for (int64_t tag : tags) {
+      reactTags.push_back(tag);
+    }
+
+    Ops.push_back(
+        JSValueObject{{"op", "setChildren"}, {"containerTag", containerTag}, {"reactTags", std::move(reactTags)}});
+  }
+
+  void AddChildren(int64_t containerTag, std::vector<int64_t> const &tags, int64_t index) noexcept {
+    JSValueArray addChildReactTags;
+    JSValueArray addAtIndices;
+    for (int64_t tag : tags) {
+      addChildReactTags.push_back(tag);
+      addAtIndices.push_back(index++);
+    }
+
+    Ops.push_back(JSValueObject{
+        {"op", "manageChildren"},
+        {"containerTag", containerTag},
+        {"moveFromIndices", JSValueArray{}},
+        {"moveToIndices", JSValueArray{}},
+        {"addChildReactTags", std::move(addChildReactTags)},
+        {"addAtIndices", std::move(addAtIndices)},
+        {"removeAtIndices", JSValueArray{}}});
+  }
+
+  void MoveAndRemoveChildren(int64_t containerTag, int64_t moveFrom, int64_t moveTo, int64_t removeAt) noexcept {
+    Ops.push_back(JSValueObject{
+        {"op", "manageChildren"},
+        {"containerTag", containerTag},
+        {"moveFromIndices", JSValueArray{moveFrom}},
+        {"moveToIndices", JSValueArray{moveTo}},
+        {"addChildReactTags", JSValueArray{}},
+        {"addAtIndices", JSValueArray{}},
+        {"removeAtIndices", JSValueArray{removeAt}}});
+  }
+
+  void Layout(int64_t rootTag) noexcept {
+    Ops.push_back(JSValueObject{{"op", "layout"}, {"tag", rootTag}, {"width", 400}, {"height", 800}});
+  }
+
+  int64_t NextTag{1};
+  JSValueArray Ops;
+};
+
+int64_t AddFeedItem(YogaTraceBuilder &builder, int i) noexcept {
+  int64_t avatar = builder.CreateView(JSValueObject{{"width", 48}, {"height", 48}, {"marginRight", 8}});
+  int64_t title = builder.CreateView(JSValueObject{{"height", 20}, {"flexShrink", 1}});
+  int64_t subtitle = builder.CreateView(JSValueObject{{"height", 16 * (1 + i % 3)}, {"marginTop", 4}});
+  int64_t text = builder.CreateView(JSValueObject{{"flex", 1}, {"flexDirection", "column"}});
+  builder.SetChildren(text, {title, subtitle});
+  int64_t like = builder.CreateView(JSValueObject{{"width", 24}, {"height", 24}, {"alignSelf", "center"}});
+  int64_t item = builder.CreateView(JSValueObject{
+      {"flexDirection", "row"},
+      {"alignItems", "flex-start"},
+      {"paddingHorizontal", 12},
+      {"paddingVertical", "2%"},
+      {"borderBottomWidth", 1}});
+  builder.SetChildren(item, {avatar, text, like});
+  return item;
+}
+
+// A scrolling list of feed items. New items are appended while scrolling, a few items are edited,
+// and one item is moved to the top while the last one is removed.
+JSValueArray MakeFeedTrace() noexcept {
+  YogaTraceBuilder builder;
+  int64_t root = builder.CreateView(JSValueObject{{"flex", 1}});
+  int64_t header = builder.CreateView(JSValueObject{{"height", 56}, {"paddingHorizontal", 16}});
+  int64_t list = builder.CreateView(JSValueObject{{"flexDirection", "column"}, {"flexGrow", 1}});
+  builder.SetChildren(root, {header, list});
+
+  std::vector<int64_t> items;
+  for (int i = 0; i < FeedItemCount / 2; ++i) {
+    items.push_back(AddFeedItem(builder, i));
+  }
+
+  builder.SetChildren(list, items);
+  builder.Layout(root);
+
+  for (int page = 0; page < 5; ++page) {
+    std::vector<int64_t> pageItems;
+    for (int i = 0; i < FeedItemCount / 10; ++i) {
+      pageItems.push_back(AddFeedItem(builder, i));
+    }
+
+    builder.AddChildren(list, pageItems, static_cast<int64_t>(items.size()));
+    items.insert(items.end(), pageItems.begin(), pageItems.end());
+    builder.Layout(root);
+
+    // Expanding an item changes the layout of one subtree and the positions of the items below it.
+    builder.UpdateView(items[page * 7], JSValueObject{{"paddingVertical", 24}});
+    builder.Layout(root);
+  }
+
+  int64_t itemCount = static_cast<int64_t>(items.size());
+  builder.MoveAndRemoveChildren(list, itemCount / 2, 0, itemCount - 1);
+  builder.Layout(root);
+  return std::move(builder.Ops);
+}
+
+// A form with sections of label and switch rows. Sections are collapsed and expanded with the display prop.
+JSValueArray MakeSettingsTrace() noexcept {
+  YogaTraceBuilder builder;
+  int64_t root = builder.CreateView(JSValueObject{{"flex", 1}, {"padding", 16}});
+
+  std::vector<int64_t> sections;
+  std::vector<int64_t> sectionBodies;
+  for (int s = 0; s < SettingsSectionCount; ++s) {
+    int64_t title = builder.CreateView(JSValueObject{{"height", 32}, {"marginBottom", 8}});
+    std::vector<int64_t> rows;
+    for (int r = 0; r < SettingsRowCount; ++r) {
+      int64_t label = builder.CreateView(JSValueObject{{"flex", 1}, {"height", 20}, {"marginEnd", 8}});
+      int64_t toggle = builder.CreateView(JSValueObject{{"width", 40}, {"height", 24}});
+      int64_t row = builder.CreateView(JSValueObject{
+          {"flexDirection", "row"},
+          {"justifyContent", "space-between"},
+          {"alignItems", "center"},
+          {"minHeight", 44},
+          {"paddingHorizontal", "4%"}});
+      builder.SetChildren(row, {label, toggle});
+      rows.push_back(row);
+    }
+
+    int64_t body = builder.CreateView(JSValueObject{{"flexDirection", "column"}, {"borderWidth", 1}});
+    builder.SetChildren(body, rows);
+    sectionBodies.push_back(body);
+
+    int64_t section = builder.CreateView(JSValueObject{{"marginVertical", 12}, {"flexDirection", "column"}});
+    builder.SetChildren(section, {title, body});
+    sections.push_back(section);
+  }
+
+  builder.SetChildren(root, sections);
+  builder.Layout(root);
+
+  for (int s = 0; s < SettingsSectionCount; s += 3) {
+    builder.UpdateView(sectionBodies[s], JSValueObject{{"display", "none"}});
+    builder.Layout(root);
+    builder.UpdateView(sectionBodies[s], JSValueObject{{"display", "flex"}});
+    builder.Layout(root);
+  }
+
+  return std::move(builder.Ops);
+}
+
+// Props of a recycled list row. Only some of them are layout props.
+JSValueObject MakeRowProps(int i) noexcept {
+  return JSValueObject{
+      {"flexDirection", i % 2 ? "row" : "row-reverse"},
+      {"alignItems", "center"},
+      {"justifyContent", "space-between"},
+      {"height", 48 + i % 5},
+      {"paddingHorizontal", "4%"},
+      {"marginBottom", 1},
+      {"borderBottomWidth", 1},
+      {"backgroundColor", i % 2 ? 0xFFFFFFFF : 0xFFEEEEEE},
+      {"opacity", 1},
+      {"accessibilityLabel", "Row " + std::to_string(i)},
+      {"testID", "row"}};
+}
+
+void RunTraceBenchmark(char const *name, const JSValueArray &generatedTrace) noexcept {
+  // Replay the trace from its JSON text, the same way as a recorded trace.
+  JSValue trace;
+  TestCheck(TryParseJson(ToJson(JSValue{generatedTrace.Copy()}), trace));
+  const auto &ops = trace.AsArray();
+  TestCheckEqual(generatedTrace.size(), ops.size());
+
+  size_t nodeCount = 0;
+  size_t layoutCount = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < BenchmarkIterationCount; ++i) {
+    YogaTraceReplayer replayer;
+    replayer.Replay(ops);
+    nodeCount = replayer.NodeCount();
+    layoutCount = replayer.LayoutCount();
+  }
+
+  auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+  std::printf(
+      "%s: %d x %zu ops, %zu nodes, %zu layout updates in %lld us\n",
+      name,
+      BenchmarkIterationCount,
+      ops.size(),
+      nodeCount,
+      layoutCount,
+      static_cast<long long>(duration.count()));
+
+  TestCheck(nodeCount > 0);
+  TestCheck(layoutCount >= nodeCount);
+}
+
+} // namespace
+
+TEST_CLASS (YogaLayoutCoreBenchmark) {
+  TEST_METHOD(DISABLED_BenchmarkFeedTrace) {
+    RunTraceBenchmark("Feed", MakeFeedTrace());
+  }
+
+  TEST_METHOD(DISABLED_BenchmarkSettingsTrace) {
+    RunTraceBenchmark("Settings", MakeSettingsTrace());
+  }
+
+  TEST_METHOD(DISABLED_BenchmarkStyleRecycledRows) {
+    constexpr int RowCount = 1000;
+    std::vector<JSValueObject> rowProps;
+    for (int i = 0; i < RowCount; ++i) {
+      rowProps.push_back(MakeRowProps(i));
+    }
+
+    YogaLayoutCore core;
+    YGNodeRef node = core.CreateNode(1);
+    size_t errorCount = 0;
+    auto onError = [&errorCount](const std::string &) noexcept { ++errorCount; };
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BenchmarkIterationCount; ++i) {
+      for (const auto &props : rowProps) {
+        StyleNode(node, props, onError);
+      }
+    }
+
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    std::printf(
+        "StyleYogaNode: %d x %d row updates in %lld us\n",
+        BenchmarkIterationCount,
+        RowCount,
+        static_cast<long long>(duration.count()));
+    TestCheckEqual(0u, errorCount);
+  }
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,359 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Modules/YogaLayoutCore.h>
+#include <algorithm>
+#include <thread>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+struct YogaLayoutResult {
+  int64_t Tag;
+  float Left;
+  float Top;
+  float Width;
+  float Height;
+};
+
+std::vector<YogaLayoutResult> ApplyLayout(YogaLayoutCore &core, int64_t rootTag) noexcept {
+  std::vector<YogaLayoutResult> results;
+  core.ApplyLayout(rootTag, [&results](int64_t tag, float left, float top, float width, float height) {
+    results.push_back(YogaLayoutResult{tag, left, top, width, height});
+  });
+  return results;
+}
+
+const YogaLayoutResult *FindResult(const std::vector<YogaLayoutResult> &results, int64_t tag) noexcept {
+  auto it = std::find_if(results.begin(), results.end(), [tag](const auto &result) { return result.Tag == tag; });
+  return it != results.end() ? &*it : nullptr;
+}
+
+void IgnoreStyleError(const std::string &) {}
+
+void StyleNode(
+    YGNodeRef node,
+    std::initializer_list<YogaStyleProp> props,
+    bool implementsPadding = false,
+    const YogaStyleErrorHandler &onError = IgnoreStyleError) noexcept {
+  for (const auto &prop : props) {
+    StyleYogaNode(node, prop, implementsPadding, onError);
+  }
+}
+
+void CreateStyledNode(YogaLayoutCore &core, int64_t tag, std::initializer_list<YogaStyleProp> props) noexcept {
+  StyleNode(core.CreateNode(tag), props);
+}
+
+// The measured views belong to the thread that lays them out.
+std::thread::id s_layoutThreadId;
+
+YGSize MeasureTextHeight(YGNodeRef node, float width, YGMeasureMode, float, YGMeasureMode) {
+  TestCheck(std::this_thread::get_id() == s_layoutThreadId);
+  return YGSize{width, *static_cast<float *>(YGNodeGetContext(node))};
+}
+
+int s_measureCount;
+
+YGSize MeasureAndCount(YGNodeRef node, float width, YGMeasureMode, float, YGMeasureMode) {
+  ++s_measureCount;
+  return YGSize{width, *static_cast<float *>(YGNodeGetContext(node))};
+}
+
+} // namespace
+
+TEST_CLASS (YogaLayoutCoreTest) {
+  TEST_METHOD(TestLayoutOfSmallTree) {
+    YogaLayoutCore core;
+    CreateStyledNode(core, 1, {{"flexDirection", "column"}});
+    CreateStyledNode(core, 2, {{"height", 50}, {"marginTop", 10}});
+    CreateStyledNode(core, 3, {{"flex", 1}, {"paddingLeft", "10%"}});
+    core.InsertChild(1, 2, 0);
+    core.InsertChild(1, 3, 1);
+    TestCheckEqual(3u, core.NodeCount());
+
+    core.CalculateLayout(1, 100, 200);
+    auto results = ApplyLayout(core, 1);
+    TestCheckEqual(3u, results.size());
+
+    auto header = FindResult(results, 2);
+    TestCheck(header != nullptr);
+    TestCheckEqual(10.0f, header->Top);
+    TestCheckEqual(100.0f, header->Width);
+    TestCheckEqual(50.0f, header->Height);
+
+    auto body = FindResult(results, 3);
+    TestCheck(body != nullptr);
+    TestCheckEqual(60.0f, body->Top);
+    TestCheckEqual(140.0f, body->Height);
+    TestCheckEqual(10.0f, YGNodeLayoutGetPadding(core.FindNode(3), YGEdgeLeft));
+  }
+
+  TEST_METHOD(TestApplyLayoutWalksChangedSubtrees) {
+    YogaLayoutCore core;
+    CreateStyledNode(core, 1, {{"width", 100}, {"height", 300}});
+    CreateStyledNode(core, 2, {{"height", 100}});
+    CreateStyledNode(core, 3, {{"height", 10}});
+    CreateStyledNode(core, 4, {{"height", 100}});
+    CreateStyledNode(core, 5, {{"height", 10}});
+    core.InsertChild(1, 2, 0);
+    core.InsertChild(2, 3, 0);
+    core.InsertChild(1, 4, 1);
+    core.InsertChild(4, 5, 0);
+
+    core.CalculateLayout(1, YGUndefined, YGUndefined);
+    TestCheckEqual(5u, ApplyLayout(core, 1).size());
+
+    // Nothing changed. Yoga reports a new layout only for the root.
+    core.CalculateLayout(1, YGUndefined, YGUndefined);
+    auto unchangedResults = ApplyLayout(core, 1);
+    TestCheckEqual(1u, unchangedResults.size());
+    TestCheckEqual(1, unchangedResults[0].Tag);
+
+    // Only the first subtree is laid out again. The second one keeps its cached layout and is not walked.
+    StyleNode(core.FindNode(3), {{"height", 20}});
+    core.CalculateLayout(1, YGUndefined, YGUndefined);
+    auto results = ApplyLayout(core, 1);
+    TestCheck(FindResult(results, 3) != nullptr);
+    TestCheckEqual(20.0f, FindResult(results, 3)->Height);
+    TestCheck(FindResult(results, 4) != nullptr);
+    TestCheck(FindResult(results, 5) == nullptr);
+  }
+
+  TEST_METHOD(TestMoveAndRemoveNodes) {
+    YogaLayoutCore core;
+    CreateStyledNode(core, 1, {{"flexDirection", "row"}});
+    CreateStyledNode(core, 2, {{"width", 30}});
+    CreateStyledNode(core, 3, {{"width", 40}});
+    core.InsertChild(1, 2, 0);
+    core.InsertChild(1, 3, 1);
+    TestCheck(core.CreateNode(2) == nullptr);
+
+    // Inserting a child that has a parent moves it.
+    core.InsertChild(1, 2, 1);
+    TestCheckEqual(2u, YGNodeGetChildCount(core.FindNode(1)));
+    TestCheck(YGNodeGetChild(core.FindNode(1), 0) == core.FindNode(3));
+
+    core.RemoveNode(3);
+    TestCheck(core.FindNode(3) == nullptr);
+    TestCheckEqual(1u, YGNodeGetChildCount(core.FindNode(1)));
+
+    core.RemoveChildren(1);
+    TestCheckEqual(0u, YGNodeGetChildCount(core.FindNode(1)));
+    TestCheck(YGNodeGetParent(core.FindNode(2)) == nullptr);
+    TestCheckEqual(2u, core.NodeCount());
+  }
+
+  TEST_METHOD(TestStyleProps) {
+    TestCheck(IsYogaStyleProp("flexDirection"));
+    TestCheck(IsYogaStyleProp("borderBottomWidth"));
+    TestCheck(!IsYogaStyleProp("backgroundColor"));
+
+    YogaLayoutCore core;
+    YGNodeRef node = core.CreateNode(1);
+    std::vector<std::string> errors;
+    auto onError = [&errors](const std::string &message) { errors.push_back(message); };
+
+    StyleNode(node, {{"width", "20px"}, {"opacity", 0.5}}, false, onError);
+    TestCheckEqual(1u, errors.size());
+    TestCheck(errors[0].find("'px' unit not needed") != std::string::npos);
+    TestCheck(!StyleYogaNode(node, YogaStyleProp{"opacity", 0.5}, false, onError));
+    TestCheck(StyleYogaNode(node, YogaStyleProp{"height", {"true", YogaStyleValue::Kind::Other}}, false, onError));
+    TestCheckEqual(2u, errors.size());
+    TestCheck(errors[1].find("Value 'true' for height") != std::string::npos);
+
+    // The padding props are left to views that implement padding themselves.
+    StyleNode(node, {{"padding", 8}}, true, onError);
+    core.CalculateLayout(1, 100, 100);
+    TestCheckEqual(0.0f, YGNodeLayoutGetPadding(node, YGEdgeTop));
+
+    StyleNode(node, {{"padding", 8}}, false, onError);
+    core.CalculateLayout(1, 100, 100);
+    TestCheckEqual(8.0f, YGNodeLayoutGetPadding(node, YGEdgeTop));
+    TestCheckEqual(2u, errors.size());
+  }
+
+  TEST_METHOD(TestEnumStyleProps) {
+    YogaLayoutCore core;
+    YGNodeRef node = core.CreateNode(1);
+    auto onError = [](const std::string &) {};
+
+    StyleNode(
+        node,
+        {{"flexDirection", "row-reverse"},
+         {"justifyContent", "space-evenly"},
+         {"alignSelf", "baseline"},
+         {"position", "absolute"},
+         {"overflow", "hidden"}},
+        false,
+        onError);
+    TestCheck(YGNodeStyleGetFlexDirection(node) == YGFlexDirectionRowReverse);
+    TestCheck(YGNodeStyleGetJustifyContent(node) == YGJustifySpaceEvenly);
+    TestCheck(YGNodeStyleGetAlignSelf(node) == YGAlignBaseline);
+    TestCheck(YGNodeStyleGetPositionType(node) == YGPositionTypeAbsolute);
+    TestCheck(YGNodeStyleGetOverflow(node) == YGOverflowHidden);
+
+    // Null resets the props to their defaults.
+    StyleNode(
+        node,
+        {{"flexDirection", {}}, {"justifyContent", {}}, {"alignSelf", {}}, {"position", {}}, {"overflow", {}}},
+        false,
+        onError);
+    TestCheck(YGNodeStyleGetFlexDirection(node) == YGFlexDirectionColumn);
+    TestCheck(YGNodeStyleGetJustifyContent(node) == YGJustifyFlexStart);
+    TestCheck(YGNodeStyleGetAlignSelf(node) == YGAlignAuto);
+    TestCheck(YGNodeStyleGetPositionType(node) == YGPositionTypeRelative);
+    TestCheck(YGNodeStyleGetOverflow(node) == YGOverflowVisible);
+  }
+
+  TEST_METHOD(TestCalculateLayoutsOfSeveralRoots) {
+    YogaLayoutCore core;
+    std::vector<YogaLayoutRoot> roots;
+    for (int64_t rootTag = 1; rootTag <= 40; rootTag += 10) {
+      CreateStyledNode(core, rootTag, {{"flexDirection", "column"}});
+      for (int64_t childTag = rootTag + 1; childTag < rootTag + 5; ++childTag) {
+        core.CreateNode(childTag);
+        core.SetMeasureFunc(childTag, MeasureTextHeight, std::make_shared<float>(static_cast<float>(rootTag)));
+        core.InsertChild(rootTag, childTag, static_cast<uint32_t>(childTag - rootTag - 1));
+      }
+
+      roots.push_back(YogaLayoutRoot{rootTag, 100, YGUndefined});
+    }
+
+    std::vector<std::thread> workers;
+    auto scheduler = [&workers](std::function<void()> &&task) { workers.emplace_back(std::move(task)); };
+    s_layoutThreadId = std::this_thread::get_id();
+    core.CalculateLayouts(roots, scheduler);
+    for (auto &worker : workers) {
+      worker.join();
+    }
+
+    // The calling thread lays out one of the roots.
+    TestCheckEqual(3u, workers.size());
+    for (const auto &root : roots) {
+      auto results = ApplyLayout(core, root.Tag);
+      TestCheckEqual(5u, results.size());
+      TestCheckEqual(static_cast<float>(root.Tag), FindResult(results, root.Tag + 1)->Height);
+      TestCheckEqual(3.0f * root.Tag, FindResult(results, root.Tag + 4)->Top);
+    }
+
+    // Only the dirty root is laid out again, and it does not need a worker.
+    core.SetMeasureFunc(22, MeasureTextHeight, std::make_shared<float>(50.0f));
+    YGNodeMarkDirty(core.FindNode(22));
+    core.CalculateLayouts(roots, scheduler);
+    TestCheckEqual(3u, workers.size());
+    TestCheckEqual(50.0f, YGNodeLayoutGetHeight(core.FindNode(22)));
+    TestCheckEqual(92.0f, YGNodeLayoutGetTop(core.FindNode(25)));
+  }
+
+  TEST_METHOD(TestCalculateLayoutsWithBusyWorkers) {
+    YogaLayoutCore core;
+    std::vector<YogaLayoutRoot> roots;
+    for (int64_t rootTag = 1; rootTag <= 3; ++rootTag) {
+      CreateStyledNode(core, rootTag, {{"width", static_cast<double>(rootTag * 10)}, {"height", 10}});
+      roots.push_back(YogaLayoutRoot{rootTag, YGUndefined, YGUndefined});
+    }
+
+    // The workers start only after the call returns. The calling thread lays out all roots itself,
+    // and the late workers find no roots left.
+    std::vector<std::function<void()>> tasks;
+    core.CalculateLayouts(roots, [&tasks](std::function<void()> &&task) { tasks.push_back(std::move(task)); });
+    TestCheckEqual(2u, tasks.size());
+    for (const auto &root : roots) {
+      TestCheckEqual(root.Tag * 10.0f, YGNodeLayoutGetWidth(core.FindNode(root.Tag)));
+    }
+
+    for (auto &task : tasks) {
+      task();
+    }
+  }
+
+  TEST_METHOD(TestMeasureCache) {
+    YogaLayoutCore core;
+    CreateStyledNode(core, 1, {{"flexDirection", "column"}});
+    CreateStyledNode(core, 2, {{"height", 10}});
+    core.CreateNode(3);
+    auto textHeight = std::make_shared<float>(20.0f);
+    core.SetMeasureFunc(3, MeasureAndCount, std::shared_ptr<float>{textHeight});
+    core.InsertChild(1, 2, 0);
+    core.InsertChild(1, 3, 1);
+
+    s_measureCount = 0;
+    core.CalculateLayout(1, 100, YGUndefined);
+    TestCheckEqual(1, s_measureCount);
+
+    // A style change dirties the text node, but its content and constraints are the same.
+    StyleNode(core.FindNode(3), {{"marginTop", 5}});
+    core.CalculateLayout(1, 100, YGUndefined);
+    TestCheckEqual(1, s_measureCount);
+    TestCheckEqual(15.0f, YGNodeLayoutGetTop(core.FindNode(3)));
+
+    // New constraints are measured.
+    core.CalculateLayout(1, 80, YGUndefined);
+    TestCheckEqual(2, s_measureCount);
+    core.CalculateLayout(1, 100, YGUndefined);
+    TestCheckEqual(2, s_measureCount);
+
+    // New content is measured.
+    *textHeight = 40;
+    core.MarkContentDirty(3);
+    core.CalculateLayout(1, 100, YGUndefined);
+    TestCheckEqual(3, s_measureCount);
+    TestCheckEqual(40.0f, YGNodeLayoutGetHeight(core.FindNode(3)));
+  }
+
+  TEST_METHOD(TestUncachedMeasureFunc) {
+    YogaLayoutCore core;
+    CreateStyledNode(core, 1, {{"flexDirection", "column"}});
+    core.CreateNode(2);
+    auto viewHeight = std::make_shared<float>(20.0f);
+    core.SetMeasureFunc(2, MeasureAndCount, std::shared_ptr<float>{viewHeight}, /*canCacheMeasurements:*/ false);
+    core.InsertChild(1, 2, 0);
+
+    s_measureCount = 0;
+    core.CalculateLayout(1, 100, YGUndefined);
+    TestCheckEqual(1, s_measureCount);
+
+    // The view changed without MarkContentDirty. Any other reason to lay it out measures it again.
+    *viewHeight = 40;
+    StyleNode(core.FindNode(2), {{"marginTop", 5}});
+    core.CalculateLayout(1, 100, YGUndefined);
+    TestCheckEqual(2, s_measureCount);
+    TestCheckEqual(40.0f, YGNodeLayoutGetHeight(core.FindNode(2)));
+  }
+
+  TEST_METHOD(TestNodePool) {
+    YogaLayoutCore core;
+    core.SetNodePoolCapacity(1);
+    CreateStyledNode(core, 1, {{"flexDirection", "row"}});
+    CreateStyledNode(core, 2, {{"width", 30}});
+    CreateStyledNode(core, 3, {{"width", 40}});
+    core.InsertChild(1, 2, 0);
+    core.InsertChild(2, 3, 0);
+    TestCheckEqual(3u, core.NodePoolMissCount());
+
+    // Only one removed node is kept, reset to the default style.
+    YGNodeRef removedNode = core.FindNode(2);
+    core.RemoveNode(2);
+    core.RemoveNode(3);
+    TestCheck(core.CreateNode(4) == removedNode);
+    TestCheckEqual(0u, YGNodeGetChildCount(removedNode));
+    TestCheck(YGNodeGetParent(removedNode) == nullptr);
+    TestCheck(YGNodeStyleGetFlexDirection(removedNode) == YGFlexDirectionColumn);
+    core.CreateNode(5);
+    TestCheckEqual(1u, core.NodePoolHitCount());
+    TestCheckEqual(4u, core.NodePoolMissCount());
+  }
+
+  TEST_METHOD(TestPaintOnlyProps) {
+    TestCheck(IsPaintOnlyProp("backgroundColor"));
+    TestCheck(IsPaintOnlyProp("color"));
+    TestCheck(!IsPaintOnlyProp("text"));
+    TestCheck(!IsPaintOnlyProp("fontSize"));
+    TestCheck(!IsPaintOnlyProp("width"));
+  }
+};
+
+} // namespace Microsoft::ReactNative
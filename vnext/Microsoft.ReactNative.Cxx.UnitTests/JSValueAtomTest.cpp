@@ -0,0 +1,138 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <thread>
+#include <unordered_set>
+#include "JSValueAtom.h"
+#include "JSValueTreeReader.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+TEST_CLASS (JSValueAtomTest) {
+  TEST_METHOD(TestInternReturnsSameAtom) {
+    JSValueAtom width1 = JSValueAtom::Intern("width");
+    JSValueAtom width2 = JSValueAtom::Intern(std::string{"wid"} + "th");
+    JSValueAtom width3 = JSValueAtom::Intern(L"width");
+    JSValueAtom height = JSValueAtom::Intern("height");
+
+    TestCheck(width1 == width2);
+    TestCheck(width1 == width3);
+    TestCheck(width1 != height);
+    TestCheckEqual("width", width1.Name());
+    TestCheckEqual(width1.Hash(), width2.Hash());
+    TestCheckEqual(HashPropertyName("width"), width1.Hash());
+  }
+
+  TEST_METHOD(TestEmptyAtom) {
+    JSValueAtom empty;
+    TestCheck(empty.IsEmpty());
+    TestCheck(empty == JSValueAtom::Intern(""));
+    TestCheck(empty.Name().empty());
+    TestCheck(!JSValueAtom::Intern("x").IsEmpty());
+  }
+
+  TEST_METHOD(TestTryFindDoesNotIntern) {
+    size_t count = JSValueAtom::GetInternedCount();
+    TestCheck(JSValueAtom::TryFind("neverInternedPropertyName").IsEmpty());
+    TestCheckEqual(count, JSValueAtom::GetInternedCount());
+
+    JSValueAtom atom = JSValueAtom::Intern("internedPropertyName");
+    TestCheck(atom == JSValueAtom::TryFind("internedPropertyName"));
+  }
+
+  TEST_METHOD(TestNonAsciiName) {
+    JSValueAtom atom = JSValueAtom::Intern(L"élément");
+    TestCheckEqual("\xC3\xA9l\xC3\xA9ment", atom.Name());
+    TestCheck(atom == JSValueAtom::Intern("\xC3\xA9l\xC3\xA9ment"));
+  }
+
+  TEST_METHOD(TestInternFromManyThreads) {
+    std::vector<std::thread> threads;
+    std::vector<JSValueAtom> atoms(8);
+    for (size_t i = 0; i < atoms.size(); ++i) {
+      threads.emplace_back([&atoms, i]() {
+        for (int j = 0; j < 100; ++j) {
+          JSValueAtom::Intern("threadProp" + std::to_string(j));
+        }
+
+        atoms[i] = JSValueAtom::Intern("threadProp42");
+      });
+    }
+
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    for (auto const &atom : atoms) {
+      TestCheck(atom == atoms[0]);
+    }
+  }
+
+  TEST_METHOD(TestInternManyNamesAgain) {
+    // More names than the per-thread cache slots, so the cached atoms are replaced.
+    std::vector<JSValueAtom> atoms;
+    for (int i = 0; i < 1000; ++i) {
+      atoms.push_back(JSValueAtom::Intern(L"cachedProp" + std::to_wstring(i)));
+    }
+
+    for (int i = 0; i < 1000; ++i) {
+      std::string name = "cachedProp" + std::to_string(i);
+      TestCheck(atoms[i] == JSValueAtom::Intern(name));
+      TestCheck(atoms[i] == JSValueAtom::Intern(std::wstring{name.begin(), name.end()}));
+      TestCheckEqual(name, atoms[i].Name());
+    }
+  }
+
+  TEST_METHOD(TestAtomAsHashKey) {
+    std::unordered_set<JSValueAtom> atoms{JSValueAtom::Intern("top"), JSValueAtom::Intern("left")};
+    TestCheckEqual(1u, atoms.count(JSValueAtom::Intern("top")));
+    TestCheckEqual(0u, atoms.count(JSValueAtom::Intern("right")));
+  }
+
+  TEST_METHOD(TestReadPropertyAtoms) {
+    JSValue value = JSValueObject{{"flex", 1}, {"margin", 2}};
+    IJSValueReader reader = MakeJSValueTreeReader(value);
+    TestCheck(reader.ValueType() == JSValueType::Object);
+
+    std::vector<JSValueAtom> names;
+    JSValueAtom name;
+    while (GetNextObjectProperty(reader, name)) {
+      names.push_back(name);
+    }
+
+    TestCheckEqual(2u, names.size());
+    TestCheck(names[0] == JSValueAtom::Intern("flex"));
+    TestCheck(names[1] == JSValueAtom::Intern("margin"));
+  }
+
+  TEST_METHOD(TestPropertyTable) {
+    JSValuePropertyTable table{"flexDirection", "justifyContent", "alignItems", "width", "height", "margin"};
+
+    TestCheckEqual(6u, table.size());
+    for (size_t i = 0; i < table.size(); ++i) {
+      TestCheckEqual(static_cast<int>(i), table.Find(table[i]));
+    }
+
+    TestCheckEqual(3, table.Find(JSValueAtom::Intern("width")));
+    TestCheckEqual(-1, table.Find("backgroundColor"));
+    TestCheckEqual(-1, table.Find(""));
+    TestCheckEqual(-1, JSValuePropertyTable{}.Find("width"));
+  }
+
+  TEST_METHOD(TestLargePropertyTable) {
+    std::vector<std::string> names;
+    for (int i = 0; i < 300; ++i) {
+      names.push_back("prop" + std::to_string(i));
+    }
+
+    JSValuePropertyTable table(names.begin(), names.end());
+    for (int i = 0; i < 300; ++i) {
+      TestCheckEqual(i, table.Find(names[i]));
+    }
+
+    TestCheckEqual(-1, table.Find("prop300"));
+  }
+};
+
+} // namespace winrt::Microsoft::ReactNative
@@ -0,0 +1,235 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "JSValueBinary.h"
+#include "JSValueTreeReader.h"
+#include "JSValueTreeWriter.h"
+#include "JsonJSValueReader.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+namespace {
+
+JSValue MakeTestValue() noexcept {
+  return JSValueObject{
+      {"nullValue", nullptr},
+      {"boolValue", true},
+      {"intValue", -42},
+      {"bigIntValue", std::numeric_limits<int64_t>::min()},
+      {"doubleValue", 3.5},
+      {"stringValue", "Hello"},
+      {"unicodeValue", "\xC3\xA9l\xC3\xA9ment"},
+      {"emptyObject", JSValueObject{}},
+      {"emptyArray", JSValueArray{}},
+      {"nested", JSValueObject{{"items", JSValueArray{1, "two", JSValueArray{3.25, false}, JSValueObject{{"x", 4}}}}}}};
+}
+
+std::vector<uint8_t> Encode(JSValue const &value) noexcept {
+  std::vector<uint8_t> buffer;
+  JSValueBinaryEncoder encoder{buffer};
+  value.WriteTo(encoder);
+  return buffer;
+}
+
+JSValue Decode(std::vector<uint8_t> const &buffer) noexcept {
+  JSValueBinaryDecoder decoder{buffer};
+  return JSValue::ReadFrom(decoder);
+}
+
+// Writes the value as tokens without the IJSValueBinaryWriter support.
+struct TokenOnlyWriter : implements<TokenOnlyWriter, IJSValueWriter> {
+  void WriteNull() noexcept {
+    m_writer.WriteNull();
+  }
+
+  void WriteBoolean(bool value) noexcept {
+    m_writer.WriteBoolean(value);
+  }
+
+  void WriteInt64(int64_t value) noexcept {
+    m_writer.WriteInt64(value);
+  }
+
+  void WriteDouble(double value) noexcept {
+    m_writer.WriteDouble(value);
+  }
+
+  void WriteString(const winrt::hstring &value) noexcept {
+    m_writer.WriteString(value);
+  }
+
+  void WriteObjectBegin() noexcept {
+    m_writer.WriteObjectBegin();
+  }
+
+  void WritePropertyName(const winrt::hstring &name) noexcept {
+    m_writer.WritePropertyName(name);
+  }
+
+  void WriteObjectEnd() noexcept {
+    m_writer.WriteObjectEnd();
+  }
+
+  void WriteArrayBegin() noexcept {
+    m_writer.WriteArrayBegin();
+  }
+
+  void WriteArrayEnd() noexcept {
+    m_writer.WriteArrayEnd();
+  }
+
+  IJSValueWriter m_writer{MakeJSValueTreeWriter()};
+};
+
+} // namespace
+
+TEST_CLASS (JSValueBinaryTest) {
+  TEST_METHOD(TestRoundTrip) {
+    JSValue value = MakeTestValue();
+    auto buffer = Encode(value);
+    TestCheckEqual(JSValueBinaryFormatVersion, buffer[0]);
+    TestCheck(Decode(buffer) == value);
+  }
+
+  TEST_METHOD(TestRoundTripPrimitives) {
+    for (auto const &value : {JSValue{}, JSValue{false}, JSValue{0}, JSValue{127}, JSValue{-1}, JSValue{-0.0}}) {
+      TestCheck(Decode(Encode(value)) == value);
+    }
+
+    TestCheck(Decode(Encode(std::numeric_limits<int64_t>::max())) == std::numeric_limits<int64_t>::max());
+    TestCheck(Decode(Encode("")) == "");
+  }
+
+  TEST_METHOD(TestCompactEncoding) {
+    // The version, the array tag, three number tags with one byte varints, and the end tag.
+    TestCheckEqual(9u, Encode(JSValueArray{1, -1, 63}).size());
+    // The version, the object tag, the name tag and length, two name chars, the true tag, and the end tag.
+    TestCheckEqual(8u, Encode(JSValueObject{{"ok", true}}).size());
+  }
+
+  TEST_METHOD(TestBinaryReader) {
+    IJSValueReader reader = MakeJSValueBinaryReader(Encode(MakeTestValue()));
+    TestCheck(JSValue::ReadFrom(reader) == MakeTestValue());
+  }
+
+  TEST_METHOD(TestBinaryReaderWalk) {
+    IJSValueReader reader = MakeJSValueBinaryReader(Encode(JSValueObject{{"a", JSValueArray{1, "x"}}, {"b", 2.5}}));
+    TestCheck(reader.ValueType() == JSValueType::Object);
+
+    hstring propertyName;
+    TestCheck(reader.GetNextObjectProperty(propertyName));
+    TestCheckEqual(L"a", std::wstring_view{propertyName});
+    TestCheck(reader.ValueType() == JSValueType::Array);
+    TestCheck(reader.GetNextArrayItem());
+    TestCheckEqual(1, reader.GetInt64());
+    TestCheck(reader.GetNextArrayItem());
+    TestCheckEqual(L"x", std::wstring_view{reader.GetString()});
+    TestCheck(!reader.GetNextArrayItem());
+
+    TestCheck(reader.GetNextObjectProperty(propertyName));
+    TestCheckEqual(L"b", std::wstring_view{propertyName});
+    TestCheckEqual(2.5, reader.GetDouble());
+    TestCheck(!reader.GetNextObjectProperty(propertyName));
+  }
+
+  TEST_METHOD(TestSkipUnreadValues) {
+    auto buffer = Encode(JSValueObject{{"a", "skipped"}, {"b", JSValueObject{{"c", 1}}}, {"d", 4}});
+    JSValueBinaryDecoder decoder{buffer};
+    std::vector<std::string> names;
+    std::string_view propertyName;
+    while (decoder.GetNextObjectProperty(propertyName)) {
+      names.emplace_back(propertyName);
+      if (propertyName == "b") {
+        auto tokens = decoder.SkipValue();
+        TestCheckEqual(7u, tokens.size());
+      }
+    }
+
+    TestCheckEqual(3u, names.size());
+    TestCheckEqual("d", names[2]);
+  }
+
+  TEST_METHOD(TestReadNestedBinaryValue) {
+    // The binary reader returns a nested value without decoding it, and the reader continues after it.
+    IJSValueReader reader = MakeJSValueBinaryReader(Encode(JSValueArray{JSValueObject{{"x", 1}}, 2}));
+    TestCheck(reader.GetNextArrayItem());
+    JSValue nested = Decode(ReadBinaryValue(reader));
+    TestCheckEqual(1, nested["x"]);
+    TestCheck(reader.GetNextArrayItem());
+    TestCheckEqual(2, reader.GetInt64());
+    TestCheck(!reader.GetNextArrayItem());
+  }
+
+  TEST_METHOD(TestBinaryWriter) {
+    IJSValueWriter writer = MakeJSValueBinaryWriter();
+    writer.WriteObjectBegin();
+    writer.WritePropertyName(L"name");
+    writer.WriteString(L"élément");
+    writer.WritePropertyName(L"items");
+    WriteBinaryValue(writer, Encode(JSValueArray{1, 2}));
+    writer.WriteObjectEnd();
+
+    JSValue expected = JSValueObject{{"name", "\xC3\xA9l\xC3\xA9ment"}, {"items", JSValueArray{1, 2}}};
+    TestCheck(Decode(TakeBinaryValue(writer)) == expected);
+  }
+
+  TEST_METHOD(TestReadBinaryValueFromTokenReader) {
+    // The JSON reader does not implement IJSValueBinaryReader. The value is read token by token.
+    IJSValueReader reader = make<JsonJSValueReader>(LR"JSON({"a": [1, 2.5, "x"], "b": null})JSON");
+    JSValue expected = JSValueObject{{"a", JSValueArray{1, 2.5, "x"}}, {"b", nullptr}};
+    TestCheck(Decode(ReadBinaryValue(reader)) == expected);
+  }
+
+  TEST_METHOD(TestWriteBinaryValueToTokenWriter) {
+    IJSValueWriter writer = make<TokenOnlyWriter>();
+    WriteBinaryValue(writer, Encode(MakeTestValue()));
+    TestCheck(TakeJSValue(get_self<TokenOnlyWriter>(writer)->m_writer) == MakeTestValue());
+  }
+
+  TEST_METHOD(TestTryReadBinaryValue) {
+    JSValue value;
+    TestCheck(TryReadBinaryValue(MakeJSValueTreeReader(MakeTestValue()), value));
+    TestCheck(value == MakeTestValue());
+
+    // Primitive values and readers without IJSValueBinaryReader are read token by token.
+    TestCheck(!TryReadBinaryValue(MakeJSValueTreeReader(JSValue{1}), value));
+    TestCheck(!TryReadBinaryValue(make<JsonJSValueReader>(L"[1]"), value));
+
+    // The reader class without IJSValueBinaryReader is remembered. It does not affect other reader classes.
+    TestCheck(!TryReadBinaryValue(make<JsonJSValueReader>(L"[2]"), value));
+    TestCheck(TryReadBinaryValue(MakeJSValueTreeReader(MakeTestValue()), value));
+    TestCheck(value == MakeTestValue());
+  }
+
+  TEST_METHOD(TestTryWriteBinaryValue) {
+    IJSValueWriter writer = MakeJSValueTreeWriter();
+    writer.WriteArrayBegin();
+    TestCheck(TryWriteBinaryValue(writer, MakeTestValue()));
+    TestCheck(TryWriteBinaryValue(writer, JSValueArray{1, "a"}));
+    TestCheck(!TryWriteBinaryValue(writer, JSValue{5}));
+    writer.WriteArrayEnd();
+
+    JSValue expected = JSValueArray{MakeTestValue(), JSValueArray{1, "a"}};
+    TestCheck(TakeJSValue(writer) == expected);
+    TestCheck(!TryWriteBinaryValue(make<TokenOnlyWriter>(), MakeTestValue()));
+    TestCheck(!TryWriteBinaryValue(make<TokenOnlyWriter>(), MakeTestValue()));
+    TestCheck(TryWriteBinaryValue(MakeJSValueTreeWriter(), MakeTestValue()));
+  }
+
+  TEST_METHOD(TestDuplicatePropertiesKeepFirstValue) {
+    IJSValueWriter writer = MakeJSValueBinaryWriter();
+    writer.WriteObjectBegin();
+    writer.WritePropertyName(L"a");
+    writer.WriteInt64(1);
+    writer.WritePropertyName(L"a");
+    writer.WriteInt64(2);
+    writer.WriteObjectEnd();
+
+    JSValue value = Decode(TakeBinaryValue(writer));
+    TestCheckEqual(1u, value.PropertyCount());
+    TestCheckEqual(1, value["a"]);
+  }
+};
+
+} // namespace winrt::Microsoft::ReactNative
@@ -0,0 +1,117 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <chrono>
+#include <cstdio>
+#include "JSValueFlatObject.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+// Compares JSValueObject and JSValueFlatObject on prop payloads similar to what
+// UIManager createView and updateView calls receive. Timings are printed only,
+// because they depend on the machine running the tests.
+// The benchmarks are disabled in regular test runs. Run them with
+// --gtest_also_run_disabled_tests --gtest_filter=JSValueFlatObjectBenchmark.*
+namespace {
+
+constexpr int BenchmarkIterationCount = 20000;
+
+// Property names of a typical createView call for a View.
+constexpr std::string_view CreateViewPropNames[] = {
+    "accessible",
+    "backgroundColor",
+    "borderRadius",
+    "collapsable",
+    "flex",
+    "height",
+    "nativeID",
+    "onLayout",
+    "testID",
+    "width"};
+
+// Property names of a typical updateView call during an animation or a layout change.
+constexpr std::string_view UpdateViewPropNames[] = {"opacity", "transform", "width"};
+
+template <class TObject>
+TObject MakeCreateViewProps(int i) noexcept {
+  return TObject{
+      {"accessible", true},
+      {"backgroundColor", 0xFF336699},
+      {"borderRadius", 4.0},
+      {"collapsable", false},
+      {"flex", 1},
+      {"height", 48 + i % 7},
+      {"nativeID", "row"},
+      {"onLayout", true},
+      {"testID", "listItem"},
+      {"width", 320}};
+}
+
+template <class TObject>
+TObject MakeUpdateViewProps(int i) noexcept {
+  return TObject{
+      {"opacity", (i % 10) / 10.0}, {"transform", JSValueArray{JSValueObject{{"scale", 1.5}}}}, {"width", i}};
+}
+
+// Simulates a view manager reading props: each property is looked up by name, and then all of them are iterated.
+template <class TObject, size_t N>
+int64_t ConsumeProps(TObject const &props, std::string_view const (&propNames)[N]) noexcept {
+  int64_t checksum = 0;
+  for (auto const &propName : propNames) {
+    auto it = props.find(propName);
+    checksum += it != props.end() ? static_cast<int64_t>(it->second.Type()) : -1;
+  }
+
+  for (auto const &prop : props) {
+    checksum += static_cast<int64_t>(prop.first.size());
+  }
+
+  return checksum;
+}
+
+template <class TObject, class TMakeProps, size_t N>
+int64_t RunBenchmark(char const *name, TMakeProps makeProps, std::string_view const (&propNames)[N]) noexcept {
+  int64_t checksum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < BenchmarkIterationCount; ++i) {
+    TObject props = makeProps(i);
+    checksum += ConsumeProps(props, propNames);
+  }
+
+  auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+  std::printf("%s: %d payloads in %lld us\n", name, BenchmarkIterationCount, static_cast<long long>(duration.count()));
+  return checksum;
+}
+
+} // namespace
+
+TEST_CLASS (JSValueFlatObjectBenchmark) {
+  TEST_METHOD(DISABLED_BenchmarkCreateViewProps) {
+    auto mapChecksum = RunBenchmark<JSValueObject>(
+        "JSValueObject createView", MakeCreateViewProps<JSValueObject>, CreateViewPropNames);
+    auto flatChecksum = RunBenchmark<JSValueFlatObject>(
+        "JSValueFlatObject createView", MakeCreateViewProps<JSValueFlatObject>, CreateViewPropNames);
+    TestCheckEqual(mapChecksum, flatChecksum);
+  }
+
+  TEST_METHOD(DISABLED_BenchmarkUpdateViewProps) {
+    auto mapChecksum = RunBenchmark<JSValueObject>(
+        "JSValueObject updateView", MakeUpdateViewProps<JSValueObject>, UpdateViewPropNames);
+    auto flatChecksum = RunBenchmark<JSValueFlatObject>(
+        "JSValueFlatObject updateView", MakeUpdateViewProps<JSValueFlatObject>, UpdateViewPropNames);
+    TestCheckEqual(mapChecksum, flatChecksum);
+  }
+
+  TEST_METHOD(DISABLED_BenchmarkCopyCreateViewProps) {
+    auto mapProps = MakeCreateViewProps<JSValueObject>(0);
+    auto flatProps = MakeCreateViewProps<JSValueFlatObject>(0);
+    auto mapChecksum = RunBenchmark<JSValueObject>(
+        "JSValueObject copy", [&mapProps](int) noexcept { return mapProps.Copy(); }, CreateViewPropNames);
+    auto flatChecksum = RunBenchmark<JSValueFlatObject>(
+        "JSValueFlatObject copy", [&flatProps](int) noexcept { return flatProps.Copy(); }, CreateViewPropNames);
+    TestCheckEqual(mapChecksum, flatChecksum);
+  }
+};
+
+} // namespace winrt::Microsoft::ReactNative
@@ -0,0 +1,203 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "JSValueFlatObject.h"
+#include "JSValueTreeReader.h"
+#include "JSValueTreeWriter.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+TEST_CLASS (JSValueFlatObjectTest) {
+  TEST_METHOD(TestInitializerList) {
+    JSValueFlatObject obj{{"width", 100}, {"height", 50}, {"opacity", 0.5}, {"width", 200}};
+
+    TestCheckEqual(3u, obj.size());
+    TestCheck(obj.capacity() == JSValueFlatObject::InlineCapacity);
+    TestCheckEqual(100, obj["width"].AsInt32());
+    TestCheckEqual(50, obj["height"].AsInt32());
+    TestCheckEqual(0.5, obj["opacity"].AsDouble());
+    TestCheck(obj.TryGetObjectProperty("missing") == nullptr);
+
+    // Non-const operator[] adds missing properties the same way as JSValueObject does.
+    TestCheck(obj["missing"].IsNull());
+    TestCheckEqual(4u, obj.size());
+  }
+
+  TEST_METHOD(TestIterationOrderMatchesJSValueObject) {
+    JSValueObject mapObj{{"zIndex", 1}, {"backgroundColor", "red"}, {"flex", 1}, {"accessible", true}};
+    JSValueFlatObject flatObj{{"zIndex", 1}, {"backgroundColor", "red"}, {"flex", 1}, {"accessible", true}};
+
+    TestCheckEqual(mapObj.size(), flatObj.size());
+    auto mapIt = mapObj.begin();
+    for (auto const &property : flatObj) {
+      TestCheckEqual(mapIt->first, property.first);
+      TestCheck(mapIt->second.Equals(property.second));
+      ++mapIt;
+    }
+  }
+
+  TEST_METHOD(TestTryEmplaceAndInsertOrAssign) {
+    JSValueFlatObject obj;
+    auto [it1, isAdded1] = obj.try_emplace("b", 1);
+    TestCheck(isAdded1);
+    TestCheckEqual("b", it1->first);
+
+    auto [it2, isAdded2] = obj.try_emplace("b", 2);
+    TestCheck(!isAdded2);
+    TestCheckEqual(1, it2->second.AsInt32());
+
+    auto [it3, isAdded3] = obj.insert_or_assign("b", 3);
+    TestCheck(!isAdded3);
+    TestCheckEqual(3, it3->second.AsInt32());
+
+    obj.try_emplace("a");
+    obj.insert_or_assign("c", "x");
+    TestCheckEqual(3u, obj.size());
+    TestCheckEqual("a", obj.begin()->first);
+    TestCheck(obj.begin()->second.IsNull());
+    TestCheckEqual("x", obj["c"].AsString());
+  }
+
+  TEST_METHOD(TestGrowsPastInlineCapacityAndHashIndex) {
+    JSValueFlatObject obj;
+    for (int i = 99; i >= 0; --i) {
+      obj[std::to_string(i)] = i;
+    }
+
+    TestCheckEqual(100u, obj.size());
+    TestCheck(obj.capacity() >= 100);
+    for (int i = 0; i < 100; ++i) {
+      auto value = obj.TryGetObjectProperty(std::to_string(i));
+      TestCheck(value != nullptr);
+      TestCheckEqual(i, value->AsInt32());
+    }
+
+    TestCheck(obj.TryGetObjectProperty("100") == nullptr);
+    TestCheck(std::is_sorted(obj.begin(), obj.end(), [](auto const &left, auto const &right) {
+      return left.first < right.first;
+    }));
+  }
+
+  TEST_METHOD(TestErase) {
+    JSValueFlatObject obj;
+    for (int i = 0; i < 20; ++i) {
+      obj[std::to_string(i)] = i;
+    }
+
+    TestCheckEqual(1u, obj.erase("5"));
+    TestCheckEqual(0u, obj.erase("5"));
+    TestCheckEqual(0u, obj.count("5"));
+    TestCheckEqual(19u, obj.size());
+
+    auto it = obj.erase(obj.find("10"));
+    TestCheckEqual("11", it->first);
+    while (obj.size() > 3) {
+      obj.erase(obj.begin());
+    }
+
+    TestCheckEqual(3u, obj.size());
+    TestCheckEqual(9, obj["9"].AsInt32());
+    TestCheck(obj.find("0") == obj.end());
+  }
+
+  TEST_METHOD(TestHashIndexAfterInsertAndErase) {
+    // The hash index is updated in place. Compare the lookups with std::map after each change.
+    JSValueFlatObject obj;
+    std::map<std::string, int> expected;
+    uint32_t random = 1;
+    for (int i = 0; i < 2000; ++i) {
+      random = random * 1103515245 + 12345;
+      std::string name = std::to_string((random >> 16) % 64);
+      if ((random >> 8) % 3 != 0) {
+        obj[name] = i;
+        expected[name] = i;
+      } else {
+        TestCheckEqual(expected.erase(name), obj.erase(name));
+      }
+
+      TestCheckEqual(expected.size(), obj.size());
+      for (auto const &property : expected) {
+        auto value = obj.TryGetObjectProperty(property.first);
+        TestCheck(value != nullptr);
+        TestCheckEqual(property.second, value->AsInt32());
+      }
+    }
+
+    TestCheck(obj.TryGetObjectProperty("64") == nullptr);
+
+    // The index is dropped when the object shrinks below the threshold.
+    while (!expected.empty()) {
+      auto name = std::prev(expected.end())->first;
+      expected.erase(name);
+      TestCheckEqual(1u, obj.erase(name));
+      for (auto const &property : expected) {
+        TestCheck(obj.find(property.first) != obj.end());
+      }
+    }
+
+    TestCheck(obj.empty());
+  }
+
+  TEST_METHOD(TestMoveAndCopy) {
+    JSValueFlatObject small{{"a", 1}, {"b", JSValueObject{{"c", 2}}}};
+    JSValueFlatObject large;
+    for (int i = 0; i < 40; ++i) {
+      large[std::to_string(i)] = JSValueArray{i, "item"};
+    }
+
+    JSValueFlatObject smallCopy = small.Copy();
+    JSValueFlatObject largeCopy = large.Copy();
+    TestCheck(smallCopy == small);
+    TestCheck(largeCopy == large);
+
+    JSValueFlatObject movedSmall = std::move(small);
+    JSValueFlatObject movedLarge = std::move(large);
+    TestCheck(small.empty());
+    TestCheck(large.empty());
+    TestCheck(movedSmall == smallCopy);
+    TestCheck(movedLarge == largeCopy);
+    TestCheckEqual(39, movedLarge["39"][0].AsInt32());
+
+    movedSmall = std::move(movedLarge);
+    TestCheck(movedSmall == largeCopy);
+    movedSmall["new"] = 1;
+    TestCheck(movedSmall != largeCopy);
+  }
+
+  TEST_METHOD(TestConvertToAndFromJSValueObject) {
+    JSValueObject mapObj{{"style", JSValueObject{{"flex", 1}}}, {"testID", "view"}, {"nativeID", 5}};
+    JSValueFlatObject flatObj{mapObj.Copy()};
+
+    TestCheckEqual(3u, flatObj.size());
+    TestCheckEqual(1, flatObj["style"]["flex"].AsInt32());
+
+    JSValueObject roundTrip = flatObj.MoveToObject();
+    TestCheck(flatObj.empty());
+    TestCheck(roundTrip == mapObj);
+  }
+
+  TEST_METHOD(TestEqualsAndJSEquals) {
+    JSValueFlatObject obj1{{"a", 1}, {"b", "2"}};
+    JSValueFlatObject obj2{{"b", "2"}, {"a", 1}};
+    JSValueFlatObject obj3{{"a", "1"}, {"b", 2}};
+
+    TestCheck(obj1.Equals(obj2));
+    TestCheck(!obj1.Equals(obj3));
+    TestCheck(obj1.JSEquals(obj3));
+  }
+
+  TEST_METHOD(TestReadFromAndWriteTo) {
+    JSValue value = JSValueObject{{"left", 10}, {"top", 20}, {"transform", JSValueArray{JSValueObject{{"scale", 2}}}}};
+    JSValueFlatObject obj = JSValueFlatObject::ReadFrom(MakeJSValueTreeReader(value));
+
+    TestCheckEqual(3u, obj.size());
+    TestCheckEqual(2, obj["transform"][0]["scale"].AsInt32());
+
+    IJSValueWriter writer = MakeJSValueTreeWriter();
+    obj.WriteTo(writer);
+    TestCheck(TakeJSValue(writer) == value);
+  }
+};
+
+} // namespace winrt::Microsoft::ReactNative
@@ -0,0 +1,207 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <cmath>
+#include "JSValueJson.h"
+#include "JSValueTreeWriter.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+namespace {
+
+JSValue ParseJson(std::string_view json) noexcept {
+  JSValue value;
+  JSValueJsonError error;
+  TestCheck(TryParseJson(json, value, &error));
+  return value;
+}
+
+JSValueJsonError GetParseError(std::string_view json) noexcept {
+  JSValue value;
+  JSValueJsonError error;
+  TestCheck(!TryParseJson(json, value, &error));
+  return error;
+}
+
+} // namespace
+
+TEST_CLASS (JSValueJsonTest) {
+  TEST_METHOD(TestParsePrimitives) {
+    TestCheck(ParseJson("null").IsNull());
+    TestCheckEqual(true, ParseJson("true").AsBoolean());
+    TestCheckEqual(false, ParseJson(" false ").AsBoolean());
+    TestCheckEqual(42, *ParseJson("42").TryGetInt64());
+    TestCheckEqual(-7, *ParseJson("-7").TryGetInt64());
+    TestCheckEqual(2.5, *ParseJson("2.5").TryGetDouble());
+    TestCheckEqual(-1.25e-3, *ParseJson("-1.25E-3").TryGetDouble());
+    TestCheckEqual(1e20, *ParseJson("1e20").TryGetDouble());
+    TestCheckEqual("Hello", *ParseJson("\"Hello\"").TryGetString());
+  }
+
+  TEST_METHOD(TestParseIntegerLimits) {
+    TestCheckEqual(std::numeric_limits<int64_t>::max(), *ParseJson("9223372036854775807").TryGetInt64());
+    TestCheckEqual(std::numeric_limits<int64_t>::min(), *ParseJson("-9223372036854775808").TryGetInt64());
+    TestCheckEqual(9223372036854775808.0, *ParseJson("9223372036854775808").TryGetDouble());
+
+    // JSON.parse keeps the sign of -0.
+    JSValue negativeZero = ParseJson("-0");
+    TestCheck(negativeZero.Type() == JSValueType::Double);
+    TestCheck(std::signbit(negativeZero.AsDouble()));
+    TestCheck(std::isinf(*ParseJson("1e400").TryGetDouble()));
+    TestCheckEqual(0.0, *ParseJson("1e-400").TryGetDouble());
+  }
+
+  TEST_METHOD(TestParseContainers) {
+    JSValue value = ParseJson(R"JSON( { "a" : [ 1 , 2.5 , "x" , [ ] , { } ] , "b" : { "c" : null } } )JSON");
+    JSValue expected = JSValueObject{
+        {"a", JSValueArray{1, 2.5, "x", JSValueArray{}, JSValueObject{}}}, {"b", JSValueObject{{"c", nullptr}}}};
+    TestCheck(value == expected);
+  }
+
+  TEST_METHOD(TestParseIndentedJson) {
+    JSValue value = ParseJson(
+        "{\n"
+        "                \"items\": [\n"
+        "                                1,\n"
+        "\t\t\t\t2\r\n"
+        "    ]\n"
+        "}\n");
+    JSValue expected = JSValueObject{{"items", JSValueArray{1, 2}}};
+    TestCheck(value == expected);
+  }
+
+  TEST_METHOD(TestParseDuplicatePropertyKeepsLastValue) {
+    JSValue value = ParseJson(R"JSON({"a": 1, "b": 2, "a": [3]})JSON");
+    JSValue expected = JSValueObject{{"a", JSValueArray{3}}, {"b", 2}};
+    TestCheck(value == expected);
+  }
+
+  TEST_METHOD(TestParseEscapes) {
+    TestCheckEqual("\"\\/\b\f\n\r\t", *ParseJson(R"JSON("\"\\\/\b\f\n\r\t")JSON").TryGetString());
+    TestCheckEqual("A\xC3\xA9\xE2\x82\xAC", *ParseJson(R"JSON("A\u00e9\u20AC")JSON").TryGetString());
+    TestCheckEqual("\xF0\x9F\x98\x80", *ParseJson(R"JSON("\ud83d\uDE00")JSON").TryGetString());
+
+    // Lone surrogates cannot be represented in UTF-8.
+    TestCheckEqual("\xEF\xBF\xBDx", *ParseJson(R"JSON("\ud83dx")JSON").TryGetString());
+    TestCheckEqual("\xEF\xBF\xBD", *ParseJson(R"JSON("\ude00")JSON").TryGetString());
+
+    // Escapes in a long string with runs longer than one scanned block.
+    std::string longText(100, 'a');
+    JSValue value = ParseJson("\"" + longText + "\\n" + longText + "\\u0000" + longText + "\"");
+    TestCheckEqual(longText + "\n" + longText + std::string(1, '\0') + longText, *value.TryGetString());
+  }
+
+  TEST_METHOD(TestParseUtf8) {
+    std::string text = "\xC3\xA9l\xC3\xA9ment \xE2\x82\xAC \xF0\x9F\x98\x80 and some ASCII text after it";
+    TestCheckEqual(text, *ParseJson("\"" + text + "\"").TryGetString());
+  }
+
+  TEST_METHOD(TestParseErrors) {
+    TestCheckEqual(0u, GetParseError("").Offset);
+    TestCheckEqual(1u, GetParseError("[").Offset);
+    TestCheckEqual(3u, GetParseError("[1 2]").Offset);
+    TestCheckEqual(3u, GetParseError("[1,]").Offset);
+    TestCheckEqual(7u, GetParseError("{\"a\":1,}").Offset);
+    TestCheckEqual(5u, GetParseError("{\"a\" 1}").Offset);
+    TestCheckEqual(2u, GetParseError("[1}").Offset);
+    TestCheckEqual(1u, GetParseError("01").Offset);
+    TestCheckEqual(2u, GetParseError("1 2").Offset);
+    TestCheckEqual(0u, GetParseError("tru").Offset);
+    TestCheckEqual(0u, GetParseError("+1").Offset);
+    TestCheckEqual(2u, GetParseError("1.").Offset);
+    TestCheckEqual(2u, GetParseError("1e").Offset);
+    TestCheckEqual(4u, GetParseError("\"abc").Offset);
+    TestCheckEqual(2u, GetParseError("\"a\\x\"").Offset);
+    TestCheckEqual(2u, GetParseError("\"a\\u12\"").Offset);
+    TestCheckEqual(2u, GetParseError("\"a\nb\"").Offset);
+    TestCheckEqual(std::string_view{"Unexpected character"}, std::string_view{GetParseError("[1,]").Message});
+  }
+
+  TEST_METHOD(TestParseInvalidUtf8) {
+    // Continuation byte without a lead byte, overlong encoding, surrogate, code point above U+10FFFF, truncated.
+    for (std::string_view json :
+         {"\"\x80\"", "\"\xC0\xAF\"", "\"\xED\xA0\x80\"", "\"\xF4\x90\x80\x80\"", "\"\xE2\x82\""}) {
+      JSValueJsonError error = GetParseError(json);
+      TestCheckEqual(1u, error.Offset);
+      TestCheckEqual(std::string_view{"Invalid UTF-8 sequence"}, std::string_view{error.Message});
+    }
+  }
+
+  TEST_METHOD(TestParseNestingLimit) {
+    std::string deepJson = std::string(100, '[') + std::string(100, ']');
+    TestCheck(ParseJson(deepJson).TryGetArray() != nullptr);
+
+    std::string tooDeepJson = std::string(100000, '[') + std::string(100000, ']');
+    TestCheckEqual(std::string_view{"JSON nesting is too deep"}, std::string_view{GetParseError(tooDeepJson).Message});
+  }
+
+  TEST_METHOD(TestParseInPlace) {
+    std::string json = R"JSON({"a\tb": "x\u00e9\ny", "plain": "text"})JSON";
+    JSValue value;
+    TestCheck(TryParseJsonInPlace(json, value));
+    JSValue expected = JSValueObject{{"a\tb", "x\xC3\xA9\ny"}, {"plain", "text"}};
+    TestCheck(value == expected);
+  }
+
+  TEST_METHOD(TestParseToWriter) {
+    IJSValueWriter writer = MakeJSValueTreeWriter();
+    TestCheck(TryParseJson(R"JSON({"a": [1, true, "\u00e9"], "b": -2.5})JSON", writer));
+    JSValue expected = JSValueObject{{"a", JSValueArray{1, true, "\xC3\xA9"}}, {"b", -2.5}};
+    TestCheck(TakeJSValue(writer) == expected);
+  }
+
+  TEST_METHOD(TestWriteJson) {
+    JSValue value = JSValueObject{
+        {"array", JSValueArray{1, -2.5, true, nullptr, JSValueObject{}, JSValueArray{}}},
+        {"escaped", "\"\\\b\f\n\r\t\x01/"},
+        {"text", "\xC3\xA9l\xC3\xA9ment"}};
+    TestCheckEqual(
+        R"JSON({"array":[1,-2.5,true,null,{},[]],"escaped":"\"\\\b\f\n\r\t\u0001/","text":")JSON"
+        "\xC3\xA9l\xC3\xA9ment\"}",
+        ToJson(value));
+  }
+
+  TEST_METHOD(TestWriteJsonDouble) {
+    TestCheckEqual("0.1", ToJson(0.1));
+    TestCheckEqual("1e+300", ToJson(1e300));
+    TestCheckEqual("null", ToJson(std::numeric_limits<double>::quiet_NaN()));
+    TestCheckEqual("null", ToJson(std::numeric_limits<double>::infinity()));
+    TestCheckEqual("-9223372036854775808", ToJson(std::numeric_limits<int64_t>::min()));
+  }
+
+  TEST_METHOD(TestRoundTrip) {
+    std::string longText(50, 'x');
+    JSValue value = JSValueObject{
+        {"long", longText + "\"" + longText + "\n" + longText},
+        {"nested", JSValueArray{JSValueObject{{"x", 0.30000000000000004}}, std::numeric_limits<int64_t>::max()}},
+        {"unicode", "\xF0\x9F\x98\x80"}};
+    TestCheck(ParseJson(ToJson(value)) == value);
+
+    std::string json;
+    WriteJson(json, value);
+    TestCheckEqual(ToJson(value), json);
+  }
+
+  TEST_METHOD(TestJsonWriter) {
+    IJSValueWriter writer = MakeJSValueJsonWriter();
+    writer.WriteObjectBegin();
+    writer.WritePropertyName(L"items");
+    writer.WriteArrayBegin();
+    writer.WriteInt64(1);
+    writer.WriteDouble(2.5);
+    writer.WriteString(L"é\"");
+    writer.WriteObjectBegin();
+    writer.WriteObjectEnd();
+    writer.WriteArrayEnd();
+    writer.WritePropertyName(L"ok");
+    writer.WriteBoolean(true);
+    writer.WritePropertyName(L"none");
+    writer.WriteNull();
+    writer.WriteObjectEnd();
+
+    TestCheckEqual("{\"items\":[1,2.5,\"\xC3\xA9\\\"\",{}],\"ok\":true,\"none\":null}", TakeJson(writer));
+  }
+};
+
+} // namespace winrt::Microsoft::ReactNative
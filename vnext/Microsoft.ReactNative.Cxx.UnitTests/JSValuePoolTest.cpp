@@ -0,0 +1,106 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <thread>
+#include "JSValue.h"
+#include "JSValueTreeReader.h"
+#include "JsonJSValueReader.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+namespace {
+
+JSValue MakeProps(int64_t tag) noexcept {
+  return JSValueObject{
+      {"flex", 1},
+      {"nativeID", "item"},
+      {"style", JSValueObject{{"width", 100}, {"height", 50}}},
+      {"transform", JSValueArray{tag, 2, 3}}};
+}
+
+// Enables the pool for a test and restores the default state.
+struct JSValuePoolTestScope {
+  JSValuePoolTestScope() noexcept {
+    JSValuePool::Trim();
+    JSValuePool::SetEnabled(true);
+  }
+
+  ~JSValuePoolTestScope() noexcept {
+    JSValuePool::SetEnabled(false);
+  }
+};
+
+} // namespace
+
+TEST_CLASS (JSValuePoolTest) {
+  TEST_METHOD(TestPoolIsDisabledByDefault) {
+    TestCheck(!JSValuePool::IsEnabled());
+    { JSValue value = MakeProps(1); }
+    TestCheckEqual(0u, JSValuePool::GetPooledPropertyCount());
+    TestCheckEqual(0u, JSValuePool::GetPooledArrayCount());
+  }
+
+  TEST_METHOD(TestRecycleAndReuse) {
+    JSValuePoolTestScope scope;
+    { JSValue value = MakeProps(1); }
+    TestCheckEqual(6u, JSValuePool::GetPooledPropertyCount());
+    TestCheckEqual(1u, JSValuePool::GetPooledArrayCount());
+
+    JSValue source = MakeProps(2);
+    JSValue value = JSValue::ReadFrom(MakeJSValueTreeReader(source));
+    TestCheck(value == source);
+    TestCheckEqual(0u, JSValuePool::GetPooledPropertyCount());
+    TestCheckEqual(0u, JSValuePool::GetPooledArrayCount());
+
+    JSValuePool::Trim();
+    TestCheckEqual(0u, JSValuePool::GetPooledPropertyCount());
+  }
+
+  TEST_METHOD(TestDuplicatePropertiesKeepFirstValue) {
+    JSValuePoolTestScope scope;
+    { JSValue value = JSValueObject{{"a", 1}, {"b", 2}}; }
+
+    IJSValueReader reader = make<JsonJSValueReader>(LR"JSON([{"a": 1, "a": 2}])JSON");
+    JSValue value = JSValue::ReadFrom(reader);
+    TestCheckEqual(1u, value.ItemCount());
+    TestCheckEqual(1u, value[0].PropertyCount());
+    TestCheckEqual(1, value[0]["a"].AsInt32());
+    TestCheckEqual(1u, JSValuePool::GetPooledPropertyCount());
+  }
+
+  TEST_METHOD(TestValuesDestroyedOnAnotherThread) {
+    JSValuePoolTestScope scope;
+    JSValue value = MakeProps(1);
+    std::thread thread{[value = std::move(value)]() mutable { value = nullptr; }};
+    thread.join();
+
+    // The cache of the exited thread is given to the shared pool.
+    TestCheckEqual(6u, JSValuePool::GetPooledPropertyCount());
+    TestCheckEqual(1u, JSValuePool::GetPooledArrayCount());
+  }
+
+  TEST_METHOD(TestSharedPoolChunks) {
+    JSValuePoolTestScope scope;
+    std::thread thread{[]() {
+      for (int i = 0; i < 200; ++i) {
+        JSValue value = MakeProps(i);
+      }
+
+      // Properties above two chunks are given to the shared pool while the thread runs.
+      TestCheckEqual(1200u, JSValuePool::GetPooledPropertyCount());
+    }};
+    thread.join();
+
+    JSValue source = MakeProps(1);
+    for (int i = 0; i < 200; ++i) {
+      JSValue value = JSValue::ReadFrom(MakeJSValueTreeReader(source));
+      TestCheck(value == source);
+      value = nullptr;
+    }
+
+    TestCheckEqual(1200u, JSValuePool::GetPooledPropertyCount());
+  }
+};
+
+} // namespace winrt::Microsoft::ReactNative
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "pch.h"
+#include "JSValueArrayBuffer.h"
 #include "JSValueReader.h"
 #include <variant>
 #include "JSValueWriter.h"
@@ -478,6 +479,19 @@ TEST_CLASS (JSValueReaderTest) {
     TestCheck(jsValue["NullValue"] == nullptr);
     TestCheck(jsValue["NullValue"] == JSValue::Null);
   }
+
+  TEST_METHOD(TestArrayBufferAsArrayOfNumbers) {
+    // The tree reader and writer do not support binary data. It is passed as an array of numbers.
+    auto writer = MakeJSValueTreeWriter();
+    WriteValue(writer, JSValueArrayBuffer{{0, 1, 255}});
+    JSValue jsValue = TakeJSValue(writer);
+    JSValue expected = JSValueArray{0, 1, 255};
+    TestCheck(jsValue == expected);
+
+    auto arrayBuffer = ReadValue<JSValueArrayBuffer>(MakeJSValueTreeReader(std::move(jsValue)));
+    std::vector<uint8_t> expectedBytes{0, 1, 255};
+    TestCheck(arrayBuffer.Bytes == expectedBytes);
+  }
 };
 
 } // namespace winrt::Microsoft::ReactNative
@@ -0,0 +1,159 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "JSValueReader.h"
+#include "JSValueTreeReader.h"
+#include "JSValueTreeWriter.h"
+#include "JSValueWriter.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+REACT_STRUCT(StructInfoTestPoint)
+struct StructInfoTestPoint {
+  REACT_FIELD(X)
+  int X{0};
+
+  REACT_FIELD(Y)
+  int Y{0};
+};
+
+REACT_STRUCT(StructInfoTestShape)
+struct StructInfoTestShape {
+  REACT_FIELD(Name, L"name")
+  std::string Name;
+
+  REACT_FIELD(Origin, L"origin")
+  StructInfoTestPoint Origin;
+
+  REACT_FIELD(Points, L"points")
+  std::vector<StructInfoTestPoint> Points;
+
+  REACT_FIELD(IsVisible, L"isVisible")
+  bool IsVisible{false};
+};
+
+REACT_STRUCT(StructInfoTestEmpty)
+struct StructInfoTestEmpty {};
+
+constexpr const wchar_t *StructInfoTestWidthName = L"width";
+
+REACT_STRUCT(StructInfoTestSize)
+struct StructInfoTestSize {
+  REACT_FIELD(Width, StructInfoTestWidthName)
+  int Width{0};
+
+  REACT_FIELD(Height, std::wstring_view{L"height"})
+  int Height{0};
+};
+
+namespace {
+
+// Records the property names in the order they are written.
+struct PropertyNameWriter : implements<PropertyNameWriter, IJSValueWriter> {
+  void WriteNull() noexcept {}
+  void WriteBoolean(bool) noexcept {}
+  void WriteInt64(int64_t) noexcept {}
+  void WriteDouble(double) noexcept {}
+  void WriteString(const winrt::hstring &) noexcept {}
+  void WriteObjectBegin() noexcept {}
+  void WriteObjectEnd() noexcept {}
+  void WriteArrayBegin() noexcept {}
+  void WriteArrayEnd() noexcept {}
+
+  void WritePropertyName(const winrt::hstring &name) noexcept {
+    m_names.emplace_back(name);
+  }
+
+  std::vector<std::wstring> m_names;
+};
+
+} // namespace
+
+static_assert(HasStructFieldTable<StructInfoTestShape>);
+static_assert(StructFieldTable<StructInfoTestShape>::FieldCount == 4);
+static_assert(StructFieldTable<StructInfoTestEmpty>::FieldCount == 0);
+
+TEST_CLASS (StructInfoTest) {
+  TEST_METHOD(TestFindField) {
+    using Table = StructFieldTable<StructInfoTestShape>;
+    TestCheckEqual(0u, Table::FindField(L"name"));
+    TestCheckEqual(1u, Table::FindField(L"origin"));
+    TestCheckEqual(2u, Table::FindField(L"points"));
+    TestCheckEqual(3u, Table::FindField(L"isVisible"));
+
+    // The JavaScript names are used instead of the C++ field names.
+    TestCheck(Table::FindField(L"Name") == Table::NotFound);
+    TestCheck(Table::FindField(L"") == Table::NotFound);
+    TestCheck(StructFieldTable<StructInfoTestEmpty>::FindField(L"name") == Table::NotFound);
+  }
+
+  TEST_METHOD(TestReadStruct) {
+    JSValue jsValue = JSValueObject{
+        {"unknown", JSValueObject{{"x", JSValueArray{1, 2}}}},
+        {"points", JSValueArray{JSValueObject{{"X", 1}, {"Y", 2}}, JSValueObject{{"Y", 4}}}},
+        {"name", "Triangle"},
+        {"origin", JSValueObject{{"X", -1}, {"Z", 5}, {"Y", -2}}},
+        {"isVisible", true}};
+    auto shape = ReadValue<StructInfoTestShape>(MakeJSValueTreeReader(std::move(jsValue)));
+
+    TestCheckEqual("Triangle", shape.Name);
+    TestCheckEqual(-1, shape.Origin.X);
+    TestCheckEqual(-2, shape.Origin.Y);
+    TestCheckEqual(2u, shape.Points.size());
+    TestCheckEqual(2, shape.Points[0].Y);
+    TestCheckEqual(0, shape.Points[1].X);
+    TestCheckEqual(4, shape.Points[1].Y);
+    TestCheck(shape.IsVisible);
+  }
+
+  TEST_METHOD(TestWriteStruct) {
+    StructInfoTestShape shape;
+    shape.Name = "Line";
+    shape.Origin = {3, 4};
+    shape.Points = {{1, 2}};
+
+    auto writer = MakeJSValueTreeWriter();
+    WriteValue(writer, shape);
+    JSValue expected = JSValueObject{
+        {"name", "Line"},
+        {"origin", JSValueObject{{"X", 3}, {"Y", 4}}},
+        {"points", JSValueArray{JSValueObject{{"X", 1}, {"Y", 2}}}},
+        {"isVisible", false}};
+    TestCheck(TakeJSValue(writer) == expected);
+  }
+
+  TEST_METHOD(TestWriteStructInNameOrder) {
+    // The fields are written in the FieldMap order, and not in the declaration order.
+    IJSValueWriter writer = make<PropertyNameWriter>();
+    WriteValue(writer, StructInfoTestShape{});
+    auto &names = get_self<PropertyNameWriter>(writer)->m_names;
+    TestCheckEqual(6u, names.size());
+    TestCheckEqual(L"isVisible", names[0]);
+    TestCheckEqual(L"name", names[1]);
+    TestCheckEqual(L"origin", names[2]);
+    TestCheckEqual(L"X", names[3]);
+    TestCheckEqual(L"Y", names[4]);
+    TestCheckEqual(L"points", names[5]);
+  }
+
+  TEST_METHOD(TestNonLiteralFieldNames) {
+    auto size = ReadValue<StructInfoTestSize>(MakeJSValueTreeReader(JSValueObject{{"width", 3}, {"height", 4}}));
+    TestCheckEqual(3, size.Width);
+    TestCheckEqual(4, size.Height);
+
+    auto writer = MakeJSValueTreeWriter();
+    WriteValue(writer, size);
+    JSValue expected = JSValueObject{{"width", 3}, {"height", 4}};
+    TestCheck(TakeJSValue(writer) == expected);
+  }
+
+  TEST_METHOD(TestFieldMapForReactStruct) {
+    // The FieldMap is still available for the code that enumerates the struct fields at run time.
+    const auto &fieldMap = StructInfo<StructInfoTestShape>::FieldMap;
+    TestCheckEqual(4u, fieldMap.size());
+    TestCheck(fieldMap.find(std::wstring_view{L"origin"}) != fieldMap.end());
+  }
+};
+
+} // namespace winrt::Microsoft::ReactNative
@@ -6,8 +6,12 @@
 
 #include "pch.h"
 #include "JSValue.h"
+#include "JSValueBinary.h"
+#include <atomic>
 #include <cctype>
 #include <iomanip>
+#include <iterator>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string_view>
@@ -241,6 +245,198 @@ struct JSValueLogWriter {
 
 } // namespace
 
+//===========================================================================
+// JSValuePool implementation
+//===========================================================================
+
+namespace {
+
+using JSValueNode = JSValueObject::node_type;
+
+std::atomic<bool> s_isPoolEnabled{false};
+
+struct JSValueSharedPool {
+  std::mutex Mutex;
+  std::vector<std::vector<JSValueNode>> NodeChunks;
+  std::vector<std::vector<JSValueArray>> ArrayChunks;
+};
+
+JSValueSharedPool &GetSharedPool() noexcept {
+  // It is never destroyed because thread caches may return memory to it during the process shutdown.
+  static JSValueSharedPool *s_pool = new JSValueSharedPool();
+  return *s_pool;
+}
+
+template <class T>
+std::vector<std::vector<T>> &GetSharedChunks(JSValueSharedPool &pool) noexcept {
+  if constexpr (std::is_same_v<T, JSValueNode>) {
+    return pool.NodeChunks;
+  } else {
+    return pool.ArrayChunks;
+  }
+}
+
+struct JSValueThreadCache {
+  ~JSValueThreadCache() noexcept;
+
+  std::vector<JSValueNode> Nodes;
+  std::vector<JSValueArray> Arrays;
+};
+
+thread_local JSValueThreadCache t_cache;
+
+// A trivially destructible flag stays valid after t_cache is destroyed at the thread exit.
+thread_local bool t_isCacheDestroyed{false};
+
+template <class T>
+std::vector<T> &GetCachedItems(JSValueThreadCache &cache) noexcept {
+  if constexpr (std::is_same_v<T, JSValueNode>) {
+    return cache.Nodes;
+  } else {
+    return cache.Arrays;
+  }
+}
+
+template <class T>
+void GiveChunkToSharedPool(std::vector<T> &&chunk) noexcept {
+  auto &pool = GetSharedPool();
+  std::scoped_lock lock{pool.Mutex};
+  auto &chunks = GetSharedChunks<T>(pool);
+  if (chunks.size() < JSValuePool::MaxChunkCount) {
+    chunks.push_back(std::move(chunk));
+  }
+}
+
+template <class T>
+bool TakeFromPool(T &item) noexcept {
+  if (t_isCacheDestroyed) {
+    return false;
+  }
+
+  auto &items = GetCachedItems<T>(t_cache);
+  if (items.empty()) {
+    auto &pool = GetSharedPool();
+    std::scoped_lock lock{pool.Mutex};
+    auto &chunks = GetSharedChunks<T>(pool);
+    if (chunks.empty()) {
+      return false;
+    }
+
+    items = std::move(chunks.back());
+    chunks.pop_back();
+  }
+
+  item = std::move(items.back());
+  items.pop_back();
+  return true;
+}
+
+template <class T>
+void GiveToPool(T &&item) noexcept {
+  if (t_isCacheDestroyed) {
+    return;
+  }
+
+  auto &items = GetCachedItems<T>(t_cache);
+  if (items.size() >= 2 * JSValuePool::ChunkSize) {
+    // Keep one chunk for the reuse on this thread and give the other chunk to the threads that build values.
+    std::vector<T> chunk;
+    chunk.reserve(JSValuePool::ChunkSize);
+    std::move(items.end() - JSValuePool::ChunkSize, items.end(), std::back_inserter(chunk));
+    items.erase(items.end() - JSValuePool::ChunkSize, items.end());
+    GiveChunkToSharedPool(std::move(chunk));
+  }
+
+  items.push_back(std::move(item));
+}
+
+JSValueThreadCache::~JSValueThreadCache() noexcept {
+  // Values destroyed by other thread_local destructors after this point are not recycled.
+  t_isCacheDestroyed = true;
+  if (JSValuePool::IsEnabled()) {
+    if (!Nodes.empty()) {
+      GiveChunkToSharedPool(std::move(Nodes));
+    }
+
+    if (!Arrays.empty()) {
+      GiveChunkToSharedPool(std::move(Arrays));
+    }
+  }
+}
+
+// Give the property node to the pool. Nested values are recycled by their destructors.
+void RecycleNode(JSValueNode &&node) noexcept {
+  node.mapped() = JSValue{};
+  node.key().clear();
+  GiveToPool(std::move(node));
+}
+
+// Give the property nodes to the pool. Each extract rebalances the tree, so it costs more than freeing the nodes.
+void RecycleObject(JSValueObject &object) noexcept {
+  while (!object.empty()) {
+    RecycleNode(object.extract(object.begin()));
+  }
+}
+
+// Give the array buffer to the pool. Nested values are recycled by their destructors.
+void RecycleArray(JSValueArray &array) noexcept {
+  if (array.capacity() != 0 && array.capacity() <= JSValuePool::MaxArrayCapacity) {
+    array.clear();
+    GiveToPool(std::move(array));
+  }
+}
+
+} // namespace
+
+/*static*/ void JSValuePool::SetEnabled(bool isEnabled) noexcept {
+  s_isPoolEnabled.store(isEnabled, std::memory_order_relaxed);
+  if (!isEnabled) {
+    Trim();
+  }
+}
+
+/*static*/ bool JSValuePool::IsEnabled() noexcept {
+  return s_isPoolEnabled.load(std::memory_order_relaxed);
+}
+
+/*static*/ void JSValuePool::Trim() noexcept {
+  std::vector<std::vector<JSValueNode>> nodeChunks;
+  std::vector<std::vector<JSValueArray>> arrayChunks;
+  {
+    auto &pool = GetSharedPool();
+    std::scoped_lock lock{pool.Mutex};
+    nodeChunks = std::move(pool.NodeChunks);
+    arrayChunks = std::move(pool.ArrayChunks);
+  }
+
+  if (!t_isCacheDestroyed) {
+    std::vector<JSValueNode>{}.swap(t_cache.Nodes);
+    std::vector<JSValueArray>{}.swap(t_cache.Arrays);
+  }
+}
+
+/*static*/ size_t JSValuePool::GetPooledPropertyCount() noexcept {
+  size_t count = t_isCacheDestroyed ? 0 : t_cache.Nodes.size();
+  auto &pool = GetSharedPool();
+  std::scoped_lock lock{pool.Mutex};
+  for (auto const &chunk : pool.NodeChunks) {
+    count += chunk.size();
+  }
+
+  return count;
+}
+
+/*static*/ size_t JSValuePool::GetPooledArrayCount() noexcept {
+  size_t count = t_isCacheDestroyed ? 0 : t_cache.Arrays.size();
+  auto &pool = GetSharedPool();
+  std::scoped_lock lock{pool.Mutex};
+  for (auto const &chunk : pool.ArrayChunks) {
+    count += chunk.size();
+  }
+
+  return count;
+}
+
 //===========================================================================
 // JSValueObject implementation
 //===========================================================================
@@ -320,9 +516,43 @@ bool JSValueObject::JSEquals(JSValueObject const &other) const noexcept {
 /*static*/ JSValueObject JSValueObject::ReadFrom(IJSValueReader const &reader) noexcept {
   JSValueObject object;
   if (reader.ValueType() == JSValueType::Object) {
+    bool isPoolEnabled = JSValuePool::IsEnabled();
     hstring propertyName;
     while (reader.GetNextObjectProperty(/*ref*/ propertyName)) {
-      object.try_emplace(to_string(propertyName), JSValue::ReadFrom(reader));
+      JSValueNode node;
+      if (isPoolEnabled && TakeFromPool(node)) {
+        node.key() = to_string(propertyName);
+        node.mapped() = JSValue::ReadFrom(reader);
+        auto result = object.insert(std::move(node));
+        if (!result.inserted) {
+          RecycleNode(std::move(result.node));
+        }
+      } else {
+        object.try_emplace(to_string(propertyName), JSValue::ReadFrom(reader));
+      }
+    }
+  }
+
+  return object;
+}
+
+/*static*/ JSValueObject JSValueObject::ReadFrom(JSValueBinaryDecoder &decoder) noexcept {
+  JSValueObject object;
+  if (decoder.ValueType() == JSValueType::Object) {
+    bool isPoolEnabled = JSValuePool::IsEnabled();
+    std::string_view propertyName;
+    while (decoder.GetNextObjectProperty(/*ref*/ propertyName)) {
+      JSValueNode node;
+      if (isPoolEnabled && TakeFromPool(node)) {
+        node.key() = propertyName;
+        node.mapped() = JSValue::ReadFrom(decoder);
+        auto result = object.insert(std::move(node));
+        if (!result.inserted) {
+          RecycleNode(std::move(result.node));
+        }
+      } else {
+        object.try_emplace(std::string{propertyName}, JSValue::ReadFrom(decoder));
+      }
     }
   }
 
@@ -339,6 +569,16 @@ void JSValueObject::WriteTo(IJSValueWriter const &writer) const noexcept {
   writer.WriteObjectEnd();
 }
 
+void JSValueObject::WriteTo(JSValueBinaryEncoder &encoder) const noexcept {
+  encoder.WriteObjectBegin();
+  for (auto const &property : *this) {
+    encoder.WritePropertyName(property.first);
+    property.second.WriteTo(encoder);
+  }
+
+  encoder.WriteObjectEnd();
+}
+
 //===========================================================================
 // JSValueArray implementation
 //===========================================================================
@@ -408,6 +648,10 @@ bool JSValueArray::JSEquals(JSValueArray const &other) const noexcept {
 /*static*/ JSValueArray JSValueArray::ReadFrom(IJSValueReader const &reader) noexcept {
   JSValueArray array;
   if (reader.ValueType() == JSValueType::Array) {
+    if (JSValuePool::IsEnabled()) {
+      TakeFromPool(array);
+    }
+
     while (reader.GetNextArrayItem()) {
       array.push_back(JSValue::ReadFrom(reader));
     }
@@ -416,6 +660,21 @@ bool JSValueArray::JSEquals(JSValueArray const &other) const noexcept {
   return array;
 }
 
+/*static*/ JSValueArray JSValueArray::ReadFrom(JSValueBinaryDecoder &decoder) noexcept {
+  JSValueArray array;
+  if (decoder.ValueType() == JSValueType::Array) {
+    if (JSValuePool::IsEnabled()) {
+      TakeFromPool(array);
+    }
+
+    while (decoder.GetNextArrayItem()) {
+      array.push_back(JSValue::ReadFrom(decoder));
+    }
+  }
+
+  return array;
+}
+
 void JSValueArray::WriteTo(IJSValueWriter const &writer) const noexcept {
   writer.WriteArrayBegin();
   for (const JSValue &item : *this) {
@@ -425,6 +684,15 @@ void JSValueArray::WriteTo(IJSValueWriter const &writer) const noexcept {
   writer.WriteArrayEnd();
 }
 
+void JSValueArray::WriteTo(JSValueBinaryEncoder &encoder) const noexcept {
+  encoder.WriteArrayBegin();
+  for (const JSValue &item : *this) {
+    item.WriteTo(encoder);
+  }
+
+  encoder.WriteArrayEnd();
+}
+
 //===========================================================================
 // JSValue implementation
 //===========================================================================
@@ -465,9 +733,17 @@ JSValue::JSValue(JSValue &&other) noexcept : m_type{other.m_type} {
 JSValue::~JSValue() noexcept {
   switch (m_type) {
     case JSValueType::Object:
+      if (JSValuePool::IsEnabled()) {
+        RecycleObject(m_object);
+      }
+
       m_object.~JSValueObject();
       break;
     case JSValueType::Array:
+      if (JSValuePool::IsEnabled()) {
+        RecycleArray(m_array);
+      }
+
       m_array.~JSValueArray();
       break;
     case JSValueType::String:
@@ -825,6 +1101,27 @@ bool JSValue::JSEquals(JSValue const &other) const noexcept {
   }
 }
 
+/*static*/ JSValue JSValue::ReadFrom(JSValueBinaryDecoder &decoder) noexcept {
+  switch (decoder.ValueType()) {
+    case JSValueType::Null:
+      return JSValue();
+    case JSValueType::Object:
+      return JSValue(JSValueObject::ReadFrom(decoder));
+    case JSValueType::Array:
+      return JSValue(JSValueArray::ReadFrom(decoder));
+    case JSValueType::String:
+      return JSValue(std::string{decoder.GetString()});
+    case JSValueType::Boolean:
+      return JSValue(decoder.GetBoolean());
+    case JSValueType::Int64:
+      return JSValue(decoder.GetInt64());
+    case JSValueType::Double:
+      return JSValue(decoder.GetDouble());
+    default:
+      VerifyElseCrashSz(false, "Unexpected JSValue type");
+  }
+}
+
 void JSValue::WriteTo(IJSValueWriter const &writer) const noexcept {
   switch (m_type) {
     case JSValueType::Null:
@@ -846,4 +1143,78 @@ void JSValue::WriteTo(IJSValueWriter const &writer) const noexcept {
   }
 }
 
+void JSValue::WriteTo(JSValueBinaryEncoder &encoder) const noexcept {
+  switch (m_type) {
+    case JSValueType::Null:
+      return encoder.WriteNull();
+    case JSValueType::Object:
+      return m_object.WriteTo(encoder);
+    case JSValueType::Array:
+      return m_array.WriteTo(encoder);
+    case JSValueType::String:
+      return encoder.WriteString(m_string);
+    case JSValueType::Boolean:
+      return encoder.WriteBoolean(m_bool);
+    case JSValueType::Int64:
+      return encoder.WriteInt64(m_int64);
+    case JSValueType::Double:
+      return encoder.WriteDouble(m_double);
+    default:
+      VerifyElseCrashSz(false, "Unexpected JSValue type");
+  }
+}
+
+//===========================================================================
+// JSValue standalone functions
+//===========================================================================
+
+bool TryReadBinaryValue(IJSValueReader const &reader, JSValue &value) noexcept {
+  JSValueType valueType = reader.ValueType();
+  if (valueType != JSValueType::Object && valueType != JSValueType::Array) {
+    return false;
+  }
+
+  auto binaryReader = TryGetBinaryReader(reader);
+  if (!binaryReader) {
+    return false;
+  }
+
+  com_array<uint8_t> buffer = binaryReader.ReadBinaryValue();
+  JSValueBinaryDecoder decoder{buffer};
+  value = JSValue::ReadFrom(decoder);
+  return true;
+}
+
+namespace {
+
+template <class T>
+bool TryWriteBinaryContainer(IJSValueWriter const &writer, T const &value) noexcept {
+  auto binaryWriter = TryGetBinaryWriter(writer);
+  if (!binaryWriter) {
+    return false;
+  }
+
+  std::vector<uint8_t> buffer;
+  JSValueBinaryEncoder encoder{buffer};
+  value.WriteTo(encoder);
+  binaryWriter.WriteBinaryValue(buffer);
+  return true;
+}
+
+} // namespace
+
+bool TryWriteBinaryValue(IJSValueWriter const &writer, JSValue const &value) noexcept {
+  JSValueType valueType = value.Type();
+  return (valueType == JSValueType::Object || valueType == JSValueType::Array) &&
+      TryWriteBinaryContainer(writer, value);
+}
+
+bool TryWriteBinaryValue(IJSValueWriter const &writer, JSValueObject const &value) noexcept {
+  return TryWriteBinaryContainer(writer, value);
+}
+
+bool TryWriteBinaryValue(IJSValueWriter const &writer, JSValueArray const &value) noexcept {
+  return TryWriteBinaryContainer(writer, value);
+}
+
 } // namespace winrt::Microsoft::ReactNative
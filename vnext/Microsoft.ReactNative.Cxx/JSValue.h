@@ -20,6 +20,8 @@ namespace winrt::Microsoft::ReactNative {
 struct JSValue;
 struct JSValueObjectKeyValue;
 struct JSValueArrayItem;
+struct JSValueBinaryEncoder;
+struct JSValueBinaryDecoder;
 IJSValueReader MakeJSValueTreeReader(JSValue const &root) noexcept;
 IJSValueReader MakeJSValueTreeReader(JSValue &&root) noexcept;
 IJSValueWriter MakeJSValueTreeWriter() noexcept;
@@ -83,9 +85,15 @@ struct JSValueObject : std::map<std::string, JSValue, std::less<>> {
   //! Create JSValueObject from IJSValueReader.
   static JSValueObject ReadFrom(IJSValueReader const &reader) noexcept;
 
+  //! Create JSValueObject from a buffer in the binary encoding. See JSValueBinary.h.
+  static JSValueObject ReadFrom(JSValueBinaryDecoder &decoder) noexcept;
+
   //! Write this JSValueObject to IJSValueWriter.
   void WriteTo(IJSValueWriter const &writer) const noexcept;
 
+  //! Write this JSValueObject to a buffer in the binary encoding. See JSValueBinary.h.
+  void WriteTo(JSValueBinaryEncoder &encoder) const noexcept;
+
 #pragma region Deprecated methods
 
   [[deprecated("Use JSEquals")]] bool EqualsAfterConversion(JSValueObject const &other) const noexcept;
@@ -153,9 +161,15 @@ struct JSValueArray : std::vector<JSValue> {
   //! Create JSValueArray from IJSValueReader.
   static JSValueArray ReadFrom(IJSValueReader const &reader) noexcept;
 
+  //! Create JSValueArray from a buffer in the binary encoding. See JSValueBinary.h.
+  static JSValueArray ReadFrom(JSValueBinaryDecoder &decoder) noexcept;
+
   //! Write this JSValueArray to IJSValueWriter.
   void WriteTo(IJSValueWriter const &writer) const noexcept;
 
+  //! Write this JSValueArray to a buffer in the binary encoding. See JSValueBinary.h.
+  void WriteTo(JSValueBinaryEncoder &encoder) const noexcept;
+
 #pragma region Deprecated methods
 
   [[deprecated("Use JSEquals")]] bool EqualsAfterConversion(JSValueArray const &other) const noexcept;
@@ -169,6 +183,47 @@ bool operator==(JSValueArray const &left, JSValueArray const &right) noexcept;
 //! True if !left.Equals(right)
 bool operator!=(JSValueArray const &left, JSValueArray const &right) noexcept;
 
+//==============================================================================
+// JSValuePool declaration.
+//==============================================================================
+
+//! JSValuePool is an opt-in mode that recycles memory of JSValueObject properties and JSValueArray items.
+//! When it is enabled, destroyed JSValue objects and arrays give their property nodes and item buffers to the pool,
+//! and JSValue::ReadFrom, JSValueObject::ReadFrom and JSValueArray::ReadFrom reuse them to build new values.
+//! Each thread has a local cache that exchanges memory with the shared pool in chunks. It allows values
+//! that are created on one thread and destroyed on another thread, such as bridge call arguments,
+//! to avoid the heap allocator for each property.
+//! Extracting the property nodes makes destroying an object with the pool enabled slower than freeing it.
+//! The pool pays off when values are read on one thread and destroyed on another thread.
+//! The pool and its enabled flag are static data of JSValue.cpp. Each DLL or EXE that compiles JSValue.cpp,
+//! such as Microsoft.ReactNative.dll and each app or library with native modules, has its own pool that
+//! is enabled and trimmed separately. Values must be destroyed by the module that created them.
+struct JSValuePool {
+  //! Number of properties or arrays in a chunk exchanged between a thread cache and the shared pool.
+  static constexpr size_t ChunkSize = 256;
+
+  //! Maximum number of chunks kept by the shared pool. Extra memory is returned to the heap.
+  static constexpr size_t MaxChunkCount = 64;
+
+  //! Arrays with bigger capacity are not recycled.
+  static constexpr size_t MaxArrayCapacity = 64;
+
+  //! Enable or disable the pool. The pool is disabled by default.
+  static void SetEnabled(bool isEnabled) noexcept;
+
+  //! Return true if the pool is enabled.
+  static bool IsEnabled() noexcept;
+
+  //! Return memory kept by the shared pool and by the current thread cache to the heap.
+  static void Trim() noexcept;
+
+  //! Number of object properties kept by the shared pool and by the current thread cache.
+  static size_t GetPooledPropertyCount() noexcept;
+
+  //! Number of arrays kept by the shared pool and by the current thread cache.
+  static size_t GetPooledArrayCount() noexcept;
+};
+
 //==============================================================================
 // JSValue declaration.
 //==============================================================================
@@ -458,6 +513,9 @@ struct JSValue {
   //! Create JSValue from IJSValueReader.
   static JSValue ReadFrom(IJSValueReader const &reader) noexcept;
 
+  //! Create JSValue from a buffer in the binary encoding. See JSValueBinary.h.
+  static JSValue ReadFrom(JSValueBinaryDecoder &decoder) noexcept;
+
   //! Create JSValueObject from IJSValueReader.
   static JSValueObject ReadObjectFrom(IJSValueReader const &reader) noexcept;
 
@@ -467,6 +525,9 @@ struct JSValue {
   //! Write this JSValue to IJSValueWriter.
   void WriteTo(IJSValueWriter const &writer) const noexcept;
 
+  //! Write this JSValue to a buffer in the binary encoding. See JSValueBinary.h.
+  void WriteTo(JSValueBinaryEncoder &encoder) const noexcept;
+
 #pragma region Deprecated methods
 
   // The methods below are deprecated in favor of other methods with clearer semantic
@@ -515,6 +576,18 @@ bool operator==(JSValue const &left, JSValue const &right) noexcept;
 //! True if !left.Equals(right)
 bool operator!=(JSValue const &left, JSValue const &right) noexcept;
 
+//! Read the current object or array from the reader as one buffer in the binary encoding.
+//! It returns false without reading anything if the reader does not implement IJSValueBinaryReader
+//! or if the current value is not an object or array.
+bool TryReadBinaryValue(IJSValueReader const &reader, JSValue &value) noexcept;
+
+//! Write the object or array to the writer as one buffer in the binary encoding.
+//! It returns false without writing anything if the writer does not implement IJSValueBinaryWriter
+//! or if the value is not an object or array.
+bool TryWriteBinaryValue(IJSValueWriter const &writer, JSValue const &value) noexcept;
+bool TryWriteBinaryValue(IJSValueWriter const &writer, JSValueObject const &value) noexcept;
+bool TryWriteBinaryValue(IJSValueWriter const &writer, JSValueArray const &value) noexcept;
+
 //===========================================================================
 // Helper classes for JSValueObject and JSValueArray initialization lists.
 //===========================================================================
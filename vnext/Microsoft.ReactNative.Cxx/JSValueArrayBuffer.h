@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#ifndef MICROSOFT_REACTNATIVE_JSVALUEARRAYBUFFER
+#define MICROSOFT_REACTNATIVE_JSVALUEARRAYBUFFER
+
+#include <vector>
+#include "JSValueReader.h"
+#include "JSValueWriter.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+//==============================================================================
+// Binary data exchange with JavaScript.
+//==============================================================================
+//
+// Binary data is passed between JavaScript and native modules as ArrayBuffer, typed array or DataView values
+// when the IJSValueReader and IJSValueWriter support it, e.g. for TurboModules that run on top of JSI.
+// It avoids the base64 encoding and the extra copies of the string based transport.
+// Readers and writers without the support see the binary data as arrays of numbers.
+// This header is not shared with macOS: include it to use JSValueArrayBuffer in native module method signatures.
+
+//! Binary data that is read from an ArrayBuffer, a typed array or a DataView, and written as an ArrayBuffer.
+//! Use it instead of std::vector<uint8_t> in native module method signatures:
+//! std::vector<uint8_t> is always written as an array of numbers.
+struct JSValueArrayBuffer {
+  std::vector<uint8_t> Bytes;
+};
+
+//! IJsiByteBuffer that gives a view to bytes owned by the caller without copying them.
+struct JSValueByteBufferView : implements<JSValueByteBufferView, IJsiByteBuffer> {
+  JSValueByteBufferView(array_view<uint8_t const> bytes) noexcept : m_bytes{bytes} {}
+
+ public: // IJsiByteBuffer
+  uint32_t Size() noexcept {
+    return m_bytes.size();
+  }
+
+  void GetData(JsiByteArrayUser const &useBytes) noexcept {
+    useBytes(m_bytes);
+  }
+
+ private:
+  array_view<uint8_t const> m_bytes;
+};
+
+//! Call useBytes with the bytes of the current ArrayBuffer, typed array or DataView value without copying them.
+//! The bytes are only valid while useBytes is being called.
+//! It returns false without reading anything if the current value is not binary data
+//! or the reader does not implement IJSValueArrayBufferReader.
+inline bool TryReadArrayBuffer(IJSValueReader const &reader, JsiByteArrayUser const &useBytes) noexcept {
+  if (auto arrayBufferReader = reader.try_as<IJSValueArrayBufferReader>()) {
+    return arrayBufferReader.TryReadArrayBuffer(useBytes);
+  }
+
+  return false;
+}
+
+//! Write the bytes as an ArrayBuffer. The bytes are not copied before they reach the writer.
+//! If the writer does not implement IJSValueArrayBufferWriter, then the bytes are written as an array of numbers.
+inline void WriteArrayBuffer(IJSValueWriter const &writer, array_view<uint8_t const> bytes) noexcept {
+  if (auto arrayBufferWriter = writer.try_as<IJSValueArrayBufferWriter>()) {
+    arrayBufferWriter.WriteArrayBuffer(make<JSValueByteBufferView>(bytes));
+  } else {
+    writer.WriteArrayBegin();
+    for (uint8_t byte : bytes) {
+      writer.WriteInt64(byte);
+    }
+    writer.WriteArrayEnd();
+  }
+}
+
+inline void ReadValue(IJSValueReader const &reader, /*out*/ JSValueArrayBuffer &value) noexcept {
+  value.Bytes.clear();
+  auto copyBytes = [&value](array_view<uint8_t const> bytes) noexcept {
+    value.Bytes.assign(bytes.begin(), bytes.end());
+  };
+  if (!TryReadArrayBuffer(reader, copyBytes)) {
+    // Readers without the binary data support provide it as an array of numbers.
+    ReadValue(reader, /*out*/ value.Bytes);
+  }
+}
+
+inline void WriteValue(IJSValueWriter const &writer, JSValueArrayBuffer const &value) noexcept {
+  WriteArrayBuffer(writer, value.Bytes);
+}
+
+} // namespace winrt::Microsoft::ReactNative
+
+#endif // MICROSOFT_REACTNATIVE_JSVALUEARRAYBUFFER
@@ -0,0 +1,224 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// IMPORTANT: Before updating this file
+// please read react-native-windows repo:
+// vnext/Microsoft.ReactNative.Cxx/README.md
+
+#include "pch.h"
+#include "JSValueAtom.h"
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace winrt::Microsoft::ReactNative {
+
+namespace {
+
+constexpr uint64_t HashOffsetBasis = 14695981039346656037ull;
+constexpr uint64_t HashPrime = 1099511628211ull;
+
+uint64_t StartHash(uint64_t seed) noexcept {
+  return HashOffsetBasis ^ (seed * 0x9E3779B97F4A7C15ull);
+}
+
+size_t FinishHash(uint64_t hash) noexcept {
+  // Mix the high bits into the low bits used for the table slots.
+  hash ^= hash >> 32;
+  hash ^= hash >> 16;
+  return static_cast<size_t>(hash);
+}
+
+} // namespace
+
+//===========================================================================
+// JSValueAtomTable implementation
+//===========================================================================
+
+struct JSValueAtomTable {
+  static JSValueAtomTable &Instance() noexcept {
+    // It is never destroyed because atoms may be used during the process shutdown.
+    static JSValueAtomTable *s_instance = new JSValueAtomTable();
+    return *s_instance;
+  }
+
+  JSValueAtom Find(std::string_view name, size_t hash) noexcept {
+    std::shared_lock lock{m_mutex};
+    auto it = m_entries.find(NameKey{name, hash});
+    return it != m_entries.end() ? JSValueAtom{it->second.get()} : JSValueAtom{};
+  }
+
+  JSValueAtom Intern(std::string_view name, size_t hash) noexcept {
+    // Direct-mapped per-thread cache of the interned entries. The entries are never deleted,
+    // so the cached pointers stay valid and the lookup needs no lock.
+    constexpr size_t CacheSize = 256;
+    thread_local JSValueAtom::Entry const *t_cache[CacheSize]{};
+
+    auto &cachedEntry = t_cache[hash & (CacheSize - 1)];
+    if (cachedEntry && cachedEntry->Hash == hash && cachedEntry->Name == name) {
+      return JSValueAtom{cachedEntry};
+    }
+
+    JSValueAtom atom = Find(name, hash);
+    if (atom.IsEmpty()) {
+      std::unique_lock lock{m_mutex};
+      auto it = m_entries.find(NameKey{name, hash});
+      if (it == m_entries.end()) {
+        auto entry = std::make_unique<JSValueAtom::Entry>(JSValueAtom::Entry{std::string{name}, hash});
+
+        // The key points to the entry name because entries are never moved or deleted.
+        NameKey key{entry->Name, hash};
+        it = m_entries.emplace(key, std::move(entry)).first;
+      }
+
+      atom = JSValueAtom{it->second.get()};
+    }
+
+    cachedEntry = atom.m_entry;
+    return atom;
+  }
+
+  size_t GetCount() noexcept {
+    std::shared_lock lock{m_mutex};
+    return m_entries.size();
+  }
+
+ private:
+  // The name with its hash computed by the caller, so that the name is hashed only once.
+  struct NameKey {
+    std::string_view Name;
+    size_t Hash;
+
+    bool operator==(NameKey const &other) const noexcept {
+      return Name == other.Name;
+    }
+  };
+
+  struct NameKeyHash {
+    size_t operator()(NameKey const &key) const noexcept {
+      return key.Hash;
+    }
+  };
+
+ private:
+  std::shared_mutex m_mutex;
+  std::unordered_map<NameKey, std::unique_ptr<JSValueAtom::Entry>, NameKeyHash> m_entries;
+};
+
+//===========================================================================
+// JSValueAtom implementation
+//===========================================================================
+
+/*static*/ JSValueAtom JSValueAtom::Intern(std::string_view name) noexcept {
+  return name.empty() ? JSValueAtom{} : JSValueAtomTable::Instance().Intern(name, HashPropertyName(name));
+}
+
+/*static*/ JSValueAtom JSValueAtom::Intern(std::wstring_view name) noexcept {
+  if (name.empty()) {
+    return JSValueAtom{};
+  }
+
+  // Property names are almost always short ASCII strings.
+  // They are narrowed and hashed in one pass over the characters.
+  constexpr size_t MaxBufferSize = 64;
+  if (name.size() <= MaxBufferSize) {
+    char buffer[MaxBufferSize];
+    uint64_t hash = StartHash(0);
+    size_t i = 0;
+    for (; i < name.size() && name[i] < 0x80; ++i) {
+      buffer[i] = static_cast<char>(name[i]);
+      hash ^= static_cast<uint8_t>(buffer[i]);
+      hash *= HashPrime;
+    }
+
+    if (i == name.size()) {
+      return JSValueAtomTable::Instance().Intern(std::string_view{buffer, i}, FinishHash(hash));
+    }
+  }
+
+  return Intern(std::string_view{to_string(name)});
+}
+
+/*static*/ JSValueAtom JSValueAtom::TryFind(std::string_view name) noexcept {
+  return name.empty() ? JSValueAtom{} : JSValueAtomTable::Instance().Find(name, HashPropertyName(name));
+}
+
+/*static*/ size_t JSValueAtom::GetInternedCount() noexcept {
+  return JSValueAtomTable::Instance().GetCount();
+}
+
+bool GetNextObjectProperty(IJSValueReader const &reader, JSValueAtom &propertyName) noexcept {
+  hstring name;
+  if (!reader.GetNextObjectProperty(/*ref*/ name)) {
+    return false;
+  }
+
+  propertyName = JSValueAtom::Intern(std::wstring_view{name});
+  return true;
+}
+
+//===========================================================================
+// JSValuePropertyTable implementation
+//===========================================================================
+
+void JSValuePropertyTable::BuildSlots() noexcept {
+  VerifyElseCrashSz(m_names.size() < std::numeric_limits<uint16_t>::max(), "Too many property names");
+
+  // Duplicate names would never get separate slots.
+  std::vector<std::string_view> sortedNames{m_names.begin(), m_names.end()};
+  std::sort(sortedNames.begin(), sortedNames.end());
+  VerifyElseCrashSz(
+      std::adjacent_find(sortedNames.begin(), sortedNames.end()) == sortedNames.end(), "Duplicate property names");
+
+  if (m_names.empty()) {
+    return;
+  }
+
+  // Search for a seed that gives each name its own slot. Use more slots if it takes too many attempts.
+  constexpr uint64_t MaxSeedAttempts = 64;
+  size_t slotCount = 1;
+  while (slotCount < m_names.size() * 2) {
+    slotCount *= 2;
+  }
+
+  for (;; slotCount *= 2) {
+    for (uint64_t seed = 0; seed < MaxSeedAttempts; ++seed) {
+      m_slots.assign(slotCount, 0);
+      bool hasCollision = false;
+      for (size_t i = 0; i < m_names.size() && !hasCollision; ++i) {
+        auto &slot = m_slots[HashPropertyName(m_names[i], seed) & (slotCount - 1)];
+        hasCollision = slot != 0;
+        slot = static_cast<uint16_t>(i + 1);
+      }
+
+      if (!hasCollision) {
+        m_seed = seed;
+        return;
+      }
+    }
+  }
+}
+
+int JSValuePropertyTable::Find(std::string_view name) const noexcept {
+  if (m_slots.empty()) {
+    return -1;
+  }
+
+  uint16_t slot = m_slots[HashPropertyName(name, m_seed) & (m_slots.size() - 1)];
+  return (slot != 0 && m_names[slot - 1] == name) ? slot - 1 : -1;
+}
+
+size_t HashPropertyName(std::string_view name, uint64_t seed) noexcept {
+  // FNV-1a with a seed and a final mix.
+  uint64_t hash = StartHash(seed);
+  for (char ch : name) {
+    hash ^= static_cast<uint8_t>(ch);
+    hash *= HashPrime;
+  }
+
+  return FinishHash(hash);
+}
+
+} // namespace winrt::Microsoft::ReactNative
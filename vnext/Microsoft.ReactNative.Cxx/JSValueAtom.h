@@ -0,0 +1,174 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// IMPORTANT: Before updating this file
+// please read react-native-windows repo:
+// vnext/Microsoft.ReactNative.Cxx/README.md
+
+#pragma once
+#ifndef MICROSOFT_REACTNATIVE_JSVALUEATOM
+#define MICROSOFT_REACTNATIVE_JSVALUEATOM
+
+#include "JSValue.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+//==============================================================================
+// JSValueAtom declaration.
+//==============================================================================
+
+//! JSValueAtom is a handle to a property name interned in a process-wide table.
+//! Atoms for the same name are the same handle, so they are compared and hashed in O(1)
+//! without looking at the string characters.
+//! Each thread caches the atoms it has interned, so interning a name again takes no lock.
+//! Interned names are never released. Use atoms for property names that come from a
+//! bounded set, such as prop names and struct field names, and not for arbitrary data.
+//! The table is thread safe.
+struct JSValueAtom {
+  //! Create an atom for the empty name.
+  JSValueAtom() noexcept = default;
+
+  //! Get the atom for the name. The name is added to the table if it is not there yet.
+  static JSValueAtom Intern(std::string_view name) noexcept;
+
+  //! Get the atom for the UTF-16 name. ASCII names are converted without a memory allocation.
+  static JSValueAtom Intern(std::wstring_view name) noexcept;
+
+  //! Get the atom for the name if the name was interned before, or the empty atom otherwise.
+  //! It never adds names to the table.
+  static JSValueAtom TryFind(std::string_view name) noexcept;
+
+  //! Number of names in the table.
+  static size_t GetInternedCount() noexcept;
+
+  //! True if it is the atom for the empty name.
+  bool IsEmpty() const noexcept;
+
+  //! The interned name. It is valid until the process ends.
+  std::string_view Name() const noexcept;
+
+  //! The name hash that is computed once when the name is interned.
+  size_t Hash() const noexcept;
+
+  friend bool operator==(JSValueAtom left, JSValueAtom right) noexcept {
+    return left.m_entry == right.m_entry;
+  }
+
+  friend bool operator!=(JSValueAtom left, JSValueAtom right) noexcept {
+    return left.m_entry != right.m_entry;
+  }
+
+ private:
+  struct Entry;
+  friend struct JSValueAtomTable;
+
+  explicit JSValueAtom(Entry const *entry) noexcept : m_entry{entry} {}
+
+ private:
+  Entry const *m_entry{nullptr};
+};
+
+//! Read the next object property name as an atom.
+//! It is the same as IJSValueReader::GetNextObjectProperty, but keeps the name interned.
+//! The atom is looked up from the characters of the string returned by the reader without copying it.
+bool GetNextObjectProperty(IJSValueReader const &reader, JSValueAtom &propertyName) noexcept;
+
+//==============================================================================
+// JSValuePropertyTable declaration.
+//==============================================================================
+
+//! JSValuePropertyTable maps a fixed set of property names to their indexes with a perfect hash.
+//! A lookup computes one hash and compares one name, no matter how many names are in the set.
+//! It is meant to be created once, for example as a function static variable, for a known set of props.
+struct JSValuePropertyTable {
+  //! Create the table. The index of each name is its position in the list. Names must be unique.
+  JSValuePropertyTable(std::initializer_list<std::string_view> names) noexcept;
+
+  //! Create the table from a range of names.
+  template <class TIterator>
+  JSValuePropertyTable(TIterator first, TIterator last) noexcept;
+
+  //! Return the index of the name, or -1 if the name is not in the table.
+  int Find(std::string_view name) const noexcept;
+
+  //! Return the index of the atom name, or -1 if the name is not in the table.
+  int Find(JSValueAtom name) const noexcept;
+
+  //! Number of names in the table.
+  size_t size() const noexcept;
+
+  //! Name at the index.
+  std::string_view operator[](size_t index) const noexcept;
+
+ private:
+  void BuildSlots() noexcept;
+
+ private:
+  std::vector<std::string> m_names;
+
+  // Slots with a name index + 1. Zero marks an empty slot.
+  std::vector<uint16_t> m_slots;
+  uint64_t m_seed{0};
+};
+
+//! Hash function used by JSValueAtom and JSValuePropertyTable.
+size_t HashPropertyName(std::string_view name, uint64_t seed = 0) noexcept;
+
+//===========================================================================
+// Inline JSValueAtom implementation.
+//===========================================================================
+
+struct JSValueAtom::Entry {
+  std::string Name;
+  size_t Hash;
+};
+
+inline bool JSValueAtom::IsEmpty() const noexcept {
+  return m_entry == nullptr;
+}
+
+inline std::string_view JSValueAtom::Name() const noexcept {
+  return m_entry ? std::string_view{m_entry->Name} : std::string_view{};
+}
+
+inline size_t JSValueAtom::Hash() const noexcept {
+  return m_entry ? m_entry->Hash : 0;
+}
+
+//===========================================================================
+// Inline JSValuePropertyTable implementation.
+//===========================================================================
+
+inline JSValuePropertyTable::JSValuePropertyTable(std::initializer_list<std::string_view> names) noexcept
+    : JSValuePropertyTable(names.begin(), names.end()) {}
+
+template <class TIterator>
+JSValuePropertyTable::JSValuePropertyTable(TIterator first, TIterator last) noexcept : m_names(first, last) {
+  BuildSlots();
+}
+
+inline int JSValuePropertyTable::Find(JSValueAtom name) const noexcept {
+  return Find(name.Name());
+}
+
+inline size_t JSValuePropertyTable::size() const noexcept {
+  return m_names.size();
+}
+
+inline std::string_view JSValuePropertyTable::operator[](size_t index) const noexcept {
+  return m_names[index];
+}
+
+} // namespace winrt::Microsoft::ReactNative
+
+namespace std {
+
+template <>
+struct hash<winrt::Microsoft::ReactNative::JSValueAtom> {
+  size_t operator()(winrt::Microsoft::ReactNative::JSValueAtom atom) const noexcept {
+    return atom.Hash();
+  }
+};
+
+} // namespace std
+
+#endif // MICROSOFT_REACTNATIVE_JSVALUEATOM
@@ -0,0 +1,582 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// IMPORTANT: Before updating this file
+// please read react-native-windows repo:
+// vnext/Microsoft.ReactNative.Cxx/README.md
+
+#include "pch.h"
+#include "JSValueBinary.h"
+#include <algorithm>
+#include <cstring>
+
+namespace winrt::Microsoft::ReactNative {
+
+//===========================================================================
+// JSValueBinaryEncoder implementation
+//===========================================================================
+
+JSValueBinaryEncoder::JSValueBinaryEncoder(std::vector<uint8_t> &buffer) noexcept : m_buffer{buffer} {
+  m_buffer.clear();
+  m_buffer.push_back(JSValueBinaryFormatVersion);
+}
+
+void JSValueBinaryEncoder::WriteNull() noexcept {
+  WriteTag(JSValueBinaryTag::Null);
+}
+
+void JSValueBinaryEncoder::WriteBoolean(bool value) noexcept {
+  WriteTag(value ? JSValueBinaryTag::True : JSValueBinaryTag::False);
+}
+
+void JSValueBinaryEncoder::WriteInt64(int64_t value) noexcept {
+  // The zigzag encoding keeps small negative numbers short.
+  WriteTag(JSValueBinaryTag::Int64);
+  WriteVarUInt64((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+void JSValueBinaryEncoder::WriteDouble(double value) noexcept {
+  WriteTag(JSValueBinaryTag::Double);
+  uint8_t bytes[sizeof(double)];
+  std::memcpy(bytes, &value, sizeof(double));
+  m_buffer.insert(m_buffer.end(), bytes, bytes + sizeof(double));
+}
+
+void JSValueBinaryEncoder::WriteString(std::string_view value) noexcept {
+  WriteUtf8(JSValueBinaryTag::String, value);
+}
+
+void JSValueBinaryEncoder::WriteString(std::wstring_view value) noexcept {
+  WriteUtf16(JSValueBinaryTag::String, value);
+}
+
+void JSValueBinaryEncoder::WriteObjectBegin() noexcept {
+  WriteTag(JSValueBinaryTag::ObjectBegin);
+}
+
+void JSValueBinaryEncoder::WritePropertyName(std::string_view name) noexcept {
+  WriteUtf8(JSValueBinaryTag::PropertyName, name);
+}
+
+void JSValueBinaryEncoder::WritePropertyName(std::wstring_view name) noexcept {
+  WriteUtf16(JSValueBinaryTag::PropertyName, name);
+}
+
+void JSValueBinaryEncoder::WriteObjectEnd() noexcept {
+  WriteTag(JSValueBinaryTag::End);
+}
+
+void JSValueBinaryEncoder::WriteArrayBegin() noexcept {
+  WriteTag(JSValueBinaryTag::ArrayBegin);
+}
+
+void JSValueBinaryEncoder::WriteArrayEnd() noexcept {
+  WriteTag(JSValueBinaryTag::End);
+}
+
+void JSValueBinaryEncoder::WriteEncodedValue(array_view<uint8_t const> buffer) noexcept {
+  VerifyElseCrashSz(
+      buffer.size() > 1 && buffer[0] == JSValueBinaryFormatVersion, "Unsupported JSValue binary encoding version");
+  m_buffer.insert(m_buffer.end(), buffer.begin() + 1, buffer.end());
+}
+
+void JSValueBinaryEncoder::WriteValue(IJSValueReader const &reader) noexcept {
+  switch (reader.ValueType()) {
+    case JSValueType::Null:
+      return WriteNull();
+    case JSValueType::Object: {
+      WriteObjectBegin();
+      hstring propertyName;
+      while (reader.GetNextObjectProperty(/*ref*/ propertyName)) {
+        WritePropertyName(std::wstring_view{propertyName});
+        WriteValue(reader);
+      }
+
+      return WriteObjectEnd();
+    }
+    case JSValueType::Array:
+      WriteArrayBegin();
+      while (reader.GetNextArrayItem()) {
+        WriteValue(reader);
+      }
+
+      return WriteArrayEnd();
+    case JSValueType::String:
+      return WriteString(std::wstring_view{reader.GetString()});
+    case JSValueType::Boolean:
+      return WriteBoolean(reader.GetBoolean());
+    case JSValueType::Int64:
+      return WriteInt64(reader.GetInt64());
+    case JSValueType::Double:
+      return WriteDouble(reader.GetDouble());
+    default:
+      VerifyElseCrashSz(false, "Unexpected JSValue type");
+  }
+}
+
+void JSValueBinaryEncoder::WriteTag(JSValueBinaryTag tag) noexcept {
+  m_buffer.push_back(static_cast<uint8_t>(tag));
+}
+
+void JSValueBinaryEncoder::WriteVarUInt64(uint64_t value) noexcept {
+  while (value >= 0x80) {
+    m_buffer.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+
+  m_buffer.push_back(static_cast<uint8_t>(value));
+}
+
+void JSValueBinaryEncoder::WriteUtf8(JSValueBinaryTag tag, std::string_view value) noexcept {
+  WriteTag(tag);
+  WriteVarUInt64(value.size());
+  m_buffer.insert(m_buffer.end(), value.begin(), value.end());
+}
+
+void JSValueBinaryEncoder::WriteUtf16(JSValueBinaryTag tag, std::wstring_view value) noexcept {
+  // Property names and most strings are ASCII. They are copied without a temporary UTF-8 string.
+  if (std::all_of(value.begin(), value.end(), [](wchar_t ch) noexcept { return ch < 0x80; })) {
+    WriteTag(tag);
+    WriteVarUInt64(value.size());
+    for (wchar_t ch : value) {
+      m_buffer.push_back(static_cast<uint8_t>(ch));
+    }
+  } else {
+    WriteUtf8(tag, to_string(value));
+  }
+}
+
+//===========================================================================
+// JSValueBinaryDecoder implementation
+//===========================================================================
+
+JSValueBinaryDecoder::JSValueBinaryDecoder(array_view<uint8_t const> buffer) noexcept
+    : m_data{buffer.data()}, m_size{buffer.size()} {
+  VerifyElseCrashSz(
+      m_size > 1 && m_data[0] == JSValueBinaryFormatVersion, "Unsupported JSValue binary encoding version");
+  SetCurrentValue(1);
+}
+
+JSValueType JSValueBinaryDecoder::ValueType() const noexcept {
+  switch (TagAt(m_valueOffset)) {
+    case JSValueBinaryTag::ObjectBegin:
+      return JSValueType::Object;
+    case JSValueBinaryTag::ArrayBegin:
+      return JSValueType::Array;
+    case JSValueBinaryTag::String:
+      return JSValueType::String;
+    case JSValueBinaryTag::False:
+    case JSValueBinaryTag::True:
+      return JSValueType::Boolean;
+    case JSValueBinaryTag::Int64:
+      return JSValueType::Int64;
+    case JSValueBinaryTag::Double:
+      return JSValueType::Double;
+    default:
+      return JSValueType::Null;
+  }
+}
+
+bool JSValueBinaryDecoder::GetNextObjectProperty(std::string_view &propertyName) noexcept {
+  propertyName = {};
+  size_t offset;
+  if (!m_isInContainer) {
+    if (TagAt(m_valueOffset) != JSValueBinaryTag::ObjectBegin) {
+      return false;
+    }
+
+    m_containers.push_back({JSValueType::Object, m_valueOffset});
+    offset = m_valueOffset + 1;
+  } else if (!m_containers.empty() && m_containers.back().Type == JSValueType::Object) {
+    offset = m_nextOffset;
+  } else {
+    return false;
+  }
+
+  if (TagAt(offset) == JSValueBinaryTag::PropertyName) {
+    ++offset;
+    propertyName = ReadUtf8(/*ref*/ offset);
+    SetCurrentValue(offset);
+    return true;
+  }
+
+  EndContainer(offset);
+  return false;
+}
+
+bool JSValueBinaryDecoder::GetNextArrayItem() noexcept {
+  size_t offset;
+  if (!m_isInContainer) {
+    if (TagAt(m_valueOffset) != JSValueBinaryTag::ArrayBegin) {
+      return false;
+    }
+
+    m_containers.push_back({JSValueType::Array, m_valueOffset});
+    offset = m_valueOffset + 1;
+  } else if (!m_containers.empty() && m_containers.back().Type == JSValueType::Array) {
+    offset = m_nextOffset;
+  } else {
+    return false;
+  }
+
+  if (TagAt(offset) != JSValueBinaryTag::End) {
+    SetCurrentValue(offset);
+    return true;
+  }
+
+  EndContainer(offset);
+  return false;
+}
+
+std::string_view JSValueBinaryDecoder::GetString() const noexcept {
+  if (TagAt(m_valueOffset) == JSValueBinaryTag::String) {
+    size_t offset = m_valueOffset + 1;
+    return ReadUtf8(/*ref*/ offset);
+  }
+
+  return {};
+}
+
+bool JSValueBinaryDecoder::GetBoolean() const noexcept {
+  return TagAt(m_valueOffset) == JSValueBinaryTag::True;
+}
+
+int64_t JSValueBinaryDecoder::GetInt64() const noexcept {
+  return TagAt(m_valueOffset) == JSValueBinaryTag::Int64 ? ReadInt64At(m_valueOffset + 1) : 0;
+}
+
+double JSValueBinaryDecoder::GetDouble() const noexcept {
+  return TagAt(m_valueOffset) == JSValueBinaryTag::Double ? ReadDoubleAt(m_valueOffset + 1) : 0;
+}
+
+array_view<uint8_t const> JSValueBinaryDecoder::SkipValue() noexcept {
+  if (!m_isInContainer) {
+    // The current value is an object or array that was not started yet.
+    size_t offset = m_valueOffset;
+    size_t depth = 0;
+    do {
+      switch (TagAt(offset)) {
+        case JSValueBinaryTag::ObjectBegin:
+        case JSValueBinaryTag::ArrayBegin:
+          ++depth;
+          break;
+        case JSValueBinaryTag::End:
+          --depth;
+          break;
+        default:
+          break;
+      }
+
+      offset = SkipToken(offset);
+    } while (depth > 0);
+
+    m_nextOffset = offset;
+    m_isInContainer = !m_containers.empty();
+  }
+
+  return array_view<uint8_t const>{m_data + m_valueOffset, m_data + m_nextOffset};
+}
+
+void JSValueBinaryDecoder::ReadValue(IJSValueWriter const &writer) noexcept {
+  auto tokens = SkipValue();
+  size_t offset = static_cast<size_t>(tokens.data() - m_data);
+  size_t const endOffset = offset + tokens.size();
+  std::vector<bool> isObjectStack;
+  while (offset < endOffset) {
+    JSValueBinaryTag tag = TagAt(offset);
+    switch (tag) {
+      case JSValueBinaryTag::Null:
+        writer.WriteNull();
+        break;
+      case JSValueBinaryTag::False:
+      case JSValueBinaryTag::True:
+        writer.WriteBoolean(tag == JSValueBinaryTag::True);
+        break;
+      case JSValueBinaryTag::Int64:
+        writer.WriteInt64(ReadInt64At(offset + 1));
+        break;
+      case JSValueBinaryTag::Double:
+        writer.WriteDouble(ReadDoubleAt(offset + 1));
+        break;
+      case JSValueBinaryTag::String:
+      case JSValueBinaryTag::PropertyName: {
+        size_t stringOffset = offset + 1;
+        hstring value = to_hstring(ReadUtf8(/*ref*/ stringOffset));
+        tag == JSValueBinaryTag::String ? writer.WriteString(value) : writer.WritePropertyName(value);
+        break;
+      }
+      case JSValueBinaryTag::ObjectBegin:
+        isObjectStack.push_back(true);
+        writer.WriteObjectBegin();
+        break;
+      case JSValueBinaryTag::ArrayBegin:
+        isObjectStack.push_back(false);
+        writer.WriteArrayBegin();
+        break;
+      case JSValueBinaryTag::End:
+        isObjectStack.back() ? writer.WriteObjectEnd() : writer.WriteArrayEnd();
+        isObjectStack.pop_back();
+        break;
+    }
+
+    offset = SkipToken(offset);
+  }
+}
+
+JSValueBinaryTag JSValueBinaryDecoder::TagAt(size_t offset) const noexcept {
+  VerifyElseCrashSz(offset < m_size, "Unexpected end of JSValue binary buffer");
+  VerifyElseCrashSz(m_data[offset] <= static_cast<uint8_t>(JSValueBinaryTag::End), "Unexpected JSValue binary tag");
+  return static_cast<JSValueBinaryTag>(m_data[offset]);
+}
+
+uint64_t JSValueBinaryDecoder::ReadVarUInt64(size_t &offset) const noexcept {
+  uint64_t value = 0;
+  for (uint32_t shift = 0;; shift += 7) {
+    VerifyElseCrashSz(offset < m_size && shift < 64, "Invalid JSValue binary varint");
+    uint8_t byte = m_data[offset++];
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      return value;
+    }
+  }
+}
+
+int64_t JSValueBinaryDecoder::ReadInt64At(size_t offset) const noexcept {
+  uint64_t value = ReadVarUInt64(/*ref*/ offset);
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+double JSValueBinaryDecoder::ReadDoubleAt(size_t offset) const noexcept {
+  VerifyElseCrashSz(m_size - offset >= sizeof(double), "Unexpected end of JSValue binary buffer");
+  double value;
+  std::memcpy(&value, m_data + offset, sizeof(double));
+  return value;
+}
+
+std::string_view JSValueBinaryDecoder::ReadUtf8(size_t &offset) const noexcept {
+  uint64_t length = ReadVarUInt64(/*ref*/ offset);
+  VerifyElseCrashSz(length <= m_size - offset, "Unexpected end of JSValue binary buffer");
+  std::string_view value{reinterpret_cast<char const *>(m_data + offset), static_cast<size_t>(length)};
+  offset += static_cast<size_t>(length);
+  return value;
+}
+
+size_t JSValueBinaryDecoder::SkipToken(size_t offset) const noexcept {
+  switch (TagAt(offset++)) {
+    case JSValueBinaryTag::Int64:
+      ReadVarUInt64(/*ref*/ offset);
+      break;
+    case JSValueBinaryTag::Double:
+      VerifyElseCrashSz(m_size - offset >= sizeof(double), "Unexpected end of JSValue binary buffer");
+      offset += sizeof(double);
+      break;
+    case JSValueBinaryTag::String:
+    case JSValueBinaryTag::PropertyName:
+      ReadUtf8(/*ref*/ offset);
+      break;
+    default:
+      break;
+  }
+
+  return offset;
+}
+
+void JSValueBinaryDecoder::SetCurrentValue(size_t offset) noexcept {
+  m_valueOffset = offset;
+  JSValueBinaryTag tag = TagAt(offset);
+  VerifyElseCrashSz(
+      tag != JSValueBinaryTag::PropertyName && tag != JSValueBinaryTag::End, "Unexpected JSValue binary tag");
+  if (tag == JSValueBinaryTag::ObjectBegin || tag == JSValueBinaryTag::ArrayBegin) {
+    m_isInContainer = false;
+  } else {
+    m_nextOffset = SkipToken(offset);
+    m_isInContainer = true;
+  }
+}
+
+void JSValueBinaryDecoder::EndContainer(size_t offset) noexcept {
+  VerifyElseCrashSz(TagAt(offset) == JSValueBinaryTag::End, "Unexpected JSValue binary tag");
+  m_valueOffset = m_containers.back().ValueOffset;
+  m_nextOffset = offset + 1;
+  m_containers.pop_back();
+  m_isInContainer = !m_containers.empty();
+}
+
+//===========================================================================
+// JSValueBinaryReader implementation
+//===========================================================================
+
+JSValueBinaryReader::JSValueBinaryReader(std::vector<uint8_t> &&buffer) noexcept
+    : m_buffer{std::move(buffer)}, m_decoder{m_buffer} {}
+
+JSValueType JSValueBinaryReader::ValueType() noexcept {
+  return m_decoder.ValueType();
+}
+
+bool JSValueBinaryReader::GetNextObjectProperty(hstring &propertyName) noexcept {
+  std::string_view name;
+  bool result = m_decoder.GetNextObjectProperty(/*ref*/ name);
+  propertyName = to_hstring(name);
+  return result;
+}
+
+bool JSValueBinaryReader::GetNextArrayItem() noexcept {
+  return m_decoder.GetNextArrayItem();
+}
+
+hstring JSValueBinaryReader::GetString() noexcept {
+  return to_hstring(m_decoder.GetString());
+}
+
+bool JSValueBinaryReader::GetBoolean() noexcept {
+  return m_decoder.GetBoolean();
+}
+
+int64_t JSValueBinaryReader::GetInt64() noexcept {
+  return m_decoder.GetInt64();
+}
+
+double JSValueBinaryReader::GetDouble() noexcept {
+  return m_decoder.GetDouble();
+}
+
+com_array<uint8_t> JSValueBinaryReader::ReadBinaryValue() noexcept {
+  auto tokens = m_decoder.SkipValue();
+  com_array<uint8_t> result(static_cast<uint32_t>(tokens.size() + 1));
+  result[0] = JSValueBinaryFormatVersion;
+  std::copy(tokens.begin(), tokens.end(), result.begin() + 1);
+  return result;
+}
+
+//===========================================================================
+// JSValueBinaryWriter implementation
+//===========================================================================
+
+JSValueBinaryWriter::JSValueBinaryWriter() noexcept : m_encoder{m_buffer} {}
+
+std::vector<uint8_t> JSValueBinaryWriter::TakeBuffer() noexcept {
+  return std::move(m_buffer);
+}
+
+void JSValueBinaryWriter::WriteNull() noexcept {
+  m_encoder.WriteNull();
+}
+
+void JSValueBinaryWriter::WriteBoolean(bool value) noexcept {
+  m_encoder.WriteBoolean(value);
+}
+
+void JSValueBinaryWriter::WriteInt64(int64_t value) noexcept {
+  m_encoder.WriteInt64(value);
+}
+
+void JSValueBinaryWriter::WriteDouble(double value) noexcept {
+  m_encoder.WriteDouble(value);
+}
+
+void JSValueBinaryWriter::WriteString(const winrt::hstring &value) noexcept {
+  m_encoder.WriteString(std::wstring_view{value});
+}
+
+void JSValueBinaryWriter::WriteObjectBegin() noexcept {
+  m_encoder.WriteObjectBegin();
+}
+
+void JSValueBinaryWriter::WritePropertyName(const winrt::hstring &name) noexcept {
+  m_encoder.WritePropertyName(std::wstring_view{name});
+}
+
+void JSValueBinaryWriter::WriteObjectEnd() noexcept {
+  m_encoder.WriteObjectEnd();
+}
+
+void JSValueBinaryWriter::WriteArrayBegin() noexcept {
+  m_encoder.WriteArrayBegin();
+}
+
+void JSValueBinaryWriter::WriteArrayEnd() noexcept {
+  m_encoder.WriteArrayEnd();
+}
+
+void JSValueBinaryWriter::WriteBinaryValue(array_view<uint8_t const> value) noexcept {
+  m_encoder.WriteEncodedValue(value);
+}
+
+//===========================================================================
+// Standalone functions
+//===========================================================================
+
+IJSValueReader MakeJSValueBinaryReader(std::vector<uint8_t> &&buffer) noexcept {
+  return make<JSValueBinaryReader>(std::move(buffer));
+}
+
+IJSValueWriter MakeJSValueBinaryWriter() noexcept {
+  return make<JSValueBinaryWriter>();
+}
+
+std::vector<uint8_t> TakeBinaryValue(IJSValueWriter const &writer) noexcept {
+  return get_self<JSValueBinaryWriter>(writer)->TakeBuffer();
+}
+
+namespace {
+
+// The first pointer of an ABI object is its vtable pointer. It identifies the class that implements the object.
+void *GetAbiClass(void *abi) noexcept {
+  return *static_cast<void **>(abi);
+}
+
+// Only the last class is remembered: a thread usually reads and writes values through one reader and writer class.
+// A remembered class only skips the QueryInterface, so a class at the address of an unloaded class is still handled.
+thread_local void *s_nonBinaryReaderClass{nullptr};
+thread_local void *s_nonBinaryWriterClass{nullptr};
+
+} // namespace
+
+IJSValueBinaryReader TryGetBinaryReader(IJSValueReader const &reader) noexcept {
+  void *readerClass = GetAbiClass(get_abi(reader));
+  if (readerClass == s_nonBinaryReaderClass) {
+    return nullptr;
+  }
+
+  auto binaryReader = reader.try_as<IJSValueBinaryReader>();
+  if (!binaryReader) {
+    s_nonBinaryReaderClass = readerClass;
+  }
+
+  return binaryReader;
+}
+
+IJSValueBinaryWriter TryGetBinaryWriter(IJSValueWriter const &writer) noexcept {
+  void *writerClass = GetAbiClass(get_abi(writer));
+  if (writerClass == s_nonBinaryWriterClass) {
+    return nullptr;
+  }
+
+  auto binaryWriter = writer.try_as<IJSValueBinaryWriter>();
+  if (!binaryWriter) {
+    s_nonBinaryWriterClass = writerClass;
+  }
+
+  return binaryWriter;
+}
+
+std::vector<uint8_t> ReadBinaryValue(IJSValueReader const &reader) noexcept {
+  std::vector<uint8_t> buffer;
+  if (auto binaryReader = TryGetBinaryReader(reader)) {
+    com_array<uint8_t> value = binaryReader.ReadBinaryValue();
+    buffer.assign(value.begin(), value.end());
+  } else {
+    JSValueBinaryEncoder{buffer}.WriteValue(reader);
+  }
+
+  return buffer;
+}
+
+void WriteBinaryValue(IJSValueWriter const &writer, array_view<uint8_t const> buffer) noexcept {
+  if (auto binaryWriter = TryGetBinaryWriter(writer)) {
+    binaryWriter.WriteBinaryValue(buffer);
+  } else {
+    JSValueBinaryDecoder{buffer}.ReadValue(writer);
+  }
+}
+
+} // namespace winrt::Microsoft::ReactNative
@@ -0,0 +1,225 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// IMPORTANT: Before updating this file
+// please read react-native-windows repo:
+// vnext/Microsoft.ReactNative.Cxx/README.md
+
+#pragma once
+#ifndef MICROSOFT_REACTNATIVE_JSVALUEBINARY
+#define MICROSOFT_REACTNATIVE_JSVALUEBINARY
+
+#include <string_view>
+#include <vector>
+#include "Crash.h"
+#include "winrt/Microsoft.ReactNative.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+//==============================================================================
+// JSValue binary encoding.
+//==============================================================================
+//
+// The binary encoding stores a JSON-like value as a sequence of tagged tokens in one buffer.
+// It allows IJSValueReader and IJSValueWriter implementations to pass a whole value with one ABI call
+// through IJSValueBinaryReader and IJSValueBinaryWriter instead of one call per token.
+//
+// The buffer starts with the JSValueBinaryFormatVersion byte followed by one value:
+//   value := Null | False | True | Int64 zigzag-varint | Double 8-bytes | String varint-length UTF-8
+//          | ObjectBegin (PropertyName varint-length UTF-8 value)* End
+//          | ArrayBegin value* End
+// Varints use the LEB128 encoding. Doubles are stored in the little-endian byte order.
+
+//! Version of the binary encoding written in the first byte of the buffer.
+constexpr uint8_t JSValueBinaryFormatVersion = 1;
+
+//! Tags of tokens in the binary encoding.
+enum class JSValueBinaryTag : uint8_t {
+  Null,
+  False,
+  True,
+  Int64,
+  Double,
+  String,
+  ObjectBegin,
+  PropertyName,
+  ArrayBegin,
+  End,
+};
+
+//==============================================================================
+// JSValueBinaryEncoder declaration.
+//==============================================================================
+
+//! JSValueBinaryEncoder writes a value in the binary encoding to a buffer.
+//! It has the same methods as the IJSValueWriter, but they are not virtual and strings are UTF-8.
+//! The caller is responsible for writing a well-formed value.
+struct JSValueBinaryEncoder {
+  //! Start writing a new value to the buffer. The buffer content is replaced.
+  explicit JSValueBinaryEncoder(std::vector<uint8_t> &buffer) noexcept;
+
+  void WriteNull() noexcept;
+  void WriteBoolean(bool value) noexcept;
+  void WriteInt64(int64_t value) noexcept;
+  void WriteDouble(double value) noexcept;
+  void WriteString(std::string_view value) noexcept;
+  void WriteString(std::wstring_view value) noexcept;
+  void WriteObjectBegin() noexcept;
+  void WritePropertyName(std::string_view name) noexcept;
+  void WritePropertyName(std::wstring_view name) noexcept;
+  void WriteObjectEnd() noexcept;
+  void WriteArrayBegin() noexcept;
+  void WriteArrayEnd() noexcept;
+
+  //! Write a value from another buffer in the binary encoding.
+  void WriteEncodedValue(array_view<uint8_t const> buffer) noexcept;
+
+  //! Write the current reader value with all its nested values by reading it token by token.
+  void WriteValue(IJSValueReader const &reader) noexcept;
+
+ private:
+  void WriteTag(JSValueBinaryTag tag) noexcept;
+  void WriteVarUInt64(uint64_t value) noexcept;
+  void WriteUtf8(JSValueBinaryTag tag, std::string_view value) noexcept;
+  void WriteUtf16(JSValueBinaryTag tag, std::wstring_view value) noexcept;
+
+ private:
+  std::vector<uint8_t> &m_buffer;
+};
+
+//==============================================================================
+// JSValueBinaryDecoder declaration.
+//==============================================================================
+
+//! JSValueBinaryDecoder reads a value in the binary encoding from a buffer.
+//! It has the same methods as the IJSValueReader and must be used the same way, but its methods are not virtual
+//! and strings are returned as UTF-8 string views into the buffer without copying them.
+//! The buffer must outlive the decoder. A malformed buffer causes a crash.
+struct JSValueBinaryDecoder {
+  explicit JSValueBinaryDecoder(array_view<uint8_t const> buffer) noexcept;
+
+  JSValueType ValueType() const noexcept;
+  bool GetNextObjectProperty(std::string_view &propertyName) noexcept;
+  bool GetNextArrayItem() noexcept;
+  std::string_view GetString() const noexcept;
+  bool GetBoolean() const noexcept;
+  int64_t GetInt64() const noexcept;
+  double GetDouble() const noexcept;
+
+  //! Skip the current value with all its nested values and return its encoded tokens.
+  //! The decoder is left in the same state as after reading the whole value.
+  array_view<uint8_t const> SkipValue() noexcept;
+
+  //! Write the current value with all its nested values to the writer token by token.
+  void ReadValue(IJSValueWriter const &writer) noexcept;
+
+ private:
+  struct ContainerEntry {
+    JSValueType Type;
+    size_t ValueOffset;
+  };
+
+ private:
+  JSValueBinaryTag TagAt(size_t offset) const noexcept;
+  uint64_t ReadVarUInt64(size_t &offset) const noexcept;
+  int64_t ReadInt64At(size_t offset) const noexcept;
+  double ReadDoubleAt(size_t offset) const noexcept;
+  std::string_view ReadUtf8(size_t &offset) const noexcept;
+  size_t SkipToken(size_t offset) const noexcept;
+  void SetCurrentValue(size_t offset) noexcept;
+  void EndContainer(size_t offset) noexcept;
+
+ private:
+  uint8_t const *m_data;
+  size_t m_size;
+  size_t m_valueOffset{0};
+  size_t m_nextOffset{0};
+  bool m_isInContainer{false};
+  std::vector<ContainerEntry> m_containers;
+};
+
+//==============================================================================
+// JSValueBinaryReader declaration.
+//==============================================================================
+
+//! IJSValueReader for a buffer in the binary encoding.
+//! Its IJSValueBinaryReader implementation returns nested values without decoding them.
+struct JSValueBinaryReader : implements<JSValueBinaryReader, IJSValueReader, IJSValueBinaryReader> {
+  JSValueBinaryReader(std::vector<uint8_t> &&buffer) noexcept;
+
+ public: // IJSValueReader
+  JSValueType ValueType() noexcept;
+  bool GetNextObjectProperty(hstring &propertyName) noexcept;
+  bool GetNextArrayItem() noexcept;
+  hstring GetString() noexcept;
+  bool GetBoolean() noexcept;
+  int64_t GetInt64() noexcept;
+  double GetDouble() noexcept;
+
+ public: // IJSValueBinaryReader
+  com_array<uint8_t> ReadBinaryValue() noexcept;
+
+ private:
+  std::vector<uint8_t> const m_buffer;
+  JSValueBinaryDecoder m_decoder;
+};
+
+//==============================================================================
+// JSValueBinaryWriter declaration.
+//==============================================================================
+
+//! IJSValueWriter that writes to a buffer in the binary encoding.
+//! Its IJSValueBinaryWriter implementation copies nested values without decoding them.
+struct JSValueBinaryWriter : implements<JSValueBinaryWriter, IJSValueWriter, IJSValueBinaryWriter> {
+  JSValueBinaryWriter() noexcept;
+
+  //! Take the written buffer. The writer must not be used after that.
+  std::vector<uint8_t> TakeBuffer() noexcept;
+
+ public: // IJSValueWriter
+  void WriteNull() noexcept;
+  void WriteBoolean(bool value) noexcept;
+  void WriteInt64(int64_t value) noexcept;
+  void WriteDouble(double value) noexcept;
+  void WriteString(const winrt::hstring &value) noexcept;
+  void WriteObjectBegin() noexcept;
+  void WritePropertyName(const winrt::hstring &name) noexcept;
+  void WriteObjectEnd() noexcept;
+  void WriteArrayBegin() noexcept;
+  void WriteArrayEnd() noexcept;
+
+ public: // IJSValueBinaryWriter
+  void WriteBinaryValue(array_view<uint8_t const> value) noexcept;
+
+ private:
+  std::vector<uint8_t> m_buffer;
+  JSValueBinaryEncoder m_encoder;
+};
+
+//! Create IJSValueReader for a buffer in the binary encoding.
+IJSValueReader MakeJSValueBinaryReader(std::vector<uint8_t> &&buffer) noexcept;
+
+//! Create IJSValueWriter that writes to a buffer in the binary encoding.
+IJSValueWriter MakeJSValueBinaryWriter() noexcept;
+
+//! Take the buffer from the IJSValueWriter created by MakeJSValueBinaryWriter.
+std::vector<uint8_t> TakeBinaryValue(IJSValueWriter const &writer) noexcept;
+
+//! Get the IJSValueBinaryReader of the reader, or nullptr if the reader does not implement it.
+//! The reader classes without it are remembered per thread, so that their values do not pay a QueryInterface.
+IJSValueBinaryReader TryGetBinaryReader(IJSValueReader const &reader) noexcept;
+
+//! Get the IJSValueBinaryWriter of the writer, or nullptr if the writer does not implement it.
+//! The writer classes without it are remembered per thread, so that their values do not pay a QueryInterface.
+IJSValueBinaryWriter TryGetBinaryWriter(IJSValueWriter const &writer) noexcept;
+
+//! Read the current reader value with all its nested values in the binary encoding.
+//! It is one ABI call if the reader implements IJSValueBinaryReader. Otherwise, the value is read token by token.
+std::vector<uint8_t> ReadBinaryValue(IJSValueReader const &reader) noexcept;
+
+//! Write a value in the binary encoding.
+//! It is one ABI call if the writer implements IJSValueBinaryWriter. Otherwise, the value is written token by token.
+void WriteBinaryValue(IJSValueWriter const &writer, array_view<uint8_t const> buffer) noexcept;
+
+} // namespace winrt::Microsoft::ReactNative
+
+#endif // MICROSOFT_REACTNATIVE_JSVALUEBINARY
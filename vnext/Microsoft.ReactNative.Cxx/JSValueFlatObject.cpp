@@ -0,0 +1,426 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// IMPORTANT: Before updating this file
+// please read react-native-windows repo:
+// vnext/Microsoft.ReactNative.Cxx/README.md
+
+#include "pch.h"
+#include "JSValueFlatObject.h"
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <utility>
+
+#undef min
+#undef max
+
+namespace winrt::Microsoft::ReactNative {
+
+//===========================================================================
+// JSValueFlatObject implementation
+//===========================================================================
+
+JSValueFlatObject::JSValueFlatObject() noexcept : m_data{reinterpret_cast<value_type *>(m_inlineStorage)} {}
+
+JSValueFlatObject::JSValueFlatObject(std::initializer_list<JSValueObjectKeyValue> initObject) noexcept
+    : JSValueFlatObject() {
+  reserve(initObject.size());
+  for (auto const &item : initObject) {
+    Append(std::string(item.Key), std::move(*const_cast<JSValue *>(&item.Value)));
+  }
+
+  SortAndRemoveDuplicates();
+}
+
+JSValueFlatObject::JSValueFlatObject(JSValueObject &&other) noexcept : JSValueFlatObject() {
+  // Properties in std::map are already sorted. Extract nodes to move the property names.
+  reserve(other.size());
+  while (!other.empty()) {
+    auto node = other.extract(other.begin());
+    Append(std::move(node.key()), std::move(node.mapped()));
+  }
+
+  UpdateHashIndex();
+}
+
+JSValueFlatObject::JSValueFlatObject(JSValueFlatObject &&other) noexcept : JSValueFlatObject() {
+  MoveFrom(std::move(other));
+}
+
+JSValueFlatObject &JSValueFlatObject::operator=(JSValueFlatObject &&other) noexcept {
+  if (this != &other) {
+    ReleaseStorage();
+    MoveFrom(std::move(other));
+  }
+
+  return *this;
+}
+
+JSValueFlatObject::~JSValueFlatObject() noexcept {
+  ReleaseStorage();
+}
+
+JSValueFlatObject JSValueFlatObject::Copy() const noexcept {
+  JSValueFlatObject object;
+  object.reserve(m_size);
+  for (auto const &property : *this) {
+    object.Append(std::string(property.first), property.second.Copy());
+  }
+
+  object.UpdateHashIndex();
+  return object;
+}
+
+JSValueObject JSValueFlatObject::MoveToObject() noexcept {
+  JSValueObject object;
+  for (auto &property : *this) {
+    object.emplace_hint(object.end(), std::move(property.first), std::move(property.second));
+  }
+
+  clear();
+  return object;
+}
+
+void JSValueFlatObject::reserve(size_type newCapacity) noexcept {
+  if (newCapacity > m_capacity) {
+    Reallocate(newCapacity);
+  }
+}
+
+void JSValueFlatObject::clear() noexcept {
+  std::destroy(m_data, m_data + m_size);
+  m_size = 0;
+  m_hashIndex.clear();
+}
+
+JSValueFlatObject::iterator JSValueFlatObject::erase(const_iterator position) noexcept {
+  size_type index = static_cast<size_type>(position - m_data);
+  RemoveHashIndexEntry(index);
+  std::move(m_data + index + 1, m_data + m_size, m_data + index);
+  std::destroy_at(m_data + m_size - 1);
+  --m_size;
+  return m_data + index;
+}
+
+JSValueFlatObject::size_type JSValueFlatObject::erase(std::string_view propertyName) noexcept {
+  size_type index = FindIndex(propertyName);
+  if (index == m_size) {
+    return 0;
+  }
+
+  erase(m_data + index);
+  return 1;
+}
+
+JSValue &JSValueFlatObject::operator[](std::string_view propertyName) noexcept {
+  size_type index = LowerBound(propertyName);
+  if (index != m_size && m_data[index].first == propertyName) {
+    return m_data[index].second;
+  }
+
+  return Insert(index, propertyName, JSValue{nullptr})->second;
+}
+
+JSValue const &JSValueFlatObject::operator[](std::string_view propertyName) const noexcept {
+  if (auto value = TryGetObjectProperty(propertyName)) {
+    return *value;
+  }
+
+  return JSValue::Null;
+}
+
+bool JSValueFlatObject::Equals(JSValueFlatObject const &other) const noexcept {
+  if (m_size != other.m_size) {
+    return false;
+  }
+
+  // Both objects keep properties sorted by name.
+  // Make sure that pairs are matching at the same position.
+  for (size_type i = 0; i < m_size; ++i) {
+    if (m_data[i].first != other.m_data[i].first || !m_data[i].second.Equals(other.m_data[i].second)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool JSValueFlatObject::JSEquals(JSValueFlatObject const &other) const noexcept {
+  if (m_size != other.m_size) {
+    return false;
+  }
+
+  // Both objects keep properties sorted by name.
+  // Make sure that pairs are matching at the same position.
+  for (size_type i = 0; i < m_size; ++i) {
+    if (m_data[i].first != other.m_data[i].first || !m_data[i].second.JSEquals(other.m_data[i].second)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/*static*/ JSValueFlatObject JSValueFlatObject::ReadFrom(IJSValueReader const &reader) noexcept {
+  JSValueFlatObject object;
+  if (reader.ValueType() == JSValueType::Object) {
+    hstring propertyName;
+    while (reader.GetNextObjectProperty(/*ref*/ propertyName)) {
+      object.Append(to_string(propertyName), JSValue::ReadFrom(reader));
+    }
+
+    // Sort once instead of inserting each property at its sorted position.
+    object.SortAndRemoveDuplicates();
+  }
+
+  return object;
+}
+
+void JSValueFlatObject::WriteTo(IJSValueWriter const &writer) const noexcept {
+  writer.WriteObjectBegin();
+  for (auto const &property : *this) {
+    writer.WritePropertyName(to_hstring(property.first));
+    property.second.WriteTo(writer);
+  }
+
+  writer.WriteObjectEnd();
+}
+
+JSValueFlatObject::value_type *JSValueFlatObject::InlineData() noexcept {
+  return reinterpret_cast<value_type *>(m_inlineStorage);
+}
+
+bool JSValueFlatObject::IsInline() const noexcept {
+  return m_data == reinterpret_cast<value_type const *>(m_inlineStorage);
+}
+
+JSValueFlatObject::size_type JSValueFlatObject::LowerBound(std::string_view propertyName) const noexcept {
+  auto it = std::lower_bound(
+      m_data, m_data + m_size, propertyName, [](value_type const &property, std::string_view name) noexcept {
+        return property.first < name;
+      });
+  return static_cast<size_type>(it - m_data);
+}
+
+JSValueFlatObject::size_type JSValueFlatObject::FindIndex(std::string_view propertyName) const noexcept {
+  if (!m_hashIndex.empty()) {
+    size_t mask = m_hashIndex.size() - 1;
+    for (size_t slot = HashIndexSlot(propertyName);; slot = (slot + 1) & mask) {
+      uint32_t entry = m_hashIndex[slot];
+      if (entry == 0) {
+        return m_size;
+      }
+
+      if (m_data[entry - 1].first == propertyName) {
+        return entry - 1;
+      }
+    }
+  }
+
+  // A linear scan over the few inline properties is faster than the binary search.
+  if (m_size <= InlineCapacity) {
+    for (size_type i = 0; i < m_size; ++i) {
+      if (m_data[i].first == propertyName) {
+        return i;
+      }
+    }
+
+    return m_size;
+  }
+
+  size_type index = LowerBound(propertyName);
+  return (index != m_size && m_data[index].first == propertyName) ? index : m_size;
+}
+
+JSValueFlatObject::iterator JSValueFlatObject::Insert(
+    size_type index,
+    std::string_view propertyName,
+    JSValue &&value) noexcept {
+  if (m_size == m_capacity) {
+    Reallocate(m_capacity * 2);
+  }
+
+  if (index == m_size) {
+    new (m_data + m_size) value_type(std::string(propertyName), std::move(value));
+  } else {
+    new (m_data + m_size) value_type(std::move(m_data[m_size - 1]));
+    std::move_backward(m_data + index, m_data + m_size - 1, m_data + m_size);
+    m_data[index].first.assign(propertyName);
+    m_data[index].second = std::move(value);
+  }
+
+  ++m_size;
+  InsertHashIndexEntry(index);
+  return m_data + index;
+}
+
+void JSValueFlatObject::Append(std::string &&propertyName, JSValue &&value) noexcept {
+  if (m_size == m_capacity) {
+    Reallocate(m_capacity * 2);
+  }
+
+  new (m_data + m_size) value_type(std::move(propertyName), std::move(value));
+  ++m_size;
+}
+
+void JSValueFlatObject::SortAndRemoveDuplicates() noexcept {
+  // The sort must be stable to keep the first property among duplicates the same way as
+  // JSValueObject::try_emplace does. Small objects use the insertion sort that does not allocate memory.
+  auto isLess = [](value_type const &left, value_type const &right) noexcept { return left.first < right.first; };
+  if (m_size <= HashIndexThreshold) {
+    for (size_type i = 1; i < m_size; ++i) {
+      if (isLess(m_data[i], m_data[i - 1])) {
+        value_type property = std::move(m_data[i]);
+        size_type j = i;
+        do {
+          m_data[j] = std::move(m_data[j - 1]);
+        } while (--j > 0 && isLess(property, m_data[j - 1]));
+        m_data[j] = std::move(property);
+      }
+    }
+  } else {
+    std::stable_sort(m_data, m_data + m_size, isLess);
+  }
+
+  auto last = std::unique(m_data, m_data + m_size, [](value_type const &left, value_type const &right) {
+    return left.first == right.first;
+  });
+  std::destroy(last, m_data + m_size);
+  m_size = static_cast<size_type>(last - m_data);
+  UpdateHashIndex();
+}
+
+void JSValueFlatObject::Reallocate(size_type newCapacity) noexcept {
+  auto data = static_cast<value_type *>(::operator new(newCapacity * sizeof(value_type)));
+  for (size_type i = 0; i < m_size; ++i) {
+    new (data + i) value_type(std::move(m_data[i]));
+  }
+
+  std::destroy(m_data, m_data + m_size);
+  if (!IsInline()) {
+    ::operator delete(m_data);
+  }
+
+  m_data = data;
+  m_capacity = newCapacity;
+}
+
+void JSValueFlatObject::MoveFrom(JSValueFlatObject &&other) noexcept {
+  if (other.IsInline()) {
+    for (size_type i = 0; i < other.m_size; ++i) {
+      new (m_data + i) value_type(std::move(other.m_data[i]));
+    }
+
+    m_size = other.m_size;
+    m_hashIndex = std::move(other.m_hashIndex);
+    other.clear();
+  } else {
+    m_data = std::exchange(other.m_data, other.InlineData());
+    m_size = std::exchange(other.m_size, 0);
+    m_capacity = std::exchange(other.m_capacity, InlineCapacity);
+    m_hashIndex = std::move(other.m_hashIndex);
+    other.m_hashIndex.clear();
+  }
+}
+
+void JSValueFlatObject::ReleaseStorage() noexcept {
+  clear();
+  if (!IsInline()) {
+    ::operator delete(m_data);
+    m_data = InlineData();
+    m_capacity = InlineCapacity;
+  }
+}
+
+void JSValueFlatObject::UpdateHashIndex() noexcept {
+  if (m_size <= HashIndexThreshold) {
+    m_hashIndex.clear();
+    return;
+  }
+
+  // Keep the table at most half full to have short probe sequences.
+  size_t tableSize = HashIndexThreshold * 2;
+  while (tableSize < m_size * 2) {
+    tableSize *= 2;
+  }
+
+  m_hashIndex.assign(tableSize, 0);
+  size_t mask = tableSize - 1;
+  for (size_type i = 0; i < m_size; ++i) {
+    size_t slot = HashIndexSlot(m_data[i].first);
+    while (m_hashIndex[slot] != 0) {
+      slot = (slot + 1) & mask;
+    }
+
+    m_hashIndex[slot] = static_cast<uint32_t>(i + 1);
+  }
+}
+
+// Called after the property is inserted at the index.
+void JSValueFlatObject::InsertHashIndexEntry(size_type index) noexcept {
+  // The table is rebuilt only when it is created or must grow to stay at most half full.
+  if (m_hashIndex.size() < size_t{m_size} * 2) {
+    UpdateHashIndex();
+    return;
+  }
+
+  // The following properties moved one position up. Shifting their entries does not hash the property names.
+  uint32_t firstMovedEntry = static_cast<uint32_t>(index + 1);
+  for (uint32_t &entry : m_hashIndex) {
+    if (entry >= firstMovedEntry) {
+      ++entry;
+    }
+  }
+
+  size_t mask = m_hashIndex.size() - 1;
+  size_t slot = HashIndexSlot(m_data[index].first);
+  while (m_hashIndex[slot] != 0) {
+    slot = (slot + 1) & mask;
+  }
+
+  m_hashIndex[slot] = static_cast<uint32_t>(index + 1);
+}
+
+// Called before the property at the index is removed.
+void JSValueFlatObject::RemoveHashIndexEntry(size_type index) noexcept {
+  if (m_hashIndex.empty()) {
+    return;
+  }
+
+  if (m_size - 1 <= HashIndexThreshold) {
+    m_hashIndex.clear();
+    return;
+  }
+
+  size_t mask = m_hashIndex.size() - 1;
+  uint32_t removedEntry = static_cast<uint32_t>(index + 1);
+  size_t slot = HashIndexSlot(m_data[index].first);
+  while (m_hashIndex[slot] != removedEntry) {
+    slot = (slot + 1) & mask;
+  }
+
+  // Shift the following entries of the probe sequence back instead of leaving a tombstone.
+  // An entry moves to the empty slot if the slot lies between its home slot and its current slot.
+  for (size_t next = (slot + 1) & mask; m_hashIndex[next] != 0; next = (next + 1) & mask) {
+    size_t home = HashIndexSlot(m_data[m_hashIndex[next] - 1].first);
+    if (((next - home) & mask) >= ((next - slot) & mask)) {
+      m_hashIndex[slot] = m_hashIndex[next];
+      slot = next;
+    }
+  }
+
+  m_hashIndex[slot] = 0;
+
+  // The following properties move one position down.
+  for (uint32_t &entry : m_hashIndex) {
+    if (entry > removedEntry) {
+      --entry;
+    }
+  }
+}
+
+size_t JSValueFlatObject::HashIndexSlot(std::string_view propertyName) const noexcept {
+  return std::hash<std::string_view>{}(propertyName) & (m_hashIndex.size() - 1);
+}
+
+} // namespace winrt::Microsoft::ReactNative
@@ -0,0 +1,254 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// IMPORTANT: Before updating this file
+// please read react-native-windows repo:
+// vnext/Microsoft.ReactNative.Cxx/README.md
+
+#pragma once
+#ifndef MICROSOFT_REACTNATIVE_JSVALUEFLATOBJECT
+#define MICROSOFT_REACTNATIVE_JSVALUEFLATOBJECT
+
+#include "JSValue.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+//==============================================================================
+// JSValueFlatObject declaration.
+//==============================================================================
+
+//! JSValueFlatObject is a cache-friendly alternative to JSValueObject for small objects such as view props.
+//! Properties are kept in a contiguous array sorted by name, and the first InlineCapacity properties
+//! are stored inside of the object without a heap allocation.
+//! It iterates properties in the same order as JSValueObject.
+//! Objects with more than HashIndexThreshold properties maintain a hash index for the property lookup.
+//! Property names must not be changed through iterators because it breaks the sort order.
+struct JSValueFlatObject {
+  using key_type = std::string;
+  using mapped_type = JSValue;
+  using value_type = std::pair<std::string, JSValue>;
+  using size_type = size_t;
+  using iterator = value_type *;
+  using const_iterator = value_type const *;
+
+  //! Number of properties stored without a heap allocation.
+  static constexpr size_type InlineCapacity = 8;
+
+  //! Objects with more properties use a hash index for the property lookup.
+  static constexpr size_type HashIndexThreshold = 16;
+
+  //! Default constructor.
+  JSValueFlatObject() noexcept;
+
+  //! Move-construct JSValueFlatObject from the initializer list.
+  JSValueFlatObject(std::initializer_list<JSValueObjectKeyValue> initObject) noexcept;
+
+  //! Move-construct JSValueFlatObject from JSValueObject.
+  explicit JSValueFlatObject(JSValueObject &&other) noexcept;
+
+  //! Delete copy constructor to avoid unexpected copies. Use the Copy method instead.
+  JSValueFlatObject(JSValueFlatObject const &) = delete;
+
+  //! Move constructor.
+  JSValueFlatObject(JSValueFlatObject &&other) noexcept;
+
+  //! Delete copy assignment to avoid unexpected copies. Use the Copy method instead.
+  JSValueFlatObject &operator=(JSValueFlatObject const &) = delete;
+
+  //! Move assignment.
+  JSValueFlatObject &operator=(JSValueFlatObject &&other) noexcept;
+
+  //! Destructor.
+  ~JSValueFlatObject() noexcept;
+
+  //! Do a deep copy of JSValueFlatObject.
+  JSValueFlatObject Copy() const noexcept;
+
+  //! Move properties to a new JSValueObject. This JSValueFlatObject becomes empty.
+  JSValueObject MoveToObject() noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type capacity() const noexcept;
+  void reserve(size_type newCapacity) noexcept;
+  void clear() noexcept;
+
+  iterator begin() noexcept;
+  iterator end() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  //! Find property by name. It returns end() if the property is not found.
+  iterator find(std::string_view propertyName) noexcept;
+  const_iterator find(std::string_view propertyName) const noexcept;
+  size_type count(std::string_view propertyName) const noexcept;
+
+  //! Add a new property with value created from args if the property does not exist yet.
+  template <class... TArgs>
+  std::pair<iterator, bool> try_emplace(std::string_view propertyName, TArgs &&... args) noexcept;
+
+  //! Add a new property or replace value of the existing property.
+  template <class TValue>
+  std::pair<iterator, bool> insert_or_assign(std::string_view propertyName, TValue &&value) noexcept;
+
+  //! Remove property and return iterator to the next property.
+  iterator erase(const_iterator position) noexcept;
+
+  //! Remove property by name and return number of removed properties.
+  size_type erase(std::string_view propertyName) noexcept;
+
+  //! Return pointer to the property value if the property is found, or nullptr otherwise.
+  JSValue const *TryGetObjectProperty(std::string_view propertyName) const noexcept;
+
+  //! Get a reference to object property value if the property is found,
+  //! or a reference to a new property created with JSValue::Null value otherwise.
+  JSValue &operator[](std::string_view propertyName) noexcept;
+
+  //! Get a reference to object property value if the property is found,
+  //! or a reference to JSValue::Null otherwise.
+  JSValue const &operator[](std::string_view propertyName) const noexcept;
+
+  //! Return true if this JSValueFlatObject is strictly equal to other JSValueFlatObject.
+  //! Both objects must have the same set of equal properties.
+  //! Property values must be equal.
+  bool Equals(JSValueFlatObject const &other) const noexcept;
+
+  //! Return true if this JSValueFlatObject is strictly equal to other JSValueFlatObject
+  //! after their property values are converted to the same type.
+  //! See JSValue::JSEquals for details about the conversion.
+  bool JSEquals(JSValueFlatObject const &other) const noexcept;
+
+  //! Create JSValueFlatObject from IJSValueReader.
+  static JSValueFlatObject ReadFrom(IJSValueReader const &reader) noexcept;
+
+  //! Write this JSValueFlatObject to IJSValueWriter.
+  void WriteTo(IJSValueWriter const &writer) const noexcept;
+
+ private:
+  value_type *InlineData() noexcept;
+  bool IsInline() const noexcept;
+  size_type LowerBound(std::string_view propertyName) const noexcept;
+  size_type FindIndex(std::string_view propertyName) const noexcept;
+  iterator Insert(size_type index, std::string_view propertyName, JSValue &&value) noexcept;
+  void Append(std::string &&propertyName, JSValue &&value) noexcept;
+  void SortAndRemoveDuplicates() noexcept;
+  void Reallocate(size_type newCapacity) noexcept;
+  void MoveFrom(JSValueFlatObject &&other) noexcept;
+  void ReleaseStorage() noexcept;
+  void UpdateHashIndex() noexcept;
+  void InsertHashIndexEntry(size_type index) noexcept;
+  void RemoveHashIndexEntry(size_type index) noexcept;
+  size_t HashIndexSlot(std::string_view propertyName) const noexcept;
+
+ private:
+  value_type *m_data;
+  size_type m_size{0};
+  size_type m_capacity{InlineCapacity};
+
+  // Open addressing table with property index + 1. Zero marks an empty slot.
+  // It is empty while the object has no more than HashIndexThreshold properties.
+  std::vector<uint32_t> m_hashIndex;
+
+  alignas(value_type) unsigned char m_inlineStorage[InlineCapacity * sizeof(value_type)];
+};
+
+//! True if left.Equals(right)
+bool operator==(JSValueFlatObject const &left, JSValueFlatObject const &right) noexcept;
+
+//! True if !left.Equals(right)
+bool operator!=(JSValueFlatObject const &left, JSValueFlatObject const &right) noexcept;
+
+//===========================================================================
+// Inline JSValueFlatObject implementation.
+//===========================================================================
+
+inline bool JSValueFlatObject::empty() const noexcept {
+  return m_size == 0;
+}
+
+inline JSValueFlatObject::size_type JSValueFlatObject::size() const noexcept {
+  return m_size;
+}
+
+inline JSValueFlatObject::size_type JSValueFlatObject::capacity() const noexcept {
+  return m_capacity;
+}
+
+inline JSValueFlatObject::iterator JSValueFlatObject::begin() noexcept {
+  return m_data;
+}
+
+inline JSValueFlatObject::iterator JSValueFlatObject::end() noexcept {
+  return m_data + m_size;
+}
+
+inline JSValueFlatObject::const_iterator JSValueFlatObject::begin() const noexcept {
+  return m_data;
+}
+
+inline JSValueFlatObject::const_iterator JSValueFlatObject::end() const noexcept {
+  return m_data + m_size;
+}
+
+inline JSValueFlatObject::const_iterator JSValueFlatObject::cbegin() const noexcept {
+  return m_data;
+}
+
+inline JSValueFlatObject::const_iterator JSValueFlatObject::cend() const noexcept {
+  return m_data + m_size;
+}
+
+inline JSValueFlatObject::iterator JSValueFlatObject::find(std::string_view propertyName) noexcept {
+  return m_data + FindIndex(propertyName);
+}
+
+inline JSValueFlatObject::const_iterator JSValueFlatObject::find(std::string_view propertyName) const noexcept {
+  return m_data + FindIndex(propertyName);
+}
+
+inline JSValueFlatObject::size_type JSValueFlatObject::count(std::string_view propertyName) const noexcept {
+  return FindIndex(propertyName) != m_size ? 1 : 0;
+}
+
+template <class... TArgs>
+std::pair<JSValueFlatObject::iterator, bool> JSValueFlatObject::try_emplace(
+    std::string_view propertyName,
+    TArgs &&... args) noexcept {
+  size_type index = LowerBound(propertyName);
+  if (index != m_size && m_data[index].first == propertyName) {
+    return {m_data + index, false};
+  }
+
+  return {Insert(index, propertyName, JSValue{std::forward<TArgs>(args)...}), true};
+}
+
+template <class TValue>
+std::pair<JSValueFlatObject::iterator, bool> JSValueFlatObject::insert_or_assign(
+    std::string_view propertyName,
+    TValue &&value) noexcept {
+  size_type index = LowerBound(propertyName);
+  if (index != m_size && m_data[index].first == propertyName) {
+    m_data[index].second = JSValue{std::forward<TValue>(value)};
+    return {m_data + index, false};
+  }
+
+  return {Insert(index, propertyName, JSValue{std::forward<TValue>(value)}), true};
+}
+
+inline JSValue const *JSValueFlatObject::TryGetObjectProperty(std::string_view propertyName) const noexcept {
+  size_type index = FindIndex(propertyName);
+  return index != m_size ? &m_data[index].second : nullptr;
+}
+
+inline bool operator==(JSValueFlatObject const &left, JSValueFlatObject const &right) noexcept {
+  return left.Equals(right);
+}
+
+inline bool operator!=(JSValueFlatObject const &left, JSValueFlatObject const &right) noexcept {
+  return !left.Equals(right);
+}
+
+} // namespace winrt::Microsoft::ReactNative
+
+#endif // MICROSOFT_REACTNATIVE_JSVALUEFLATOBJECT
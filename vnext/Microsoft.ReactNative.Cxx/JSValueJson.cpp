@@ -0,0 +1,1076 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// IMPORTANT: Before updating this file
+// please read react-native-windows repo:
+// vnext/Microsoft.ReactNative.Cxx/README.md
+
+#include "pch.h"
+#include "JSValueJson.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define JSVALUEJSON_USE_SSE2
+#include <emmintrin.h>
+#elif defined(_M_ARM64) || defined(__ARM_NEON)
+#define JSVALUEJSON_USE_NEON
+#include <arm_neon.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace winrt::Microsoft::ReactNative {
+
+namespace {
+
+//===========================================================================
+// Block scanning
+//===========================================================================
+
+// The scanning functions check SimdBlockSize bytes at once and return the index of the first byte
+// that matches the condition or SimdBlockSize if there is no such byte. The caller must ensure that
+// SimdBlockSize bytes are readable.
+constexpr size_t SimdBlockSize = 16;
+
+#if defined(JSVALUEJSON_USE_SSE2) || defined(JSVALUEJSON_USE_NEON)
+
+size_t IndexOfFirstBit(uint64_t bits) noexcept {
+#ifdef _MSC_VER
+#if defined(_M_X64) || defined(_M_ARM64)
+  unsigned long index;
+  _BitScanForward64(&index, bits);
+  return index;
+#else
+  unsigned long index;
+  if (_BitScanForward(&index, static_cast<uint32_t>(bits))) {
+    return index;
+  }
+
+  _BitScanForward(&index, static_cast<uint32_t>(bits >> 32));
+  return index + 32;
+#endif
+#else
+  return static_cast<size_t>(__builtin_ctzll(bits));
+#endif
+}
+
+#endif
+
+#if defined(JSVALUEJSON_USE_SSE2)
+
+size_t IndexOfMatch(__m128i mask) noexcept {
+  uint32_t bits = static_cast<uint32_t>(_mm_movemask_epi8(mask));
+  return bits != 0 ? IndexOfFirstBit(bits) : SimdBlockSize;
+}
+
+// Index of a quote, a backslash, a control character, or a non-ASCII byte that needs the UTF-8 validation.
+size_t ScanParsedStringBlock(char const *data) noexcept {
+  __m128i chars = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data));
+  // The signed comparison matches the control characters and the non-ASCII bytes at once.
+  __m128i mask = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('"')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('\\'))),
+      _mm_cmplt_epi8(chars, _mm_set1_epi8(0x20)));
+  return IndexOfMatch(mask);
+}
+
+// Index of a quote, a backslash, or a control character that must be escaped.
+size_t ScanWrittenStringBlock(char const *data) noexcept {
+  __m128i chars = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data));
+  __m128i controlChars = _mm_set1_epi8(0x1F);
+  __m128i mask = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('"')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('\\'))),
+      _mm_cmpeq_epi8(_mm_min_epu8(chars, controlChars), chars));
+  return IndexOfMatch(mask);
+}
+
+// Index of a character that is not a JSON whitespace.
+size_t ScanWhitespaceBlock(char const *data) noexcept {
+  __m128i chars = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data));
+  __m128i mask = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('\n'))),
+      _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('\t'))));
+  return IndexOfMatch(_mm_xor_si128(mask, _mm_set1_epi8(-1)));
+}
+
+#elif defined(JSVALUEJSON_USE_NEON)
+
+size_t IndexOfMatch(uint8x16_t mask) noexcept {
+  // Narrow each 8-bit lane to 4 bits to get a 64-bit mask because NEON has no movemask instruction.
+  uint64_t bits = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(mask), 4)), 0);
+  return bits != 0 ? IndexOfFirstBit(bits) / 4 : SimdBlockSize;
+}
+
+size_t ScanParsedStringBlock(char const *data) noexcept {
+  uint8x16_t chars = vld1q_u8(reinterpret_cast<uint8_t const *>(data));
+  uint8x16_t mask = vorrq_u8(
+      vorrq_u8(vceqq_u8(chars, vdupq_n_u8('"')), vceqq_u8(chars, vdupq_n_u8('\\'))),
+      vorrq_u8(vcltq_u8(chars, vdupq_n_u8(0x20)), vcgeq_u8(chars, vdupq_n_u8(0x80))));
+  return IndexOfMatch(mask);
+}
+
+size_t ScanWrittenStringBlock(char const *data) noexcept {
+  uint8x16_t chars = vld1q_u8(reinterpret_cast<uint8_t const *>(data));
+  uint8x16_t mask = vorrq_u8(
+      vorrq_u8(vceqq_u8(chars, vdupq_n_u8('"')), vceqq_u8(chars, vdupq_n_u8('\\'))),
+      vcltq_u8(chars, vdupq_n_u8(0x20)));
+  return IndexOfMatch(mask);
+}
+
+size_t ScanWhitespaceBlock(char const *data) noexcept {
+  uint8x16_t chars = vld1q_u8(reinterpret_cast<uint8_t const *>(data));
+  uint8x16_t mask = vorrq_u8(
+      vorrq_u8(vceqq_u8(chars, vdupq_n_u8(' ')), vceqq_u8(chars, vdupq_n_u8('\n'))),
+      vorrq_u8(vceqq_u8(chars, vdupq_n_u8('\r')), vceqq_u8(chars, vdupq_n_u8('\t'))));
+  return IndexOfMatch(vmvnq_u8(mask));
+}
+
+#else
+
+bool IsParsedStringSpecialChar(char ch) noexcept {
+  return ch == '"' || ch == '\\' || static_cast<uint8_t>(ch) < 0x20 || static_cast<uint8_t>(ch) >= 0x80;
+}
+
+bool IsWrittenStringSpecialChar(char ch) noexcept {
+  return ch == '"' || ch == '\\' || static_cast<uint8_t>(ch) < 0x20;
+}
+
+bool IsWhitespace(char ch) noexcept {
+  return ch == ' ' || ch == '\n' || ch == '\r' || ch == '\t';
+}
+
+template <class TPredicate>
+size_t ScanBlock(char const *data, TPredicate &&predicate) noexcept {
+  for (size_t i = 0; i < SimdBlockSize; ++i) {
+    if (predicate(data[i])) {
+      return i;
+    }
+  }
+
+  return SimdBlockSize;
+}
+
+size_t ScanParsedStringBlock(char const *data) noexcept {
+  return ScanBlock(data, IsParsedStringSpecialChar);
+}
+
+size_t ScanWrittenStringBlock(char const *data) noexcept {
+  return ScanBlock(data, IsWrittenStringSpecialChar);
+}
+
+size_t ScanWhitespaceBlock(char const *data) noexcept {
+  return ScanBlock(data, [](char ch) noexcept { return !IsWhitespace(ch); });
+}
+
+#endif
+
+// Skip characters in blocks while the scan function finds nothing and then one by one.
+template <class TScanBlock, class TIsStopChar>
+char const *ScanChars(char const *current, char const *end, TScanBlock &&scanBlock, TIsStopChar &&isStopChar) noexcept {
+  while (end - current >= static_cast<ptrdiff_t>(SimdBlockSize)) {
+    size_t index = scanBlock(current);
+    if (index < SimdBlockSize) {
+      return current + index;
+    }
+
+    current += SimdBlockSize;
+  }
+
+  while (current < end && !isStopChar(*current)) {
+    ++current;
+  }
+
+  return current;
+}
+
+//===========================================================================
+// UTF-8 helpers
+//===========================================================================
+
+// Return the length of a valid UTF-8 sequence that starts with a non-ASCII byte, or 0 if it is invalid.
+// It rejects overlong sequences, surrogates, and code points above U+10FFFF as RFC 3629 requires.
+size_t GetUtf8SequenceLength(char const *current, char const *end) noexcept {
+  auto byteAt = [current](size_t index) noexcept { return static_cast<uint8_t>(current[index]); };
+  auto isContinuation = [](uint8_t byte) noexcept { return (byte & 0xC0) == 0x80; };
+
+  size_t available = static_cast<size_t>(end - current);
+  uint8_t lead = byteAt(0);
+  if (lead >= 0xC2 && lead <= 0xDF) {
+    return (available >= 2 && isContinuation(byteAt(1))) ? 2 : 0;
+  } else if (lead >= 0xE0 && lead <= 0xEF) {
+    if (available < 3 || !isContinuation(byteAt(1)) || !isContinuation(byteAt(2))) {
+      return 0;
+    }
+
+    uint8_t second = byteAt(1);
+    return (lead == 0xE0 && second < 0xA0) || (lead == 0xED && second > 0x9F) ? 0 : 3;
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    if (available < 4 || !isContinuation(byteAt(1)) || !isContinuation(byteAt(2)) || !isContinuation(byteAt(3))) {
+      return 0;
+    }
+
+    uint8_t second = byteAt(1);
+    return (lead == 0xF0 && second < 0x90) || (lead == 0xF4 && second > 0x8F) ? 0 : 4;
+  }
+
+  return 0;
+}
+
+size_t EncodeUtf8(uint32_t codePoint, char *buffer) noexcept {
+  if (codePoint < 0x80) {
+    buffer[0] = static_cast<char>(codePoint);
+    return 1;
+  } else if (codePoint < 0x800) {
+    buffer[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+    buffer[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+    return 2;
+  } else if (codePoint < 0x10000) {
+    buffer[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+    buffer[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+    buffer[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+    return 3;
+  } else {
+    buffer[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+    buffer[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+    buffer[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+    buffer[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+    return 4;
+  }
+}
+
+//===========================================================================
+// JsonParser implementation
+//===========================================================================
+
+// Containers nested deeper than this are rejected to protect the stack from malicious input.
+constexpr size_t JsonMaxDepth = 512;
+
+// JSON parser that reports the parsed tokens to a sink. The sink has the same methods as IJSValueWriter,
+// but strings are passed as UTF-8 string views that are valid only during the call.
+template <class TSink>
+struct JsonParser {
+  JsonParser(char const *data, size_t size, bool isInPlace, TSink &sink) noexcept
+      : m_begin{data}, m_current{data}, m_end{data + size}, m_isInPlace{isInPlace}, m_sink{sink} {}
+
+  bool Parse(JSValueJsonError *error) noexcept {
+    bool isParsed = SkipWhitespace() && ParseValue(0) && SkipWhitespace() &&
+        (m_current == m_end || Fail("Unexpected data after the JSON value"));
+    if (!isParsed && error) {
+      *error = m_error;
+    }
+
+    return isParsed;
+  }
+
+ private:
+  bool Fail(char const *message) noexcept {
+    return Fail(m_current, message);
+  }
+
+  bool Fail(char const *position, char const *message) noexcept {
+    m_error.Offset = static_cast<size_t>(position - m_begin);
+    m_error.Message = message;
+    return false;
+  }
+
+  bool FailUnexpected() noexcept {
+    return Fail(m_current == m_end ? "Unexpected end of JSON text" : "Unexpected character");
+  }
+
+  // Always returns true to allow chaining with other parsing steps.
+  bool SkipWhitespace() noexcept {
+    // Most JSON texts are either minified or indented, so check the first character before scanning.
+    if (m_current < m_end && static_cast<uint8_t>(*m_current) > ' ') {
+      return true;
+    }
+
+    m_current = ScanChars(m_current, m_end, ScanWhitespaceBlock, [](char ch) noexcept {
+      return ch != ' ' && ch != '\n' && ch != '\r' && ch != '\t';
+    });
+    return true;
+  }
+
+  bool SkipChar(char ch) noexcept {
+    if (m_current < m_end && *m_current == ch) {
+      ++m_current;
+      return true;
+    }
+
+    return false;
+  }
+
+  bool ParseValue(size_t depth) noexcept {
+    if (m_current == m_end) {
+      return FailUnexpected();
+    }
+
+    switch (*m_current) {
+      case '{':
+        return ParseObject(depth);
+      case '[':
+        return ParseArray(depth);
+      case '"': {
+        std::string_view value;
+        return ParseString(value) && (m_sink.WriteString(value), true);
+      }
+      case 't':
+        return ParseLiteral("true") && (m_sink.WriteBoolean(true), true);
+      case 'f':
+        return ParseLiteral("false") && (m_sink.WriteBoolean(false), true);
+      case 'n':
+        return ParseLiteral("null") && (m_sink.WriteNull(), true);
+      default:
+        return ParseNumber();
+    }
+  }
+
+  bool ParseObject(size_t depth) noexcept {
+    if (depth >= JsonMaxDepth) {
+      return Fail("JSON nesting is too deep");
+    }
+
+    ++m_current;
+    m_sink.WriteObjectBegin();
+    if (SkipWhitespace() && SkipChar('}')) {
+      m_sink.WriteObjectEnd();
+      return true;
+    }
+
+    do {
+      std::string_view propertyName;
+      if (!SkipWhitespace() || m_current == m_end || *m_current != '"') {
+        return FailUnexpected();
+      }
+
+      if (!ParseString(propertyName)) {
+        return false;
+      }
+
+      m_sink.WritePropertyName(propertyName);
+      if (!SkipWhitespace() || !SkipChar(':')) {
+        return FailUnexpected();
+      }
+
+      if (!SkipWhitespace() || !ParseValue(depth + 1) || !SkipWhitespace()) {
+        return false;
+      }
+    } while (SkipChar(','));
+
+    if (!SkipChar('}')) {
+      return FailUnexpected();
+    }
+
+    m_sink.WriteObjectEnd();
+    return true;
+  }
+
+  bool ParseArray(size_t depth) noexcept {
+    if (depth >= JsonMaxDepth) {
+      return Fail("JSON nesting is too deep");
+    }
+
+    ++m_current;
+    m_sink.WriteArrayBegin();
+    if (SkipWhitespace() && SkipChar(']')) {
+      m_sink.WriteArrayEnd();
+      return true;
+    }
+
+    do {
+      if (!SkipWhitespace() || !ParseValue(depth + 1) || !SkipWhitespace()) {
+        return false;
+      }
+    } while (SkipChar(','));
+
+    if (!SkipChar(']')) {
+      return FailUnexpected();
+    }
+
+    m_sink.WriteArrayEnd();
+    return true;
+  }
+
+  bool ParseLiteral(std::string_view literal) noexcept {
+    if (static_cast<size_t>(m_end - m_current) < literal.size() ||
+        std::memcmp(m_current, literal.data(), literal.size()) != 0) {
+      return Fail("Invalid literal");
+    }
+
+    m_current += literal.size();
+    return true;
+  }
+
+  bool ParseNumber() noexcept {
+    auto isDigit = [this]() noexcept { return m_current < m_end && '0' <= *m_current && *m_current <= '9'; };
+
+    char const *start = m_current;
+    bool isNegative = SkipChar('-');
+    if (!isDigit()) {
+      return FailUnexpected();
+    }
+
+    // Accumulate up to 18 digits that always fit into uint64_t without overflow.
+    uint64_t integer = 0;
+    size_t digitCount = 0;
+    if (*m_current == '0') {
+      ++m_current;
+      digitCount = 1;
+    } else {
+      for (; isDigit(); ++m_current, ++digitCount) {
+        if (digitCount < 18) {
+          integer = integer * 10 + static_cast<uint64_t>(*m_current - '0');
+        }
+      }
+    }
+
+    bool isInteger = true;
+    if (SkipChar('.')) {
+      isInteger = false;
+      if (!isDigit()) {
+        return FailUnexpected();
+      }
+
+      while (isDigit()) {
+        ++m_current;
+      }
+    }
+
+    if (m_current < m_end && (*m_current == 'e' || *m_current == 'E')) {
+      isInteger = false;
+      ++m_current;
+      if (!SkipChar('+')) {
+        SkipChar('-');
+      }
+
+      if (!isDigit()) {
+        return FailUnexpected();
+      }
+
+      while (isDigit()) {
+        ++m_current;
+      }
+    }
+
+    // Keep -0 as a Double to preserve the sign the same way as JSON.parse does.
+    if (isInteger && !(isNegative && integer == 0)) {
+      if (digitCount <= 18) {
+        m_sink.WriteInt64(isNegative ? -static_cast<int64_t>(integer) : static_cast<int64_t>(integer));
+        return true;
+      }
+
+      int64_t value;
+      auto result = std::from_chars(start, m_current, value);
+      if (result.ec == std::errc{} && result.ptr == m_current) {
+        m_sink.WriteInt64(value);
+        return true;
+      }
+    }
+
+    double value;
+    auto result = std::from_chars(start, m_current, value);
+    if (result.ec == std::errc::result_out_of_range) {
+      // Follow JSON.parse that returns Infinity or 0 for numbers out of the Double range.
+      value = std::strtod(std::string{start, m_current}.c_str(), nullptr);
+    } else if (result.ec != std::errc{} || result.ptr != m_current) {
+      return Fail(start, "Invalid number");
+    }
+
+    m_sink.WriteDouble(value);
+    return true;
+  }
+
+  bool ParseString(std::string_view &value) noexcept {
+    char const *start = ++m_current;
+    for (;;) {
+      m_current = ScanStringChars(m_current);
+      if (m_current == m_end) {
+        return Fail("Unterminated string");
+      }
+
+      char ch = *m_current;
+      if (ch == '"') {
+        value = std::string_view{start, static_cast<size_t>(m_current - start)};
+        ++m_current;
+        return true;
+      } else if (ch == '\\') {
+        return ParseEscapedString(start, value);
+      } else if (!SkipUnescapedChar()) {
+        return false;
+      }
+    }
+  }
+
+  // Continue parsing a string that has escape sequences. The decoded string is written to the scratch buffer
+  // or in the in-place mode to the JSON buffer itself because the decoded string is never longer than its source.
+  bool ParseEscapedString(char const *start, std::string_view &value) noexcept {
+    char *inPlaceBegin = const_cast<char *>(start);
+    char *inPlaceEnd = const_cast<char *>(m_current);
+    if (!m_isInPlace) {
+      m_scratch.assign(start, m_current);
+    }
+
+    auto append = [this, &inPlaceEnd](char const *data, size_t size) noexcept {
+      if (m_isInPlace) {
+        std::memmove(inPlaceEnd, data, size);
+        inPlaceEnd += size;
+      } else {
+        m_scratch.append(data, size);
+      }
+    };
+
+    for (;;) {
+      char ch = *m_current;
+      if (ch == '"') {
+        value = m_isInPlace ? std::string_view{inPlaceBegin, static_cast<size_t>(inPlaceEnd - inPlaceBegin)}
+                            : std::string_view{m_scratch};
+        ++m_current;
+        return true;
+      } else if (ch == '\\') {
+        char buffer[4];
+        size_t size = 0;
+        if (!ParseEscapeSequence(buffer, size)) {
+          return false;
+        }
+
+        append(buffer, size);
+      } else {
+        char const *runStart = m_current;
+        if ((static_cast<uint8_t>(ch) < 0x20 || static_cast<uint8_t>(ch) >= 0x80) && !SkipUnescapedChar()) {
+          return false;
+        }
+
+        m_current = ScanStringChars(m_current);
+        append(runStart, static_cast<size_t>(m_current - runStart));
+      }
+
+      if (m_current == m_end) {
+        return Fail("Unterminated string");
+      }
+    }
+  }
+
+  // Skip characters that do not need special handling.
+  char const *ScanStringChars(char const *current) noexcept {
+    return ScanChars(current, m_end, ScanParsedStringBlock, [](char ch) noexcept {
+      return ch == '"' || ch == '\\' || static_cast<uint8_t>(ch) < 0x20 || static_cast<uint8_t>(ch) >= 0x80;
+    });
+  }
+
+  // Skip a non-ASCII UTF-8 sequence found by the string scan. Control characters must be escaped in JSON strings.
+  bool SkipUnescapedChar() noexcept {
+    if (static_cast<uint8_t>(*m_current) < 0x20) {
+      return Fail("Control character in string");
+    }
+
+    size_t length = GetUtf8SequenceLength(m_current, m_end);
+    if (length == 0) {
+      return Fail("Invalid UTF-8 sequence");
+    }
+
+    m_current += length;
+    return true;
+  }
+
+  bool ParseEscapeSequence(char (&buffer)[4], size_t &size) noexcept {
+    char const *escapeStart = m_current++;
+    if (m_current == m_end) {
+      return Fail("Unterminated string");
+    }
+
+    char ch = *m_current++;
+    size = 1;
+    switch (ch) {
+      case '"':
+      case '\\':
+      case '/':
+        buffer[0] = ch;
+        return true;
+      case 'b':
+        buffer[0] = '\b';
+        return true;
+      case 'f':
+        buffer[0] = '\f';
+        return true;
+      case 'n':
+        buffer[0] = '\n';
+        return true;
+      case 'r':
+        buffer[0] = '\r';
+        return true;
+      case 't':
+        buffer[0] = '\t';
+        return true;
+      case 'u':
+        break;
+      default:
+        return Fail(escapeStart, "Invalid escape sequence");
+    }
+
+    uint32_t codePoint;
+    if (!ParseHex4(codePoint)) {
+      return Fail(escapeStart, "Invalid escape sequence");
+    }
+
+    if (0xD800 <= codePoint && codePoint <= 0xDBFF) {
+      // Combine a surrogate pair. A lone surrogate cannot be represented in UTF-8 and becomes U+FFFD.
+      char const *lowSurrogateStart = m_current;
+      uint32_t lowSurrogate = 0;
+      bool isPair = m_end - m_current >= 6 && m_current[0] == '\\' && m_current[1] == 'u';
+      if (isPair) {
+        m_current += 2;
+        isPair = ParseHex4(lowSurrogate) && 0xDC00 <= lowSurrogate && lowSurrogate <= 0xDFFF;
+      }
+
+      if (isPair) {
+        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+      } else {
+        m_current = lowSurrogateStart;
+        codePoint = 0xFFFD;
+      }
+    } else if (0xDC00 <= codePoint && codePoint <= 0xDFFF) {
+      codePoint = 0xFFFD;
+    }
+
+    size = EncodeUtf8(codePoint, buffer);
+    return true;
+  }
+
+  bool ParseHex4(uint32_t &value) noexcept {
+    if (m_end - m_current < 4) {
+      return false;
+    }
+
+    value = 0;
+    for (int i = 0; i < 4; ++i) {
+      char ch = *m_current++;
+      uint32_t digit;
+      if ('0' <= ch && ch <= '9') {
+        digit = static_cast<uint32_t>(ch - '0');
+      } else if ('a' <= ch && ch <= 'f') {
+        digit = static_cast<uint32_t>(ch - 'a' + 10);
+      } else if ('A' <= ch && ch <= 'F') {
+        digit = static_cast<uint32_t>(ch - 'A' + 10);
+      } else {
+        return false;
+      }
+
+      value = (value << 4) | digit;
+    }
+
+    return true;
+  }
+
+ private:
+  char const *const m_begin;
+  char const *m_current;
+  char const *const m_end;
+  bool const m_isInPlace;
+  TSink &m_sink;
+  std::string m_scratch;
+  JSValueJsonError m_error;
+};
+
+// Builds JSValue directly from the parsed tokens.
+struct JSValueJsonSink {
+  JSValueJsonSink(JSValue &root) noexcept : m_root{root} {}
+
+  void WriteNull() noexcept {
+    WriteValue(JSValue{});
+  }
+
+  void WriteBoolean(bool value) noexcept {
+    WriteValue(JSValue{value});
+  }
+
+  void WriteInt64(int64_t value) noexcept {
+    WriteValue(JSValue{value});
+  }
+
+  void WriteDouble(double value) noexcept {
+    WriteValue(JSValue{value});
+  }
+
+  void WriteString(std::string_view value) noexcept {
+    WriteValue(JSValue{std::string{value}});
+  }
+
+  void WriteObjectBegin() noexcept {
+    PushContainer(JSValueType::Object);
+  }
+
+  void WritePropertyName(std::string_view name) noexcept {
+    m_containers[m_depth - 1].PropertyName.assign(name);
+  }
+
+  void WriteObjectEnd() noexcept {
+    JSValue value{std::move(m_containers[--m_depth].Object)};
+    WriteValue(std::move(value));
+  }
+
+  void WriteArrayBegin() noexcept {
+    PushContainer(JSValueType::Array);
+  }
+
+  void WriteArrayEnd() noexcept {
+    JSValue value{std::move(m_containers[--m_depth].Array)};
+    WriteValue(std::move(value));
+  }
+
+ private:
+  struct ContainerInfo {
+    JSValueType Type{JSValueType::Null};
+    JSValueObject Object;
+    JSValueArray Array;
+    std::string PropertyName;
+  };
+
+ private:
+  // The container entries are reused for containers at the same depth.
+  void PushContainer(JSValueType type) noexcept {
+    if (m_depth == m_containers.size()) {
+      m_containers.emplace_back();
+    }
+
+    auto &container = m_containers[m_depth++];
+    container.Type = type;
+    container.Object.clear();
+    container.Array.clear();
+  }
+
+  void WriteValue(JSValue &&value) noexcept {
+    if (m_depth == 0) {
+      m_root = std::move(value);
+      return;
+    }
+
+    auto &top = m_containers[m_depth - 1];
+    if (top.Type == JSValueType::Object) {
+      top.Object.insert_or_assign(std::move(top.PropertyName), std::move(value));
+    } else {
+      top.Array.push_back(std::move(value));
+    }
+  }
+
+ private:
+  JSValue &m_root;
+  std::vector<ContainerInfo> m_containers;
+  size_t m_depth{0};
+};
+
+// Passes the parsed tokens to IJSValueWriter.
+struct JSValueWriterJsonSink {
+  JSValueWriterJsonSink(IJSValueWriter const &writer) noexcept : m_writer{writer} {}
+
+  void WriteNull() noexcept {
+    m_writer.WriteNull();
+  }
+
+  void WriteBoolean(bool value) noexcept {
+    m_writer.WriteBoolean(value);
+  }
+
+  void WriteInt64(int64_t value) noexcept {
+    m_writer.WriteInt64(value);
+  }
+
+  void WriteDouble(double value) noexcept {
+    m_writer.WriteDouble(value);
+  }
+
+  void WriteString(std::string_view value) noexcept {
+    m_writer.WriteString(to_hstring(value));
+  }
+
+  void WriteObjectBegin() noexcept {
+    m_writer.WriteObjectBegin();
+  }
+
+  void WritePropertyName(std::string_view name) noexcept {
+    m_writer.WritePropertyName(to_hstring(name));
+  }
+
+  void WriteObjectEnd() noexcept {
+    m_writer.WriteObjectEnd();
+  }
+
+  void WriteArrayBegin() noexcept {
+    m_writer.WriteArrayBegin();
+  }
+
+  void WriteArrayEnd() noexcept {
+    m_writer.WriteArrayEnd();
+  }
+
+ private:
+  IJSValueWriter const &m_writer;
+};
+
+//===========================================================================
+// JSON writing helpers
+//===========================================================================
+
+void WriteJsonString(std::string &json, std::string_view value) noexcept {
+  static constexpr char HexDigits[] = "0123456789abcdef";
+
+  json.push_back('"');
+  char const *current = value.data();
+  char const *end = current + value.size();
+  for (;;) {
+    char const *runStart = current;
+    current = ScanChars(current, end, ScanWrittenStringBlock, [](char ch) noexcept {
+      return ch == '"' || ch == '\\' || static_cast<uint8_t>(ch) < 0x20;
+    });
+    json.append(runStart, current);
+    if (current == end) {
+      break;
+    }
+
+    char ch = *current++;
+    switch (ch) {
+      case '"':
+        json.append("\\\"");
+        break;
+      case '\\':
+        json.append("\\\\");
+        break;
+      case '\b':
+        json.append("\\b");
+        break;
+      case '\f':
+        json.append("\\f");
+        break;
+      case '\n':
+        json.append("\\n");
+        break;
+      case '\r':
+        json.append("\\r");
+        break;
+      case '\t':
+        json.append("\\t");
+        break;
+      default: {
+        char escape[] = {'\\', 'u', '0', '0', HexDigits[(ch >> 4) & 0xF], HexDigits[ch & 0xF]};
+        json.append(escape, sizeof(escape));
+        break;
+      }
+    }
+  }
+
+  json.push_back('"');
+}
+
+void WriteJsonString(std::string &json, std::wstring_view value) noexcept {
+  // Most strings are ASCII and can be written without the UTF-8 conversion.
+  if (std::all_of(value.begin(), value.end(), [](wchar_t ch) noexcept { return ch < 0x80; })) {
+    std::string ascii;
+    ascii.reserve(value.size());
+    for (wchar_t ch : value) {
+      ascii.push_back(static_cast<char>(ch));
+    }
+
+    WriteJsonString(json, std::string_view{ascii});
+  } else {
+    WriteJsonString(json, std::string_view{to_string(value)});
+  }
+}
+
+void WriteJsonInt64(std::string &json, int64_t value) noexcept {
+  char buffer[24];
+  auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+  json.append(buffer, result.ptr);
+}
+
+void WriteJsonDouble(std::string &json, double value) noexcept {
+  if (!std::isfinite(value)) {
+    json.append("null");
+    return;
+  }
+
+  // The shortest representation that is parsed back to the same value.
+  char buffer[32];
+  auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+  json.append(buffer, result.ptr);
+}
+
+void WriteJsonValue(std::string &json, JSValue const &value) noexcept {
+  switch (value.Type()) {
+    case JSValueType::Null:
+      json.append("null");
+      break;
+    case JSValueType::Object: {
+      json.push_back('{');
+      bool isFirst = true;
+      for (auto const &property : value.AsObject()) {
+        if (!isFirst) {
+          json.push_back(',');
+        }
+
+        isFirst = false;
+        WriteJsonString(json, std::string_view{property.first});
+        json.push_back(':');
+        WriteJsonValue(json, property.second);
+      }
+
+      json.push_back('}');
+      break;
+    }
+    case JSValueType::Array: {
+      json.push_back('[');
+      bool isFirst = true;
+      for (auto const &item : value.AsArray()) {
+        if (!isFirst) {
+          json.push_back(',');
+        }
+
+        isFirst = false;
+        WriteJsonValue(json, item);
+      }
+
+      json.push_back(']');
+      break;
+    }
+    case JSValueType::String:
+      WriteJsonString(json, std::string_view{*value.TryGetString()});
+      break;
+    case JSValueType::Boolean:
+      json.append(*value.TryGetBoolean() ? "true" : "false");
+      break;
+    case JSValueType::Int64:
+      WriteJsonInt64(json, *value.TryGetInt64());
+      break;
+    case JSValueType::Double:
+      WriteJsonDouble(json, *value.TryGetDouble());
+      break;
+  }
+}
+
+} // namespace
+
+//===========================================================================
+// JSON parsing and serialization functions
+//===========================================================================
+
+bool TryParseJson(std::string_view json, JSValue &value, JSValueJsonError *error) noexcept {
+  JSValue result;
+  JSValueJsonSink sink{result};
+  if (!JsonParser<JSValueJsonSink>{json.data(), json.size(), /*isInPlace:*/ false, sink}.Parse(error)) {
+    return false;
+  }
+
+  value = std::move(result);
+  return true;
+}
+
+bool TryParseJsonInPlace(std::string &json, JSValue &value, JSValueJsonError *error) noexcept {
+  JSValue result;
+  JSValueJsonSink sink{result};
+  if (!JsonParser<JSValueJsonSink>{json.data(), json.size(), /*isInPlace:*/ true, sink}.Parse(error)) {
+    return false;
+  }
+
+  value = std::move(result);
+  return true;
+}
+
+bool TryParseJson(std::string_view json, IJSValueWriter const &writer, JSValueJsonError *error) noexcept {
+  JSValueWriterJsonSink sink{writer};
+  return JsonParser<JSValueWriterJsonSink>{json.data(), json.size(), /*isInPlace:*/ false, sink}.Parse(error);
+}
+
+void WriteJson(std::string &json, JSValue const &value) noexcept {
+  WriteJsonValue(json, value);
+}
+
+std::string ToJson(JSValue const &value) noexcept {
+  std::string json;
+  WriteJsonValue(json, value);
+  return json;
+}
+
+//===========================================================================
+// JSValueJsonWriter implementation
+//===========================================================================
+
+JSValueJsonWriter::JSValueJsonWriter() noexcept {}
+
+std::string JSValueJsonWriter::TakeJson() noexcept {
+  return std::move(m_json);
+}
+
+void JSValueJsonWriter::WriteNull() noexcept {
+  WriteSeparator();
+  m_json.append("null");
+}
+
+void JSValueJsonWriter::WriteBoolean(bool value) noexcept {
+  WriteSeparator();
+  m_json.append(value ? "true" : "false");
+}
+
+void JSValueJsonWriter::WriteInt64(int64_t value) noexcept {
+  WriteSeparator();
+  WriteJsonInt64(m_json, value);
+}
+
+void JSValueJsonWriter::WriteDouble(double value) noexcept {
+  WriteSeparator();
+  WriteJsonDouble(m_json, value);
+}
+
+void JSValueJsonWriter::WriteString(const winrt::hstring &value) noexcept {
+  WriteSeparator();
+  WriteJsonString(m_json, std::wstring_view{value});
+}
+
+void JSValueJsonWriter::WriteObjectBegin() noexcept {
+  WriteSeparator();
+  m_json.push_back('{');
+  m_needsComma = false;
+}
+
+void JSValueJsonWriter::WritePropertyName(const winrt::hstring &name) noexcept {
+  WriteSeparator();
+  WriteJsonString(m_json, std::wstring_view{name});
+  m_json.push_back(':');
+  m_needsComma = false;
+}
+
+void JSValueJsonWriter::WriteObjectEnd() noexcept {
+  m_json.push_back('}');
+  m_needsComma = true;
+}
+
+void JSValueJsonWriter::WriteArrayBegin() noexcept {
+  WriteSeparator();
+  m_json.push_back('[');
+  m_needsComma = false;
+}
+
+void JSValueJsonWriter::WriteArrayEnd() noexcept {
+  m_json.push_back(']');
+  m_needsComma = true;
+}
+
+// Write a comma before the next array item or property. Property values follow the property name without it.
+void JSValueJsonWriter::WriteSeparator() noexcept {
+  if (m_needsComma) {
+    m_json.push_back(',');
+  }
+
+  m_needsComma = true;
+}
+
+IJSValueWriter MakeJSValueJsonWriter() noexcept {
+  return make<JSValueJsonWriter>();
+}
+
+std::string TakeJson(IJSValueWriter const &writer) noexcept {
+  return get_self<JSValueJsonWriter>(writer)->TakeJson();
+}
+
+} // namespace winrt::Microsoft::ReactNative
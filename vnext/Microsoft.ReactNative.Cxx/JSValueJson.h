@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// IMPORTANT: Before updating this file
+// please read react-native-windows repo:
+// vnext/Microsoft.ReactNative.Cxx/README.md
+
+#pragma once
+#ifndef MICROSOFT_REACTNATIVE_JSVALUEJSON
+#define MICROSOFT_REACTNATIVE_JSVALUEJSON
+
+#include <string>
+#include <string_view>
+#include "JSValue.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+//==============================================================================
+// JSON parsing and serialization for JSValue.
+//==============================================================================
+//
+// The parser reads UTF-8 JSON text as defined by RFC 8259 and builds JSValue directly without
+// an intermediate representation. It validates UTF-8 in strings and rejects invalid input instead of crashing.
+// Strings and whitespace are scanned 16 bytes at a time with SSE2 on x86 and x64, and with NEON on ARM64.
+//
+// Numbers without a fraction and an exponent that fit into int64_t are parsed as Int64 values.
+// Other numbers are parsed as Double values. Duplicate property names keep the last value as JSON.parse does.
+
+//! Describes where and why the JSON parsing has failed.
+struct JSValueJsonError {
+  //! Offset of the byte in the JSON text where the error was found.
+  size_t Offset{0};
+
+  //! Static error description.
+  char const *Message{nullptr};
+};
+
+//! Parse UTF-8 JSON text to JSValue.
+//! It returns false and sets the optional error if the text is not a valid JSON.
+bool TryParseJson(std::string_view json, JSValue &value, JSValueJsonError *error = nullptr) noexcept;
+
+//! Parse UTF-8 JSON text to JSValue in the in-place mode.
+//! String escape sequences are decoded inside of the json buffer instead of a temporary buffer.
+//! The json content is undefined after the call.
+bool TryParseJsonInPlace(std::string &json, JSValue &value, JSValueJsonError *error = nullptr) noexcept;
+
+//! Parse UTF-8 JSON text in the streaming mode: the parsed tokens are written to the writer as soon as they are read.
+//! It returns false and sets the optional error if the text is not a valid JSON.
+//! In case of an error the writer may have received an incomplete value.
+bool TryParseJson(std::string_view json, IJSValueWriter const &writer, JSValueJsonError *error = nullptr) noexcept;
+
+//! Append JSON text for the value to the json string.
+//! The NaN and Infinity Double values are written as null the same way as JSON.stringify does.
+void WriteJson(std::string &json, JSValue const &value) noexcept;
+
+//! Convert JSValue to JSON text.
+std::string ToJson(JSValue const &value) noexcept;
+
+//==============================================================================
+// JSValueJsonWriter declaration.
+//==============================================================================
+
+//! IJSValueWriter that writes JSON text in the streaming mode.
+struct JSValueJsonWriter : implements<JSValueJsonWriter, IJSValueWriter> {
+  JSValueJsonWriter() noexcept;
+
+  //! Take the written JSON text. The writer must not be used after that.
+  std::string TakeJson() noexcept;
+
+ public: // IJSValueWriter
+  void WriteNull() noexcept;
+  void WriteBoolean(bool value) noexcept;
+  void WriteInt64(int64_t value) noexcept;
+  void WriteDouble(double value) noexcept;
+  void WriteString(const winrt::hstring &value) noexcept;
+  void WriteObjectBegin() noexcept;
+  void WritePropertyName(const winrt::hstring &name) noexcept;
+  void WriteObjectEnd() noexcept;
+  void WriteArrayBegin() noexcept;
+  void WriteArrayEnd() noexcept;
+
+ private:
+  void WriteSeparator() noexcept;
+
+ private:
+  std::string m_json;
+  bool m_needsComma{false};
+};
+
+//! Create IJSValueWriter that writes JSON text.
+IJSValueWriter MakeJSValueJsonWriter() noexcept;
+
+//! Take the JSON text from the IJSValueWriter created by MakeJSValueJsonWriter.
+std::string TakeJson(IJSValueWriter const &writer) noexcept;
+
+} // namespace winrt::Microsoft::ReactNative
+
+#endif // MICROSOFT_REACTNATIVE_JSVALUEJSON
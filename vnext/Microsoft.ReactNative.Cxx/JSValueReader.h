@@ -395,28 +395,40 @@ inline void ReadValue(IJSValueReader const &reader, /*out*/ std::tuple<Ts...> &v
 }
 
 inline void ReadValue(IJSValueReader const &reader, /*out*/ JSValue &value) noexcept {
-  value = JSValue::ReadFrom(reader);
+  if (!TryReadBinaryValue(reader, /*out*/ value)) {
+    value = JSValue::ReadFrom(reader);
+  }
 }
 
 inline void ReadValue(IJSValueReader const &reader, /*out*/ JSValueObject &value) noexcept {
-  value = JSValueObject::ReadFrom(reader);
+  JSValue jsValue;
+  value = TryReadBinaryValue(reader, /*out*/ jsValue) ? jsValue.MoveObject() : JSValueObject::ReadFrom(reader);
 }
 
 inline void ReadValue(IJSValueReader const &reader, /*out*/ JSValueArray &value) noexcept {
-  value = JSValueArray::ReadFrom(reader);
+  JSValue jsValue;
+  value = TryReadBinaryValue(reader, /*out*/ jsValue) ? jsValue.MoveArray() : JSValueArray::ReadFrom(reader);
 }
 
 template <class T, std::enable_if_t<!std::is_void_v<decltype(GetStructInfo(static_cast<T *>(nullptr)))>, int>>
 inline void ReadValue(IJSValueReader const &reader, /*out*/ T &value) noexcept {
   if (reader.ValueType() == JSValueType::Object) {
-    const auto &fieldMap = StructInfo<T>::FieldMap;
     hstring propertyName;
-    while (reader.GetNextObjectProperty(/*out*/ propertyName)) {
-      auto it = fieldMap.find(std::wstring_view(propertyName));
-      if (it != fieldMap.end()) {
-        it->second.ReadField(reader, &value);
-      } else {
-        SkipValue<JSValue>(reader); // Skip this property
+    if constexpr (HasStructFieldTable<T>) {
+      while (reader.GetNextObjectProperty(/*out*/ propertyName)) {
+        if (!StructFieldTable<T>::ReadField(reader, propertyName, value)) {
+          SkipValue<JSValue>(reader); // Skip this property
+        }
+      }
+    } else {
+      const auto &fieldMap = StructInfo<T>::FieldMap;
+      while (reader.GetNextObjectProperty(/*out*/ propertyName)) {
+        auto it = fieldMap.find(std::wstring_view(propertyName));
+        if (it != fieldMap.end()) {
+          it->second.ReadField(reader, &value);
+        } else {
+          SkipValue<JSValue>(reader); // Skip this property
+        }
       }
     }
   }
@@ -6,6 +6,7 @@
 
 #include "pch.h"
 #include "JSValueTreeReader.h"
+#include "JSValueBinary.h"
 
 namespace winrt::Microsoft::ReactNative {
 
@@ -124,6 +125,19 @@ double JSValueTreeReader::GetDouble() noexcept {
   return d ? *d : 0;
 }
 
+com_array<uint8_t> JSValueTreeReader::ReadBinaryValue() noexcept {
+  std::vector<uint8_t> buffer;
+  JSValueBinaryEncoder encoder{buffer};
+  m_current->WriteTo(encoder);
+
+  // The current object or array is read as if all its items were visited.
+  if (!m_isInContainer) {
+    m_isInContainer = !m_stack.empty();
+  }
+
+  return com_array<uint8_t>(buffer.begin(), buffer.end());
+}
+
 IJSValueReader MakeJSValueTreeReader(const JSValue &root) noexcept {
   return make<JSValueTreeReader>(root);
 }
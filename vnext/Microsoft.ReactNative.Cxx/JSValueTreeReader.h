@@ -12,7 +12,7 @@
 
 namespace winrt::Microsoft::ReactNative {
 
-struct JSValueTreeReader : implements<JSValueTreeReader, IJSValueReader> {
+struct JSValueTreeReader : implements<JSValueTreeReader, IJSValueReader, IJSValueBinaryReader> {
   JSValueTreeReader(const JSValue &value) noexcept;
   JSValueTreeReader(JSValue &&value) noexcept;
 
@@ -25,6 +25,9 @@ struct JSValueTreeReader : implements<JSValueTreeReader, IJSValueReader> {
   int64_t GetInt64() noexcept;
   double GetDouble() noexcept;
 
+ public: // IJSValueBinaryReader
+  com_array<uint8_t> ReadBinaryValue() noexcept;
+
  private:
   struct StackEntry {
     StackEntry(const JSValue &value, const JSValueObject::const_iterator &property) noexcept;
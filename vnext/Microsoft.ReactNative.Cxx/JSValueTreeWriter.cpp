@@ -6,6 +6,7 @@
 
 #include "pch.h"
 #include "JSValueTreeWriter.h"
+#include "JSValueBinary.h"
 #include "Crash.h"
 
 namespace winrt::Microsoft::ReactNative {
@@ -72,6 +73,11 @@ void JSValueTreeWriter::WriteArrayEnd() noexcept {
   WriteValue(std::move(value));
 }
 
+void JSValueTreeWriter::WriteBinaryValue(array_view<uint8_t const> value) noexcept {
+  JSValueBinaryDecoder decoder{value};
+  WriteValue(JSValue::ReadFrom(decoder));
+}
+
 void JSValueTreeWriter::WriteValue(JSValue &&value) noexcept {
   auto &top = m_containerStack.top();
   switch (top.Type) {
@@ -14,7 +14,7 @@
 namespace winrt::Microsoft::ReactNative {
 
 // Writes to a tree of JSValue objects.
-struct JSValueTreeWriter : implements<JSValueTreeWriter, IJSValueWriter> {
+struct JSValueTreeWriter : implements<JSValueTreeWriter, IJSValueWriter, IJSValueBinaryWriter> {
   JSValueTreeWriter() noexcept;
   JSValue TakeValue() noexcept;
 
@@ -30,6 +30,9 @@ struct JSValueTreeWriter : implements<JSValueTreeWriter, IJSValueWriter> {
   void WriteArrayBegin() noexcept;
   void WriteArrayEnd() noexcept;
 
+ public: // IJSValueBinaryWriter
+  void WriteBinaryValue(array_view<uint8_t const> value) noexcept;
+
  private:
   enum struct ContainerType { None, Object, Array };
 
@@ -195,15 +195,21 @@ inline void WriteValue(IJSValueWriter const &writer, std::tuple<Ts...> const &va
 }
 
 inline void WriteValue(IJSValueWriter const &writer, JSValue const &value) noexcept {
-  value.WriteTo(writer);
+  if (!TryWriteBinaryValue(writer, value)) {
+    value.WriteTo(writer);
+  }
 }
 
 inline void WriteValue(IJSValueWriter const &writer, JSValueObject const &value) noexcept {
-  value.WriteTo(writer);
+  if (!TryWriteBinaryValue(writer, value)) {
+    value.WriteTo(writer);
+  }
 }
 
 inline void WriteValue(IJSValueWriter const &writer, JSValueArray const &value) noexcept {
-  value.WriteTo(writer);
+  if (!TryWriteBinaryValue(writer, value)) {
+    value.WriteTo(writer);
+  }
 }
 
 inline void WriteCustomDirectEventTypeConstant(
@@ -234,9 +240,13 @@ inline void WriteCustomDirectEventTypeConstant(IJSValueWriter const &writer, std
 template <class T, std::enable_if_t<!std::is_void_v<decltype(GetStructInfo(static_cast<T *>(nullptr)))>, int>>
 inline void WriteValue(IJSValueWriter const &writer, T const &value) noexcept {
   writer.WriteObjectBegin();
-  for (const auto &fieldEntry : StructInfo<T>::FieldMap) {
-    writer.WritePropertyName(fieldEntry.first);
-    fieldEntry.second.WriteField(writer, &value);
+  if constexpr (HasStructFieldTable<T>) {
+    StructFieldTable<T>::WriteFields(writer, value);
+  } else {
+    for (const auto &fieldEntry : StructInfo<T>::FieldMap) {
+      writer.WritePropertyName(fieldEntry.first);
+      fieldEntry.second.WriteField(writer, &value);
+    }
   }
   writer.WriteObjectEnd();
 }
@@ -8,6 +8,10 @@
 #ifndef MICROSOFT_REACTNATIVE_STRUCTINFO
 #define MICROSOFT_REACTNATIVE_STRUCTINFO
 
+#include <array>
+#include <map>
+#include <string_view>
+#include <tuple>
 #include "winrt/Microsoft.ReactNative.h"
 
 // We implement optional parameter macros based on the StackOverflow discussion:
@@ -21,20 +25,16 @@
 // Please skip below to read about REACT_STRUCT and REACT_FIELD macros.
 //
 
-#define INTERNAL_REACT_STRUCT(structType)                                                  \
-  struct structType;                                                                       \
-  inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(structType *) noexcept {    \
-    winrt::Microsoft::ReactNative::FieldMap fieldMap{};                                    \
-    winrt::Microsoft::ReactNative::CollectStructFields<structType, __COUNTER__>(fieldMap); \
-    return fieldMap;                                                                       \
+#define INTERNAL_REACT_STRUCT(structType)                                                                 \
+  struct structType;                                                                                      \
+  inline winrt::Microsoft::ReactNative::ReactStructId<__COUNTER__> GetStructInfo(structType *) noexcept { \
+    return {};                                                                                            \
   }
 
-#define INTERNAL_REACT_FIELD_2_ARGS(field, fieldName)                      \
-  template <class TClass>                                                  \
-  static void RegisterField(                                               \
-      winrt::Microsoft::ReactNative::FieldMap &fieldMap,                   \
-      winrt::Microsoft::ReactNative::ReactFieldId<__COUNTER__>) noexcept { \
-    fieldMap.emplace(fieldName, &TClass::field);                           \
+#define INTERNAL_REACT_FIELD_2_ARGS(field, fieldName)                                                       \
+  template <class TClass>                                                                                   \
+  static constexpr auto GetStructField(winrt::Microsoft::ReactNative::ReactFieldId<__COUNTER__>) noexcept { \
+    return winrt::Microsoft::ReactNative::MakeStructField(fieldName, &TClass::field);                       \
   }
 
 #define INTERNAL_REACT_FIELD_1_ARG(field) INTERNAL_REACT_FIELD_2_ARGS(field, L## #field)
@@ -46,16 +46,18 @@
 // - structType (required) - the struct name the macro is attached to.
 //
 // REACT_STRUCT annotates a C++ struct that then can be serialized and deserialized with IJSValueReader and
-// IJSValueWriter. With the help of REACT_FIELD it generates FieldMap associated with the struct which then used by
-// ReactValue and ReactWrite methods. Cannot be nested inside REACT_MODULE.
+// IJSValueWriter. With the help of REACT_FIELD it generates a compile-time field table associated with the struct
+// which then used by ReadValue and WriteValue methods. Cannot be nested inside REACT_MODULE.
 #define REACT_STRUCT(structType) INTERNAL_REACT_STRUCT(structType)
 
 // REACT_FIELD(field, [opt] fieldName)
 // Arguments:
 // - field (required) - the field the macro is attached to.
 // - fieldName (optional) - the field name visible to JavaScript. Default is the field name.
+//   It must be a constant expression, such as a string literal, a constexpr const wchar_t* or a std::wstring_view.
 //
-// REACT_FIELD annotates a field to be added to FieldMap which then used by ReactValue and ReactWrite methods.
+// REACT_FIELD annotates a field to be added to the struct field table which then used by ReadValue and WriteValue
+// methods.
 #define REACT_FIELD(/* field, [opt] fieldName */...) INTERNAL_REACT_FIELD(__VA_ARGS__)(__VA_ARGS__)
 
 namespace winrt::Microsoft::ReactNative {
@@ -111,31 +113,189 @@ void FieldWriter(IJSValueWriter const &writer, const void *obj, const uintptr_t
   WriteValue(writer, static_cast<const TClass *>(obj)->*(*reinterpret_cast<const FieldPtrType *>(fieldPtrStore)));
 }
 
-template <class T>
-struct StructInfo {
-  static const FieldMap FieldMap;
+template <int I>
+using ReactFieldId = std::integral_constant<int, I>;
+
+// The type returned by GetStructInfo generated by REACT_STRUCT.
+// I is the __COUNTER__ value that precedes the __COUNTER__ values of the struct REACT_FIELD fields.
+template <int I>
+struct ReactStructId : std::integral_constant<int, I> {};
+
+// Compile-time description of a struct field generated by REACT_FIELD.
+template <class TClass, class TValue>
+struct StructField {
+  std::wstring_view Name;
+  TValue TClass::*Pointer;
 };
 
-template <class T>
-/*static*/ const FieldMap StructInfo<T>::FieldMap = GetStructInfo(static_cast<T *>(nullptr));
+template <class TClass, class TValue, size_t N>
+constexpr StructField<TClass, TValue> MakeStructField(const wchar_t (&name)[N], TValue TClass::*fieldPtr) noexcept {
+  return {std::wstring_view{name, N - 1}, fieldPtr};
+}
 
-template <int I>
-using ReactFieldId = std::integral_constant<int, I>;
+// For the field names that are not string literals.
+template <class TClass, class TValue>
+constexpr StructField<TClass, TValue> MakeStructField(std::wstring_view name, TValue TClass::*fieldPtr) noexcept {
+  return {name, fieldPtr};
+}
+
+constexpr uint32_t HashStructFieldName(std::wstring_view name) noexcept {
+  // FNV-1a hash over UTF-16 code units to match the property names returned by IJSValueReader without conversion.
+  uint32_t hash = 2166136261u;
+  for (wchar_t ch : name) {
+    hash = (hash ^ static_cast<uint32_t>(ch)) * 16777619u;
+  }
+
+  return hash;
+}
 
 template <class TClass, int I>
-auto HasRegisterField(FieldMap &fieldMap, ReactFieldId<I> id)
-    -> decltype(TClass::template RegisterField<TClass>(fieldMap, id), std::true_type{});
+auto HasStructField(ReactFieldId<I> id) -> decltype(TClass::template GetStructField<TClass>(id), std::true_type{});
 template <class TClass>
-auto HasRegisterField(...) -> std::false_type;
+auto HasStructField(...) -> std::false_type;
 
 template <class TClass, int I>
-void CollectStructFields(FieldMap &fieldMap) noexcept {
-  if constexpr (decltype(HasRegisterField<TClass>(fieldMap, ReactFieldId<I + 1>{}))::value) {
-    TClass::template RegisterField<TClass>(fieldMap, ReactFieldId<I + 1>{});
-    CollectStructFields<TClass, I + 1>(fieldMap);
+constexpr auto CollectStructFields() noexcept {
+  if constexpr (decltype(HasStructField<TClass>(ReactFieldId<I + 1>{}))::value) {
+    return std::tuple_cat(
+        std::make_tuple(TClass::template GetStructField<TClass>(ReactFieldId<I + 1>{})),
+        CollectStructFields<TClass, I + 1>());
+  } else {
+    return std::tuple<>{};
+  }
+}
+
+template <class T>
+struct IsReactStructId : std::false_type {};
+template <int I>
+struct IsReactStructId<ReactStructId<I>> : std::true_type {};
+
+// True if T is annotated with REACT_STRUCT and its fields are described by StructFieldTable.
+// Otherwise, the fields are described by the FieldMap returned from a custom GetStructInfo function.
+template <class T>
+constexpr bool HasStructFieldTable = IsReactStructId<decltype(GetStructInfo(static_cast<T *>(nullptr)))>::value;
+
+// Field table of a REACT_STRUCT struct generated at compile time.
+// Fields are found by a binary search of the field name hash and then read and written by inlined code
+// without a type erasure. It has no static initialization cost.
+template <class T>
+struct StructFieldTable {
+  static constexpr auto Fields = CollectStructFields<T, decltype(GetStructInfo(static_cast<T *>(nullptr)))::value>();
+  static constexpr size_t FieldCount = std::tuple_size_v<std::remove_const_t<decltype(Fields)>>;
+  static constexpr size_t NotFound = static_cast<size_t>(-1);
+
+  // Return the field index or NotFound.
+  static size_t FindField(std::wstring_view name) noexcept {
+    uint32_t hash = HashStructFieldName(name);
+    size_t first = 0;
+    size_t count = FieldCount;
+    while (count > 0) {
+      size_t step = count / 2;
+      if (SortedEntries[first + step].Hash < hash) {
+        first += step + 1;
+        count -= step + 1;
+      } else {
+        count = step;
+      }
+    }
+
+    for (; first < FieldCount && SortedEntries[first].Hash == hash; ++first) {
+      if (SortedEntries[first].Name == name) {
+        return SortedEntries[first].Index;
+      }
+    }
+
+    return NotFound;
+  }
+
+  // Read the field with the property name. Return false if there is no such field.
+  static bool ReadField(IJSValueReader const &reader, std::wstring_view name, T &value) noexcept {
+    return ReadField(reader, FindField(name), value, std::make_index_sequence<FieldCount>{});
+  }
+
+  // Write the fields ordered by name, in the same order as the FieldMap.
+  static void WriteFields(IJSValueWriter const &writer, T const &value) noexcept {
+    WriteFields(writer, value, std::make_index_sequence<FieldCount>{});
+  }
+
+ private:
+  struct FieldEntry {
+    uint32_t Hash;
+    size_t Index;
+    std::wstring_view Name;
+  };
+
+  template <size_t... I>
+  static constexpr std::array<FieldEntry, FieldCount> MakeSortedEntries(std::index_sequence<I...>) noexcept {
+    std::array<FieldEntry, FieldCount> entries{
+        FieldEntry{HashStructFieldName(std::get<I>(Fields).Name), I, std::get<I>(Fields).Name}...};
+    for (size_t i = 1; i < FieldCount; ++i) {
+      for (size_t j = i; j > 0 && entries[j].Hash < entries[j - 1].Hash; --j) {
+        FieldEntry entry = entries[j];
+        entries[j] = entries[j - 1];
+        entries[j - 1] = entry;
+      }
+    }
+
+    return entries;
+  }
+
+  template <size_t... I>
+  static constexpr std::array<size_t, FieldCount> MakeWriteOrder(std::index_sequence<I...>) noexcept {
+    std::array<std::wstring_view, FieldCount> names{std::get<I>(Fields).Name...};
+    std::array<size_t, FieldCount> order{I...};
+    for (size_t i = 1; i < FieldCount; ++i) {
+      for (size_t j = i; j > 0 && names[order[j]] < names[order[j - 1]]; --j) {
+        size_t index = order[j];
+        order[j] = order[j - 1];
+        order[j - 1] = index;
+      }
+    }
+
+    return order;
+  }
+
+  template <size_t... I>
+  static bool ReadField(IJSValueReader const &reader, size_t index, T &value, std::index_sequence<I...>) noexcept {
+    return ((index == I && (ReadValue(reader, /*out*/ value.*std::get<I>(Fields).Pointer), true)) || ...);
+  }
+
+  template <size_t... I>
+  static void WriteFields(IJSValueWriter const &writer, T const &value, std::index_sequence<I...>) noexcept {
+    ((writer.WritePropertyName(std::get<WriteOrder[I]>(Fields).Name),
+      WriteValue(writer, value.*std::get<WriteOrder[I]>(Fields).Pointer)),
+     ...);
+  }
+
+ private:
+  static constexpr std::array<FieldEntry, FieldCount> SortedEntries =
+      MakeSortedEntries(std::make_index_sequence<FieldCount>{});
+  static constexpr std::array<size_t, FieldCount> WriteOrder = MakeWriteOrder(std::make_index_sequence<FieldCount>{});
+};
+
+template <class T>
+FieldMap GetStructFieldMap() noexcept {
+  if constexpr (HasStructFieldTable<T>) {
+    FieldMap fieldMap;
+    std::apply(
+        [&fieldMap](auto const &... field) noexcept { (fieldMap.emplace(field.Name, field.Pointer), ...); },
+        StructFieldTable<T>::Fields);
+    return fieldMap;
+  } else {
+    return GetStructInfo(static_cast<T *>(nullptr));
   }
 }
 
+// FieldMap is kept for the structs with a custom GetStructInfo function.
+// For REACT_STRUCT structs it is built from the StructFieldTable when the static member is initialized.
+template <class T>
+struct StructInfo {
+  static const FieldMap FieldMap;
+};
+
+template <class T>
+/*static*/ const FieldMap StructInfo<T>::FieldMap = GetStructFieldMap<T>();
+
 } // namespace winrt::Microsoft::ReactNative
 
 #endif // MICROSOFT_REACTNATIVE_STRUCTINFO
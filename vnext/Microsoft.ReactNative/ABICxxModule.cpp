@@ -5,6 +5,8 @@
 #include "ABICxxModule.h"
 #include "DynamicWriter.h"
 
+#include <tracing/SamplingProfiler.h>
+
 using namespace facebook::xplat::module;
 
 namespace winrt::Microsoft::ReactNative {
@@ -45,6 +47,26 @@ std::map<std::string, folly::dynamic> ABICxxModule::getConstants() noexcept {
 
 std::vector<CxxModule::Method> ABICxxModule::getMethods() noexcept {
   auto result = std::move(m_methods);
+
+  // Report the method as in flight to a running sampling profiler.
+  for (auto &method : result) {
+    if (method.func) {
+      method.func = [moduleName = m_name, methodName = method.name, func = std::move(method.func)](
+                        folly::dynamic args, Callback resolve, Callback reject) {
+        facebook::react::tracing::NativeCallScope scope{moduleName.c_str(), methodName.c_str()};
+        func(std::move(args), std::move(resolve), std::move(reject));
+      };
+    }
+
+    if (method.syncFunc) {
+      method.syncFunc = [moduleName = m_name, methodName = method.name, syncFunc = std::move(method.syncFunc)](
+                            folly::dynamic args) {
+        facebook::react::tracing::NativeCallScope scope{moduleName.c_str(), methodName.c_str()};
+        return syncFunc(std::move(args));
+      };
+    }
+  }
+
   return result;
 }
 
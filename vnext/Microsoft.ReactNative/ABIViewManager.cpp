@@ -215,6 +215,11 @@ YGMeasureFunc ABIViewManager::GetYogaCustomMeasureFunc() const {
   }
 }
 
+bool ABIViewManager::CanCacheMeasurements() const {
+  // The size of the native view depends on its state, which the framework does not see change.
+  return false;
+}
+
 ::Microsoft::ReactNative::ShadowNode *ABIViewManager::createShadow() const {
   return new ABIShadowNode(
       m_viewManagerRequiresNativeLayout && m_viewManagerRequiresNativeLayout.RequiresNativeLayout());
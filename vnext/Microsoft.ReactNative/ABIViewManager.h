@@ -59,6 +59,7 @@ class ABIViewManager : public ::Microsoft::ReactNative::FrameworkElementViewMana
       const xaml::DependencyObject &newChild) override;
 
   YGMeasureFunc GetYogaCustomMeasureFunc() const override;
+  bool CanCacheMeasurements() const override;
   ::Microsoft::ReactNative::ShadowNode *createShadow() const override;
 
   bool RequiresNativeLayout() const override {
@@ -3,9 +3,52 @@
 
 #include "pch.h"
 #include "DynamicReader.h"
+#include "JSValueBinary.h"
 
 namespace winrt::Microsoft::ReactNative {
 
+// Write the value with the same types as DynamicReader::ValueType returns for it.
+static void WriteBinaryDynamic(JSValueBinaryEncoder &encoder, const folly::dynamic &value) noexcept {
+  switch (value.type()) {
+    case folly::dynamic::Type::ARRAY:
+      encoder.WriteArrayBegin();
+      for (const auto &item : value) {
+        WriteBinaryDynamic(encoder, item);
+      }
+
+      encoder.WriteArrayEnd();
+      break;
+    case folly::dynamic::Type::BOOL:
+      encoder.WriteBoolean(value.getBool());
+      break;
+    case folly::dynamic::Type::DOUBLE:
+      if (double doubleValue = value.getDouble(); static_cast<int64_t>(doubleValue) == doubleValue) {
+        encoder.WriteInt64(static_cast<int64_t>(doubleValue));
+      } else {
+        encoder.WriteDouble(doubleValue);
+      }
+      break;
+    case folly::dynamic::Type::INT64:
+      encoder.WriteInt64(value.getInt());
+      break;
+    case folly::dynamic::Type::OBJECT:
+      encoder.WriteObjectBegin();
+      for (const auto &property : value.items()) {
+        encoder.WritePropertyName(property.first.asString());
+        WriteBinaryDynamic(encoder, property.second);
+      }
+
+      encoder.WriteObjectEnd();
+      break;
+    case folly::dynamic::Type::STRING:
+      encoder.WriteString(value.getString());
+      break;
+    default:
+      encoder.WriteNull();
+      break;
+  }
+}
+
 //===========================================================================
 // DynamicReader implementation
 //===========================================================================
@@ -149,4 +192,17 @@ double DynamicReader::GetDouble() noexcept {
   return (m_current->type() == folly::dynamic::Type::DOUBLE) ? m_current->getDouble() : 0;
 }
 
+com_array<uint8_t> DynamicReader::ReadBinaryValue() noexcept {
+  std::vector<uint8_t> buffer;
+  JSValueBinaryEncoder encoder{buffer};
+  WriteBinaryDynamic(encoder, *m_current);
+
+  // The current object or array is read as if all its items were visited.
+  if (!m_isIterating) {
+    m_isIterating = !m_stack.empty();
+  }
+
+  return com_array<uint8_t>(buffer.begin(), buffer.end());
+}
+
 } // namespace winrt::Microsoft::ReactNative
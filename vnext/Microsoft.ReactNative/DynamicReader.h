@@ -8,7 +8,7 @@
 
 namespace winrt::Microsoft::ReactNative {
 
-struct DynamicReader : implements<DynamicReader, IJSValueReader> {
+struct DynamicReader : implements<DynamicReader, IJSValueReader, IJSValueBinaryReader> {
   DynamicReader(const folly::dynamic &root) noexcept;
 
  public: // IJSValueReader
@@ -20,6 +20,9 @@ struct DynamicReader : implements<DynamicReader, IJSValueReader> {
   int64_t GetInt64() noexcept;
   double GetDouble() noexcept;
 
+ public: // IJSValueBinaryReader
+  com_array<uint8_t> ReadBinaryValue() noexcept;
+
  private:
   struct StackEntry {
     static StackEntry ObjectProperty(
@@ -3,10 +3,43 @@
 
 #include "pch.h"
 #include "DynamicWriter.h"
+#include "JSValueBinary.h"
 #include <crash/verifyElseCrash.h>
 
 namespace winrt::Microsoft::ReactNative {
 
+static folly::dynamic ReadBinaryDynamic(JSValueBinaryDecoder &decoder) noexcept {
+  switch (decoder.ValueType()) {
+    case JSValueType::Object: {
+      folly::dynamic object = folly::dynamic::object();
+      std::string_view propertyName;
+      while (decoder.GetNextObjectProperty(/*ref*/ propertyName)) {
+        object[std::string{propertyName}] = ReadBinaryDynamic(decoder);
+      }
+
+      return object;
+    }
+    case JSValueType::Array: {
+      folly::dynamic array = folly::dynamic::array();
+      while (decoder.GetNextArrayItem()) {
+        array.push_back(ReadBinaryDynamic(decoder));
+      }
+
+      return array;
+    }
+    case JSValueType::String:
+      return folly::dynamic{std::string{decoder.GetString()}};
+    case JSValueType::Boolean:
+      return folly::dynamic{decoder.GetBoolean()};
+    case JSValueType::Int64:
+      return folly::dynamic{decoder.GetInt64()};
+    case JSValueType::Double:
+      return folly::dynamic{decoder.GetDouble()};
+    default:
+      return folly::dynamic{};
+  }
+}
+
 //===========================================================================
 // DynamicWriter implementation
 //===========================================================================
@@ -124,6 +157,11 @@ void DynamicWriter::WriteArrayEnd() noexcept {
   VerifyElseCrash(false);
 }
 
+void DynamicWriter::WriteBinaryValue(array_view<uint8_t const> value) noexcept {
+  JSValueBinaryDecoder decoder{value};
+  WriteValue(ReadBinaryDynamic(decoder));
+}
+
 void DynamicWriter::WriteValue(folly::dynamic &&value) noexcept {
   if (m_state == State::PropertyValue) {
     m_dynamic[std::move(m_propertyName)] = std::move(value);
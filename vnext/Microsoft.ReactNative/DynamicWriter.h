@@ -7,7 +7,7 @@
 
 namespace winrt::Microsoft::ReactNative {
 
-struct DynamicWriter : winrt::implements<DynamicWriter, IJSValueWriter> {
+struct DynamicWriter : winrt::implements<DynamicWriter, IJSValueWriter, IJSValueBinaryWriter> {
   folly::dynamic TakeValue() noexcept;
 
  public: // IJSValueWriter
@@ -22,6 +22,9 @@ struct DynamicWriter : winrt::implements<DynamicWriter, IJSValueWriter> {
   void WriteArrayBegin() noexcept;
   void WriteArrayEnd() noexcept;
 
+ public: // IJSValueBinaryWriter
+  void WriteBinaryValue(array_view<uint8_t const> value) noexcept;
+
  public:
   static folly::dynamic ToDynamic(JSValueArgWriter const &argWriter) noexcept;
 
@@ -6,6 +6,8 @@
 
 #include "pch.h"
 #include "JsiReader.h"
+#include <cmath>
+#include "JSValueBinary.h"
 #ifdef __APPLE__
 #include "Crash.h"
 #else
@@ -14,6 +16,72 @@
 
 namespace winrt::Microsoft::ReactNative {
 
+static void WriteBinaryJsiValue(
+    JSValueBinaryEncoder &encoder,
+    facebook::jsi::Runtime &runtime,
+    const facebook::jsi::Value &value) noexcept;
+
+// Write the number with the same type as JsiReader::ValueType returns for it.
+static void WriteBinaryJsiNumber(JSValueBinaryEncoder &encoder, double number) noexcept {
+  if (floor(number) == number && number >= -9223372036854775808.0 && number < 9223372036854775808.0) {
+    encoder.WriteInt64(static_cast<int64_t>(number));
+  } else {
+    encoder.WriteDouble(number);
+  }
+}
+
+static void WriteBinaryJsiObject(
+    JSValueBinaryEncoder &encoder,
+    facebook::jsi::Runtime &runtime,
+    const facebook::jsi::Object &object) noexcept {
+  encoder.WriteObjectBegin();
+  auto propertyNames = object.getPropertyNames(runtime);
+  size_t propertyCount = propertyNames.size(runtime);
+  for (size_t i = 0; i < propertyCount; ++i) {
+    auto propertyName = propertyNames.getValueAtIndex(runtime, i).getString(runtime);
+    encoder.WritePropertyName(propertyName.utf8(runtime));
+    WriteBinaryJsiValue(encoder, runtime, object.getProperty(runtime, propertyName));
+  }
+
+  encoder.WriteObjectEnd();
+}
+
+static void WriteBinaryJsiArray(
+    JSValueBinaryEncoder &encoder,
+    facebook::jsi::Runtime &runtime,
+    const facebook::jsi::Array &array) noexcept {
+  encoder.WriteArrayBegin();
+  size_t length = array.size(runtime);
+  for (size_t i = 0; i < length; ++i) {
+    WriteBinaryJsiValue(encoder, runtime, array.getValueAtIndex(runtime, i));
+  }
+
+  encoder.WriteArrayEnd();
+}
+
+// Write the value with the same types as JsiReader returns for it, but without the reader container stack.
+static void WriteBinaryJsiValue(
+    JSValueBinaryEncoder &encoder,
+    facebook::jsi::Runtime &runtime,
+    const facebook::jsi::Value &value) noexcept {
+  if (value.isObject()) {
+    auto object = value.getObject(runtime);
+    if (object.isArray(runtime)) {
+      WriteBinaryJsiArray(encoder, runtime, object.getArray(runtime));
+    } else {
+      WriteBinaryJsiObject(encoder, runtime, object);
+    }
+  } else if (value.isString()) {
+    encoder.WriteString(value.getString(runtime).utf8(runtime));
+  } else if (value.isBool()) {
+    encoder.WriteBoolean(value.getBool());
+  } else if (value.isNumber()) {
+    WriteBinaryJsiNumber(encoder, value.getNumber());
+  } else {
+    encoder.WriteNull();
+  }
+}
+
 //===========================================================================
 // JsiReader implementation
 //===========================================================================
@@ -27,6 +95,12 @@ JsiReader::JsiReader(facebook::jsi::Runtime &runtime, const facebook::jsi::Value
   m_containers.push_back({args, count});
 }
 
+void JsiReader::Reset(const facebook::jsi::Value *args, size_t count) noexcept {
+  m_currentPrimitiveValue.reset();
+  m_containers.clear();
+  m_containers.push_back({args, count});
+}
+
 JSValueType JsiReader::ValueType() noexcept {
   if (m_currentPrimitiveValue) {
     if (ReadOptional(m_currentPrimitiveValue).isString()) {
@@ -63,6 +137,10 @@ bool JsiReader::GetNextObjectProperty(hstring &propertyName) noexcept {
     return false;
   }
 
+  if (!top.PropertyNames) {
+    top.PropertyNames = ReadOptional(top.CurrentObject).getPropertyNames(m_runtime);
+  }
+
   top.Index++;
   if (top.Index < static_cast<int>(ReadOptional(top.PropertyNames).size(m_runtime))) {
     auto propertyId =
@@ -143,13 +221,119 @@ double JsiReader::GetDouble() noexcept {
   return ReadOptional(m_currentPrimitiveValue).getNumber();
 }
 
+com_array<uint8_t> JsiReader::ReadBinaryValue() noexcept {
+  std::vector<uint8_t> buffer;
+  JSValueBinaryEncoder encoder{buffer};
+  if (m_currentPrimitiveValue) {
+    WriteBinaryJsiValue(encoder, m_runtime, ReadOptional(m_currentPrimitiveValue));
+  } else if (m_containers.size() > 0 && m_containers[m_containers.size() - 1].Index == -1) {
+    auto &top = m_containers[m_containers.size() - 1];
+    switch (top.Type) {
+      case ContainerType::Object:
+        WriteBinaryJsiObject(encoder, m_runtime, ReadOptional(top.CurrentObject));
+        break;
+      case ContainerType::Array:
+        WriteBinaryJsiArray(encoder, m_runtime, ReadOptional(top.CurrentArray));
+        break;
+      case ContainerType::Args:
+        encoder.WriteArrayBegin();
+        for (size_t i = 0; i < top.ArgLength; ++i) {
+          WriteBinaryJsiValue(encoder, m_runtime, top.ArgElements[i]);
+        }
+
+        encoder.WriteArrayEnd();
+        break;
+    }
+
+    // The current object or array is read as if all its items were visited.
+    m_containers.pop_back();
+  } else {
+    encoder.WriteNull();
+  }
+
+  return com_array<uint8_t>(buffer.begin(), buffer.end());
+}
+
+bool JsiReader::TryReadArrayBuffer(JsiByteArrayUser const &useBytes) noexcept {
+  if (m_currentPrimitiveValue || m_containers.size() == 0) {
+    return false;
+  }
+
+  auto &top = m_containers[m_containers.size() - 1];
+  if (top.Type != ContainerType::Object || top.Index != -1) {
+    return false;
+  }
+
+  auto &object = ReadOptional(top.CurrentObject);
+  uint8_t *data = nullptr;
+  size_t size = 0;
+  if (object.isArrayBuffer(m_runtime)) {
+    auto arrayBuffer = object.getArrayBuffer(m_runtime);
+    data = arrayBuffer.data(m_runtime);
+    size = arrayBuffer.size(m_runtime);
+  } else {
+    // typed arrays and DataView are views to a range of their ArrayBuffer
+    if (!IsArrayBufferView(object)) {
+      return false;
+    }
+
+    auto arrayBuffer = object.getPropertyAsObject(m_runtime, "buffer").getArrayBuffer(m_runtime);
+    auto bufferSize = arrayBuffer.size(m_runtime);
+    auto byteOffset = object.getProperty(m_runtime, "byteOffset");
+    auto byteLength = object.getProperty(m_runtime, "byteLength");
+    if (!IsByteCount(byteOffset, bufferSize) || !IsByteCount(byteLength, bufferSize)) {
+      return false;
+    }
+
+    auto offset = static_cast<size_t>(byteOffset.getNumber());
+    size = static_cast<size_t>(byteLength.getNumber());
+    if (size > bufferSize - offset) {
+      return false;
+    }
+
+    data = arrayBuffer.data(m_runtime) + offset;
+  }
+
+  useBytes({data, data + size});
+
+  // the binary data is read as if all its properties were visited
+  m_containers.pop_back();
+  return true;
+}
+
+bool JsiReader::IsArrayBufferView(const facebook::jsi::Object &object) noexcept {
+  // ArrayBuffer.isView accepts only typed arrays and DataView objects.
+  auto arrayBufferClass = m_runtime.global().getProperty(m_runtime, "ArrayBuffer");
+  if (!arrayBufferClass.isObject()) {
+    return false;
+  }
+
+  auto isView = arrayBufferClass.getObject(m_runtime).getProperty(m_runtime, "isView");
+  if (!isView.isObject() || !isView.getObject(m_runtime).isFunction(m_runtime)) {
+    return false;
+  }
+
+  auto result = isView.getObject(m_runtime).getFunction(m_runtime).call(m_runtime, object);
+  return result.isBool() && result.getBool();
+}
+
+/*static*/ bool JsiReader::IsByteCount(const facebook::jsi::Value &value, size_t maxCount) noexcept {
+  if (!value.isNumber()) {
+    return false;
+  }
+
+  // NaN fails all comparisons.
+  auto number = value.getNumber();
+  return number >= 0 && number <= static_cast<double>(maxCount) && std::floor(number) == number;
+}
+
 void JsiReader::SetValue(const facebook::jsi::Value &value) noexcept {
   if (value.isObject()) {
     auto obj = value.getObject(m_runtime);
     if (obj.isArray(m_runtime)) {
       m_containers.push_back(obj.getArray(m_runtime));
     } else {
-      m_containers.push_back({m_runtime, std::move(obj)});
+      m_containers.push_back(std::move(obj));
     }
     m_currentPrimitiveValue = std::nullopt;
   } else if (value.isString() || value.isBool() || value.isNumber()) {
@@ -20,10 +20,13 @@ decltype(auto) ReadOptional(std::optional<T> &opt) {
 }
 #endif
 
-struct JsiReader : implements<JsiReader, IJSValueReader> {
+struct JsiReader : implements<JsiReader, IJSValueReader, IJSValueBinaryReader, IJSValueArrayBufferReader> {
   JsiReader(facebook::jsi::Runtime &runtime, const facebook::jsi::Value &root) noexcept;
   JsiReader(facebook::jsi::Runtime &runtime, const facebook::jsi::Value *args, size_t count) noexcept;
 
+  // Reset starts reading new arguments. It allows to reuse the reader for multiple calls.
+  void Reset(const facebook::jsi::Value *args, size_t count) noexcept;
+
  public: // IJSValueReader
   JSValueType ValueType() noexcept;
   bool GetNextObjectProperty(hstring &propertyName) noexcept;
@@ -33,6 +36,12 @@ struct JsiReader : implements<JsiReader, IJSValueReader> {
   int64_t GetInt64() noexcept;
   double GetDouble() noexcept;
 
+ public: // IJSValueBinaryReader
+  com_array<uint8_t> ReadBinaryValue() noexcept;
+
+ public: // IJSValueArrayBufferReader
+  bool TryReadArrayBuffer(JsiByteArrayUser const &useBytes) noexcept;
+
  private:
   enum class ContainerType {
     Object,
@@ -43,16 +52,14 @@ struct JsiReader : implements<JsiReader, IJSValueReader> {
   struct Container {
     ContainerType Type;
     std::optional<facebook::jsi::Object> CurrentObject; // valid for ContainerType::Object
-    std::optional<facebook::jsi::Array> PropertyNames; // valid for ContainerType::Object
+    std::optional<facebook::jsi::Array> PropertyNames; // requested on the first GetNextObjectProperty call
     std::optional<facebook::jsi::Array> CurrentArray; // valid for ContainerType::Array
     const facebook::jsi::Value *ArgElements = nullptr; // valid for ContainerType::Args
     size_t ArgLength = 0; // valid for ContainerType::Args
     int Index = -1;
 
-    Container(facebook::jsi::Runtime &runtime, facebook::jsi::Object &&value) noexcept
-        : Type(ContainerType::Object), CurrentObject(std::make_optional<facebook::jsi::Object>(std::move(value))) {
-      PropertyNames = ReadOptional(CurrentObject).getPropertyNames(runtime);
-    }
+    Container(facebook::jsi::Object &&value) noexcept
+        : Type(ContainerType::Object), CurrentObject(std::make_optional<facebook::jsi::Object>(std::move(value))) {}
 
     Container(facebook::jsi::Array &&value) noexcept
         : Type(ContainerType::Array), CurrentArray(std::make_optional<facebook::jsi::Array>(std::move(value))) {}
@@ -66,6 +73,8 @@ struct JsiReader : implements<JsiReader, IJSValueReader> {
 
  private:
   void SetValue(const facebook::jsi::Value &value) noexcept;
+  bool IsArrayBufferView(const facebook::jsi::Object &object) noexcept;
+  static bool IsByteCount(const facebook::jsi::Value &value, size_t maxCount) noexcept;
 
  private:
   facebook::jsi::Runtime &m_runtime;
@@ -6,6 +6,7 @@
 
 #include "pch.h"
 #include "JsiWriter.h"
+#include "JSValueBinary.h"
 #ifdef __APPLE__
 #include "Crash.h"
 #else
@@ -23,6 +24,14 @@ JsiWriter::JsiWriter(facebook::jsi::Runtime &runtime) noexcept : m_runtime(runti
   Push({ContainerState::AcceptValueAndFinish});
 }
 
+void JsiWriter::Reset() noexcept {
+  m_resultAsValue.reset();
+  m_resultAsContainer.reset();
+  m_containers.clear();
+  m_propertyNameIds.clear();
+  Push({ContainerState::AcceptValueAndFinish});
+}
+
 facebook::jsi::Value JsiWriter::MoveResult() noexcept {
   VerifyElseCrash(m_containers.size() == 0);
   if (m_resultAsContainer.has_value()) {
@@ -113,6 +122,87 @@ facebook::jsi::Value JsiWriter::ContainerToValue(Container &&container) noexcept
   }
 }
 
+void JsiWriter::WriteBinaryValue(array_view<uint8_t const> value) noexcept {
+  JSValueBinaryDecoder decoder{value};
+  if (Top().State == ContainerState::AcceptValueAndFinish && decoder.ValueType() == JSValueType::Array) {
+    // keep the root array elements to be accessed by AccessResultAsArgs
+    Container container{ContainerState::AcceptArrayElement};
+    while (decoder.GetNextArrayItem()) {
+      container.CurrentArrayElements.push_back(ReadBinaryValue(decoder));
+    }
+    WriteContainer(std::move(container));
+  } else {
+    WriteValue(ReadBinaryValue(decoder));
+  }
+}
+
+void JsiWriter::WriteArrayBuffer(IJsiByteBuffer const &buffer) noexcept {
+  // This JSI version cannot create an ArrayBuffer backed by external memory.
+  // The ArrayBuffer is created by its JavaScript constructor and the bytes are copied once into it.
+  auto arrayBufferObject = m_runtime.global()
+                               .getPropertyAsFunction(m_runtime, "ArrayBuffer")
+                               .callAsConstructor(m_runtime, static_cast<double>(buffer.Size()))
+                               .getObject(m_runtime);
+  auto arrayBuffer = arrayBufferObject.getArrayBuffer(m_runtime);
+  buffer.GetData([this, &arrayBuffer](array_view<uint8_t const> bytes) {
+    VerifyElseCrash(bytes.size() <= arrayBuffer.size(m_runtime));
+    if (bytes.size() > 0) {
+      memcpy(arrayBuffer.data(m_runtime), bytes.data(), bytes.size());
+    }
+  });
+  WriteValue(std::move(arrayBuffer));
+}
+
+facebook::jsi::Value JsiWriter::ReadBinaryValue(JSValueBinaryDecoder &decoder) noexcept {
+  switch (decoder.ValueType()) {
+    case JSValueType::Object: {
+      facebook::jsi::Object createdObject(m_runtime);
+      std::string_view propertyName;
+      while (decoder.GetNextObjectProperty(/*ref*/ propertyName)) {
+        createdObject.setProperty(m_runtime, GetPropertyNameId(propertyName), ReadBinaryValue(decoder));
+      }
+      return std::move(createdObject);
+    }
+    case JSValueType::Array: {
+      std::vector<facebook::jsi::Value> elements;
+      while (decoder.GetNextArrayItem()) {
+        elements.push_back(ReadBinaryValue(decoder));
+      }
+      facebook::jsi::Array createdArray(m_runtime, elements.size());
+      for (size_t i = 0; i < elements.size(); i++) {
+        createdArray.setValueAtIndex(m_runtime, i, std::move(elements[i]));
+      }
+      return std::move(createdArray);
+    }
+    case JSValueType::String: {
+      auto value = decoder.GetString();
+      return facebook::jsi::String::createFromUtf8(
+          m_runtime, reinterpret_cast<const uint8_t *>(value.data()), value.size());
+    }
+    case JSValueType::Boolean:
+      return {decoder.GetBoolean()};
+    case JSValueType::Int64:
+      return {static_cast<double>(decoder.GetInt64())};
+    case JSValueType::Double:
+      return {decoder.GetDouble()};
+    default:
+      return facebook::jsi::Value::null();
+  }
+}
+
+const facebook::jsi::PropNameID &JsiWriter::GetPropertyNameId(std::string_view name) noexcept {
+  auto it = m_propertyNameIds.find(name);
+  if (it == m_propertyNameIds.end()) {
+    it = m_propertyNameIds
+             .emplace(
+                 std::string{name},
+                 facebook::jsi::PropNameID::forUtf8(
+                     m_runtime, reinterpret_cast<const uint8_t *>(name.data()), name.size()))
+             .first;
+  }
+  return it->second;
+}
+
 void JsiWriter::WriteContainer(Container &&container) noexcept {
   if (Top().State == ContainerState::AcceptValueAndFinish && container.State == ContainerState::AcceptArrayElement) {
     m_resultAsContainer.emplace(std::move(container));
@@ -138,7 +228,7 @@ void JsiWriter::WriteValue(facebook::jsi::Value &&value) noexcept {
     }
     case ContainerState::AcceptPropertyValue: {
       auto &createdObject = ReadOptional(top.CurrentObject);
-      createdObject.setProperty(m_runtime, top.PropertyName.c_str(), std::move(value));
+      createdObject.setProperty(m_runtime, GetPropertyNameId(top.PropertyName), std::move(value));
       top.State = ContainerState::AcceptPropertyName;
       top.PropertyName = {};
       break;
@@ -6,14 +6,22 @@
 
 #pragma once
 
+#include <map>
 #include "jsi/jsi.h"
 #include "winrt/Microsoft.ReactNative.h"
 
 namespace winrt::Microsoft::ReactNative {
 
-struct JsiWriter : winrt::implements<JsiWriter, IJSValueWriter> {
+struct JSValueBinaryDecoder;
+
+struct JsiWriter
+    : winrt::implements<JsiWriter, IJSValueWriter, IJSValueBinaryWriter, IJSValueArrayBufferWriter> {
   JsiWriter(facebook::jsi::Runtime &runtime) noexcept;
 
+  // Reset starts writing a new root value. It allows to reuse the writer.
+  // It releases all JSI values held by the writer, including the property name cache.
+  void Reset() noexcept;
+
   // MoveResult crashes when the root object is not closed.
   // MoveResult returns the constructed root object.
   facebook::jsi::Value MoveResult() noexcept;
@@ -35,6 +43,12 @@ struct JsiWriter : winrt::implements<JsiWriter, IJSValueWriter> {
   void WriteArrayBegin() noexcept;
   void WriteArrayEnd() noexcept;
 
+ public: // IJSValueBinaryWriter
+  void WriteBinaryValue(array_view<uint8_t const> value) noexcept;
+
+ public: // IJSValueArrayBufferWriter
+  void WriteArrayBuffer(IJsiByteBuffer const &buffer) noexcept;
+
  public:
   static facebook::jsi::Value ToJsiValue(facebook::jsi::Runtime &runtime, JSValueArgWriter const &argWriter) noexcept;
 
@@ -62,6 +76,8 @@ struct JsiWriter : winrt::implements<JsiWriter, IJSValueWriter> {
 
  private:
   facebook::jsi::Value ContainerToValue(Container &&container) noexcept;
+  facebook::jsi::Value ReadBinaryValue(JSValueBinaryDecoder &decoder) noexcept;
+  const facebook::jsi::PropNameID &GetPropertyNameId(std::string_view name) noexcept;
   void WriteContainer(Container &&container) noexcept;
   void WriteValue(facebook::jsi::Value &&value) noexcept;
   Container &Top() noexcept;
@@ -78,6 +94,8 @@ struct JsiWriter : winrt::implements<JsiWriter, IJSValueWriter> {
   std::optional<facebook::jsi::Value> m_resultAsValue;
   std::optional<Container> m_resultAsContainer;
   std::vector<Container> m_containers;
+  // Objects written by native modules often repeat the same property names, e.g. in arrays of structs.
+  std::map<std::string, facebook::jsi::PropNameID, std::less<>> m_propertyNameIds;
 };
 
 } // namespace winrt::Microsoft::ReactNative
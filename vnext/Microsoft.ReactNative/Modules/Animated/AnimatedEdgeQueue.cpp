@@ -0,0 +1,48 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "AnimatedEdgeQueue.h"
+
+namespace Microsoft::ReactNative {
+
+void AnimatedEdgeQueue::Stage(const Edge &edge, bool isConnected) noexcept {
+  const EdgeKey key{edge.ParentTag, edge.ChildTag};
+  const auto it = m_lastEdgeIndexes.find(key);
+  const auto previousIndex = it != m_lastEdgeIndexes.end() ? it->second : NoIndex;
+
+  if (previousIndex != NoIndex) {
+    auto &previous = m_edges[previousIndex];
+    if (edge.Connect && !previous.Value.Connect && previous.WasConnected) {
+      previous.IsCancelled = true;
+      if (previous.PreviousIndex != NoIndex) {
+        it->second = previous.PreviousIndex;
+      } else {
+        m_lastEdgeIndexes.erase(it);
+      }
+
+      return;
+    }
+  }
+
+  const bool wasConnected = previousIndex != NoIndex ? m_edges[previousIndex].Value.Connect : isConnected;
+  m_lastEdgeIndexes[key] = m_edges.size();
+  m_edges.push_back(StagedEdge{edge, wasConnected, false, previousIndex});
+}
+
+std::vector<AnimatedEdgeQueue::Edge> AnimatedEdgeQueue::Take() noexcept {
+  std::vector<Edge> edges;
+  edges.reserve(m_edges.size());
+  for (const auto &edge : m_edges) {
+    if (!edge.IsCancelled) {
+      edges.push_back(edge.Value);
+    }
+  }
+
+  m_edges.clear();
+  m_lastEdgeIndexes.clear();
+  return edges;
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+// Stages the connect and disconnect operations of the edges between animated nodes in an operation batch.
+// Re-rendered views disconnect and connect the same edges again. A connect that follows the disconnect of a
+// connected edge cancels it, so that the edge and the expression animations built on it are left as they are.
+// All other operations are kept in order.
+class AnimatedEdgeQueue {
+ public:
+  struct Edge {
+    int64_t ParentTag{0};
+    int64_t ChildTag{0};
+    bool Connect{false};
+  };
+
+  // Stages the operation. isConnected tells whether the graph has the edge before the staged operations.
+  void Stage(const Edge &edge, bool isConnected) noexcept;
+
+  // Returns the operations that are not cancelled in the order they were staged, and clears the queue.
+  std::vector<Edge> Take() noexcept;
+
+  bool IsEmpty() const noexcept {
+    return m_edges.empty();
+  }
+
+ private:
+  static constexpr size_t NoIndex = static_cast<size_t>(-1);
+
+  struct StagedEdge {
+    Edge Value;
+    bool WasConnected;
+    bool IsCancelled;
+    size_t PreviousIndex;
+  };
+
+  struct EdgeKey {
+    int64_t ParentTag;
+    int64_t ChildTag;
+
+    bool operator==(const EdgeKey &other) const noexcept {
+      return ParentTag == other.ParentTag && ChildTag == other.ChildTag;
+    }
+  };
+
+  struct EdgeKeyHash {
+    size_t operator()(const EdgeKey &key) const noexcept {
+      return std::hash<int64_t>{}(key.ParentTag) ^ (std::hash<int64_t>{}(key.ChildTag) * 31);
+    }
+  };
+
+  std::vector<StagedEdge> m_edges;
+  // The index of the last operation that is not cancelled for each edge.
+  std::unordered_map<EdgeKey, size_t, EdgeKeyHash> m_lastEdgeIndexes;
+};
+
+} // namespace Microsoft::ReactNative
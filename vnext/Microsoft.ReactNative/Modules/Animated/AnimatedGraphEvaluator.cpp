@@ -0,0 +1,321 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <math.h>
+#include <algorithm>
+#include "AnimatedGraphEvaluator.h"
+
+namespace Microsoft::ReactNative {
+
+void AnimatedGraphEvaluator::AddValueNode(int64_t tag, double value, double offset) {
+  AddNode(tag, Node{}, value, offset);
+}
+
+void AnimatedGraphEvaluator::AddInterpolationNode(
+    int64_t tag,
+    std::vector<double> &&inputRange,
+    std::vector<double> &&outputRange,
+    ExtrapolationType extrapolateLeft,
+    ExtrapolationType extrapolateRight) {
+  Node node;
+  node.Operator = AnimatedGraphOperator::Interpolation;
+  node.ExtrapolateLeft = extrapolateLeft;
+  node.ExtrapolateRight = extrapolateRight;
+  node.InputTags.push_back(NoTag);
+
+  // The ranges must have the same size. Extra points of the longer range are ignored.
+  const auto size = std::min(inputRange.size(), outputRange.size());
+  node.Parameters = std::move(inputRange);
+  node.Parameters.resize(size);
+  node.Parameters.insert(node.Parameters.end(), outputRange.begin(), outputRange.begin() + size);
+  AddNode(tag, std::move(node), 0, 0);
+}
+
+void AnimatedGraphEvaluator::AddOperatorNode(
+    int64_t tag,
+    AnimatedGraphOperator op,
+    std::vector<int64_t> &&inputTags) {
+  Node node;
+  node.Operator = op;
+  node.InputTags = std::move(inputTags);
+  AddNode(tag, std::move(node), 0, 0);
+}
+
+void AnimatedGraphEvaluator::AddModulusNode(int64_t tag, int64_t inputTag, double modulus) {
+  Node node;
+  node.Operator = AnimatedGraphOperator::Modulus;
+  node.InputTags.push_back(inputTag);
+  node.Parameters.push_back(modulus);
+  AddNode(tag, std::move(node), 0, 0);
+}
+
+void AnimatedGraphEvaluator::AddDiffClampNode(int64_t tag, int64_t inputTag, double min, double max) {
+  Node node;
+  node.Operator = AnimatedGraphOperator::DiffClamp;
+  node.InputTags.push_back(inputTag);
+  node.Parameters.push_back(min);
+  node.Parameters.push_back(max);
+  AddNode(tag, std::move(node), 0, 0);
+}
+
+void AnimatedGraphEvaluator::AddNode(int64_t tag, Node &&node, double value, double offset) {
+  uint32_t slot = m_slotIndexes.Find(tag);
+  if (slot == TagIndex::NoIndex) {
+    if (!m_freeSlots.empty()) {
+      slot = m_freeSlots.back();
+      m_freeSlots.pop_back();
+    } else {
+      slot = static_cast<uint32_t>(m_nodes.size());
+      m_nodes.emplace_back();
+      m_slotTags.push_back(NoTag);
+      m_rawValues.push_back(0);
+      m_offsets.push_back(0);
+    }
+
+    m_slotIndexes.Set(tag, slot);
+    ++m_nodeCount;
+  }
+
+  m_nodes[slot] = std::move(node);
+  m_slotTags[slot] = tag;
+  m_rawValues[slot] = value;
+  m_offsets[slot] = offset;
+  m_graphChanged = true;
+}
+
+void AnimatedGraphEvaluator::RemoveNode(int64_t tag) {
+  const auto slot = m_slotIndexes.Find(tag);
+  if (slot == TagIndex::NoIndex) {
+    return;
+  }
+
+  m_nodes[slot] = Node{};
+  m_slotTags[slot] = NoTag;
+  m_slotIndexes.Set(tag, TagIndex::NoIndex);
+  m_freeSlots.push_back(slot);
+  --m_nodeCount;
+  m_graphChanged = true;
+}
+
+void AnimatedGraphEvaluator::ConnectNodes(int64_t parentTag, int64_t childTag) {
+  const auto slot = m_slotIndexes.Find(childTag);
+  if (slot != TagIndex::NoIndex && m_nodes[slot].Operator == AnimatedGraphOperator::Interpolation) {
+    m_nodes[slot].InputTags[0] = parentTag;
+    m_graphChanged = true;
+  }
+}
+
+void AnimatedGraphEvaluator::DisconnectNodes(int64_t parentTag, int64_t childTag) {
+  const auto slot = m_slotIndexes.Find(childTag);
+  if (slot != TagIndex::NoIndex && m_nodes[slot].Operator == AnimatedGraphOperator::Interpolation &&
+      m_nodes[slot].InputTags[0] == parentTag) {
+    m_nodes[slot].InputTags[0] = NoTag;
+    m_graphChanged = true;
+  }
+}
+
+void AnimatedGraphEvaluator::SetRawValue(int64_t tag, double value) noexcept {
+  const auto slot = m_slotIndexes.Find(tag);
+  if (slot != TagIndex::NoIndex) {
+    m_rawValues[slot] = value;
+    m_valuesChanged = true;
+  }
+}
+
+void AnimatedGraphEvaluator::SetOffset(int64_t tag, double offset) noexcept {
+  const auto slot = m_slotIndexes.Find(tag);
+  if (slot != TagIndex::NoIndex) {
+    m_offsets[slot] = offset;
+    m_valuesChanged = true;
+  }
+}
+
+bool AnimatedGraphEvaluator::TryGetValue(int64_t tag, double &value) const noexcept {
+  const auto slot = m_slotIndexes.Find(tag);
+  if (slot == TagIndex::NoIndex) {
+    return false;
+  }
+
+  value = m_rawValues[slot] + m_offsets[slot];
+  return true;
+}
+
+void AnimatedGraphEvaluator::Compile() {
+  m_steps.clear();
+  m_stepInputs.clear();
+  m_stepParameters.clear();
+
+  // Sorts the nodes with Kahn's algorithm. Nodes without inputs, with missing inputs or in cycles keep their values.
+  const auto slotCount = static_cast<uint32_t>(m_nodes.size());
+  std::vector<uint32_t> pendingInputCounts(slotCount, 0);
+  std::vector<std::vector<uint32_t>> dependents(slotCount);
+  std::vector<uint32_t> readySlots;
+  for (uint32_t slot = 0; slot < slotCount; ++slot) {
+    if (m_slotTags[slot] == NoTag) {
+      continue;
+    }
+
+    bool hasAllInputs = true;
+    for (const auto inputTag : m_nodes[slot].InputTags) {
+      const auto inputSlot = m_slotIndexes.Find(inputTag);
+      if (inputSlot == TagIndex::NoIndex) {
+        hasAllInputs = false;
+        break;
+      }
+    }
+
+    if (!hasAllInputs) {
+      continue;
+    }
+
+    for (const auto inputTag : m_nodes[slot].InputTags) {
+      ++pendingInputCounts[slot];
+      dependents[m_slotIndexes.Find(inputTag)].push_back(slot);
+    }
+
+    if (pendingInputCounts[slot] == 0) {
+      readySlots.push_back(slot);
+    }
+  }
+
+  for (size_t i = 0; i < readySlots.size(); ++i) {
+    const auto slot = readySlots[i];
+    const auto &node = m_nodes[slot];
+    if (node.Operator != AnimatedGraphOperator::Value && !node.InputTags.empty()) {
+      Step step;
+      step.Operator = node.Operator;
+      step.ExtrapolateLeft = node.ExtrapolateLeft;
+      step.ExtrapolateRight = node.ExtrapolateRight;
+      step.Slot = slot;
+      step.InputBegin = static_cast<uint32_t>(m_stepInputs.size());
+      step.InputCount = static_cast<uint32_t>(node.InputTags.size());
+      step.ParameterBegin = static_cast<uint32_t>(m_stepParameters.size());
+      step.ParameterCount = static_cast<uint32_t>(node.Parameters.size());
+      for (const auto inputTag : node.InputTags) {
+        m_stepInputs.push_back(m_slotIndexes.Find(inputTag));
+      }
+
+      m_stepParameters.insert(m_stepParameters.end(), node.Parameters.begin(), node.Parameters.end());
+      m_steps.push_back(step);
+    }
+
+    for (const auto dependent : dependents[slot]) {
+      if (--pendingInputCounts[dependent] == 0) {
+        readySlots.push_back(dependent);
+      }
+    }
+  }
+}
+
+void AnimatedGraphEvaluator::Update() {
+  if (m_graphChanged) {
+    Compile();
+    m_graphChanged = false;
+  } else if (!m_valuesChanged) {
+    return;
+  }
+
+  m_valuesChanged = false;
+  for (const auto &step : m_steps) {
+    const uint32_t *inputs = m_stepInputs.data() + step.InputBegin;
+    const auto inputValue = [this, inputs](uint32_t i) noexcept {
+      return m_rawValues[inputs[i]] + m_offsets[inputs[i]];
+    };
+
+    double value = inputValue(0);
+    switch (step.Operator) {
+      case AnimatedGraphOperator::Interpolation:
+        value = Interpolate(step, value);
+        break;
+      case AnimatedGraphOperator::Addition:
+        for (uint32_t i = 1; i < step.InputCount; ++i) {
+          value += inputValue(i);
+        }
+        break;
+      case AnimatedGraphOperator::Subtraction:
+        for (uint32_t i = 1; i < step.InputCount; ++i) {
+          value -= inputValue(i);
+        }
+        break;
+      case AnimatedGraphOperator::Multiplication:
+        for (uint32_t i = 1; i < step.InputCount; ++i) {
+          value *= inputValue(i);
+        }
+        break;
+      case AnimatedGraphOperator::Division:
+        for (uint32_t i = 1; i < step.InputCount; ++i) {
+          const auto divisor = inputValue(i);
+          if (divisor == 0) {
+            value = m_rawValues[step.Slot];
+            break;
+          }
+
+          value /= divisor;
+        }
+        break;
+      case AnimatedGraphOperator::Modulus: {
+        const auto modulus = m_stepParameters[step.ParameterBegin];
+        value = modulus != 0 ? fmod(value, modulus) : m_rawValues[step.Slot];
+        break;
+      }
+      case AnimatedGraphOperator::DiffClamp:
+        // Matches the expression of DiffClampAnimatedNode.
+        value = std::clamp(value, m_stepParameters[step.ParameterBegin], m_stepParameters[step.ParameterBegin + 1]);
+        break;
+      default:
+        break;
+    }
+
+    m_rawValues[step.Slot] = value;
+  }
+}
+
+double AnimatedGraphEvaluator::Interpolate(const Step &step, double value) const noexcept {
+  const auto size = step.ParameterCount / 2;
+  if (size == 0) {
+    return value;
+  } else if (size == 1) {
+    return m_stepParameters[step.ParameterBegin + 1];
+  }
+
+  // Finds the range of the value with a binary search. Values outside of the input range use the first or
+  // the last range.
+  const double *inputRange = m_stepParameters.data() + step.ParameterBegin;
+  const double *outputRange = inputRange + size;
+  const auto index =
+      static_cast<size_t>(std::lower_bound(inputRange + 1, inputRange + size - 1, value) - inputRange) - 1;
+
+  const auto inputMin = inputRange[index];
+  const auto inputMax = inputRange[index + 1];
+  const auto outputMin = outputRange[index];
+  const auto outputMax = outputRange[index + 1];
+
+  auto result = value;
+  if (result < inputMin) {
+    if (step.ExtrapolateLeft == ExtrapolationType::Identity) {
+      return result;
+    } else if (step.ExtrapolateLeft == ExtrapolationType::Clamp) {
+      result = inputMin;
+    }
+  }
+
+  if (result > inputMax) {
+    if (step.ExtrapolateRight == ExtrapolationType::Identity) {
+      return result;
+    } else if (step.ExtrapolateRight == ExtrapolationType::Clamp) {
+      result = inputMax;
+    }
+  }
+
+  if (outputMin == outputMax) {
+    return outputMin;
+  } else if (inputMin == inputMax) {
+    return value <= inputMin ? outputMin : outputMax;
+  }
+
+  return outputMin + (outputMax - outputMin) * (result - inputMin) / (inputMax - inputMin);
+}
+
+} // namespace Microsoft::ReactNative
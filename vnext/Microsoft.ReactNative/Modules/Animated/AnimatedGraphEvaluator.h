@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include <Utils/TagIndex.h>
+#include <cstdint>
+#include <vector>
+#include "ExtrapolationType.h"
+
+namespace Microsoft::ReactNative {
+
+enum class AnimatedGraphOperator : uint8_t {
+  Value,
+  Interpolation,
+  Addition,
+  Subtraction,
+  Multiplication,
+  Division,
+  Modulus,
+  DiffClamp,
+};
+
+// Evaluates the values of the animated node graph on the CPU.
+// The value nodes are driven by composition animations, and the other nodes by composition expressions that
+// cannot be read back. The evaluator keeps the values of all nodes in contiguous arrays. When the graph changes,
+// the nodes are sorted by their dependencies once, and Update then computes all values in a single pass.
+class AnimatedGraphEvaluator final {
+ public:
+  void AddValueNode(int64_t tag, double value, double offset);
+  void AddInterpolationNode(
+      int64_t tag,
+      std::vector<double> &&inputRange,
+      std::vector<double> &&outputRange,
+      ExtrapolationType extrapolateLeft,
+      ExtrapolationType extrapolateRight);
+
+  // Addition, Subtraction, Multiplication and Division. Subtraction and Division apply the other inputs
+  // to the first one.
+  void AddOperatorNode(int64_t tag, AnimatedGraphOperator op, std::vector<int64_t> &&inputTags);
+  void AddModulusNode(int64_t tag, int64_t inputTag, double modulus);
+  void AddDiffClampNode(int64_t tag, int64_t inputTag, double min, double max);
+  void RemoveNode(int64_t tag);
+
+  // Interpolation nodes take their input from the node they are connected to.
+  // The other nodes take their inputs from their configs.
+  void ConnectNodes(int64_t parentTag, int64_t childTag);
+  void DisconnectNodes(int64_t parentTag, int64_t childTag);
+
+  void SetRawValue(int64_t tag, double value) noexcept;
+  void SetOffset(int64_t tag, double offset) noexcept;
+
+  // Reads the raw value and offset of each value node with readValue(tag, rawValue, offset).
+  // Composition animations change them without setting them here, for example when an animation is stopped.
+  template <class TReadValue>
+  void SyncValueNodes(TReadValue &&readValue);
+
+  // Computes the values of all nodes. Does nothing when no node, edge or value changed since the last update.
+  void Update();
+
+  // Gets the value with the offset from the last update.
+  bool TryGetValue(int64_t tag, double &value) const noexcept;
+
+  size_t NodeCount() const noexcept {
+    return m_nodeCount;
+  }
+
+ private:
+  struct Node {
+    AnimatedGraphOperator Operator{AnimatedGraphOperator::Value};
+    ExtrapolationType ExtrapolateLeft{ExtrapolationType::Extend};
+    ExtrapolationType ExtrapolateRight{ExtrapolationType::Extend};
+    std::vector<int64_t> InputTags;
+
+    // Interpolation: the input range and then the output range. Modulus: the modulus. DiffClamp: min and max.
+    std::vector<double> Parameters;
+  };
+
+  // A node in dependency order, with its inputs and parameters in the shared arrays.
+  struct Step {
+    AnimatedGraphOperator Operator;
+    ExtrapolationType ExtrapolateLeft;
+    ExtrapolationType ExtrapolateRight;
+    uint32_t Slot;
+    uint32_t InputBegin;
+    uint32_t InputCount;
+    uint32_t ParameterBegin;
+    uint32_t ParameterCount;
+  };
+
+  void AddNode(int64_t tag, Node &&node, double value, double offset);
+  void Compile();
+  double Interpolate(const Step &step, double value) const noexcept;
+
+  static constexpr int64_t NoTag = -1;
+
+  std::vector<Node> m_nodes;
+  std::vector<int64_t> m_slotTags;
+  std::vector<uint32_t> m_freeSlots;
+  TagIndex m_slotIndexes;
+  size_t m_nodeCount{0};
+
+  std::vector<double> m_rawValues;
+  std::vector<double> m_offsets;
+
+  std::vector<Step> m_steps;
+  std::vector<uint32_t> m_stepInputs;
+  std::vector<double> m_stepParameters;
+  bool m_graphChanged{false};
+  bool m_valuesChanged{false};
+};
+
+template <class TReadValue>
+void AnimatedGraphEvaluator::SyncValueNodes(TReadValue &&readValue) {
+  for (uint32_t slot = 0; slot < m_slotTags.size(); ++slot) {
+    if (m_slotTags[slot] == NoTag || m_nodes[slot].Operator != AnimatedGraphOperator::Value) {
+      continue;
+    }
+
+    double rawValue = m_rawValues[slot];
+    double offset = m_offsets[slot];
+    readValue(m_slotTags[slot], rawValue, offset);
+    if (rawValue != m_rawValues[slot] || offset != m_offsets[slot]) {
+      m_rawValues[slot] = rawValue;
+      m_offsets[slot] = offset;
+      m_valuesChanged = true;
+    }
+  }
+}
+
+} // namespace Microsoft::ReactNative
@@ -27,6 +27,10 @@ void AnimatedNode::RemoveChild(const int64_t tag) {
   }
 }
 
+bool AnimatedNode::HasChild(int64_t tag) const noexcept {
+  return std::find(m_children.begin(), m_children.end(), tag) != m_children.end();
+}
+
 AnimatedNode *AnimatedNode::GetChildNode(int64_t tag) {
   if (std::find(m_children.begin(), m_children.end(), tag) != m_children.end()) {
     if (const auto manager = m_manager.lock()) {
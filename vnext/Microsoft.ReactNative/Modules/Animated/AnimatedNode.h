@@ -15,6 +15,7 @@ class AnimatedNode {
   int64_t Tag();
   void AddChild(int64_t animatedNode);
   void RemoveChild(int64_t animatedNode);
+  bool HasChild(int64_t animatedNode) const noexcept;
 
   virtual void Update(){};
   virtual void OnDetachedFromNode(int64_t /*animatedNodeTag*/){};
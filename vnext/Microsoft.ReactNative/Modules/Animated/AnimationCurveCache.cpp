@@ -0,0 +1,152 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <math.h>
+#include <tuple>
+#include "AnimationCurveCache.h"
+
+namespace Microsoft::ReactNative {
+
+static constexpr double FrameDuration = 1.0 / 60.0;
+
+AnimationCurve GenerateSpringCurve(const SpringCurveConfig &config) noexcept {
+  const auto c = config.Damping;
+  const auto m = config.Mass;
+  const auto k = config.Stiffness;
+  const auto v0 = -config.InitialVelocity;
+  const auto x0 = config.Distance;
+
+  const auto zeta = c / (2 * std::sqrt(k * m));
+  const auto omega0 = std::sqrt(k / m);
+
+  const auto isDone = [&config, k, x0](double offset, double velocity) noexcept {
+    const bool isAtRest = std::abs(velocity) <= config.RestSpeedThreshold &&
+        (std::abs(x0 - offset) <= config.RestDisplacementThreshold || k == 0);
+    const bool isOvershooting =
+        config.OvershootClamping && k > 0 && ((x0 > 0 && offset > x0) || (x0 < 0 && offset < x0));
+    return isAtRest || isOvershooting;
+  };
+
+  AnimationCurve curve;
+  if (zeta < 1) {
+    const auto omega1 = omega0 * std::sqrt(1.0 - (zeta * zeta));
+    const auto b = (v0 + zeta * omega0 * x0) / omega1;
+
+    // exp(-zeta * omega0 * time), cos(omega1 * time) and sin(omega1 * time) at the current frame.
+    const auto envelopeStep = std::exp(-zeta * omega0 * FrameDuration);
+    const auto cosStep = std::cos(omega1 * FrameDuration);
+    const auto sinStep = std::sin(omega1 * FrameDuration);
+    double envelope = 1;
+    double cosine = 1;
+    double sine = 0;
+    for (;;) {
+      envelope *= envelopeStep;
+      const auto nextCosine = cosine * cosStep - sine * sinStep;
+      sine = sine * cosStep + cosine * sinStep;
+      cosine = nextCosine;
+
+      const auto displacement = envelope * (b * sine + x0 * cosine);
+      const auto velocity = zeta * omega0 * displacement - envelope * omega1 * (b * cosine - x0 * sine);
+      const auto offset = x0 - displacement;
+      curve.push_back(static_cast<float>(offset));
+      if (isDone(offset, velocity)) {
+        break;
+      }
+    }
+  } else {
+    const auto envelopeStep = std::exp(-omega0 * FrameDuration);
+    double envelope = 1;
+    for (int frame = 1;; ++frame) {
+      const auto time = frame * FrameDuration;
+      envelope *= envelopeStep;
+
+      const auto offset = x0 - envelope * (x0 + (v0 + omega0 * x0) * time);
+      const auto velocity = envelope * (v0 * (time * omega0 - 1) + time * x0 * (omega0 * omega0));
+      curve.push_back(static_cast<float>(offset));
+      if (isDone(offset, velocity)) {
+        break;
+      }
+    }
+  }
+
+  return curve;
+}
+
+AnimationCurve GenerateDecayCurve(const DecayCurveConfig &config) noexcept {
+  const auto rate = 1 - config.Deceleration;
+  const auto distance = config.Velocity / rate;
+
+  // The time of the decay formula is in milliseconds.
+  const auto envelopeStep = std::exp(-rate * 1000 * FrameDuration);
+  double envelope = 1;
+  AnimationCurve curve;
+  for (;;) {
+    envelope *= envelopeStep;
+    const auto offset = distance * (1 - envelope);
+    curve.push_back(static_cast<float>(offset));
+    if (std::abs(distance - offset) < 0.1) {
+      break;
+    }
+  }
+
+  return curve;
+}
+
+std::shared_ptr<const AnimationCurve> AnimationCurveCache::GetSpringCurve(const SpringCurveConfig &config) noexcept {
+  return GetCurve(m_springCurves, config, GenerateSpringCurve);
+}
+
+std::shared_ptr<const AnimationCurve> AnimationCurveCache::GetDecayCurve(const DecayCurveConfig &config) noexcept {
+  return GetCurve(m_decayCurves, config, GenerateDecayCurve);
+}
+
+template <typename TConfig, typename TCurves, typename TGenerate>
+std::shared_ptr<const AnimationCurve>
+AnimationCurveCache::GetCurve(TCurves &curves, const TConfig &config, TGenerate generate) noexcept {
+  auto it = curves.find(config);
+  if (it != curves.end()) {
+    ++m_hitCount;
+    return it->second;
+  }
+
+  // The configs of an app are few. Dropping all curves is enough to bound apps that generate configs.
+  ++m_missCount;
+  if (curves.size() >= MaxCurveCount) {
+    curves.clear();
+  }
+
+  auto curve = std::make_shared<const AnimationCurve>(generate(config));
+  curves.emplace(config, curve);
+  return curve;
+}
+
+bool AnimationCurveCache::ConfigLess::operator()(const SpringCurveConfig &left, const SpringCurveConfig &right)
+    const noexcept {
+  return std::tie(
+             left.Stiffness,
+             left.Damping,
+             left.Mass,
+             left.InitialVelocity,
+             left.Distance,
+             left.RestSpeedThreshold,
+             left.RestDisplacementThreshold,
+             left.OvershootClamping) <
+      std::tie(
+             right.Stiffness,
+             right.Damping,
+             right.Mass,
+             right.InitialVelocity,
+             right.Distance,
+             right.RestSpeedThreshold,
+             right.RestDisplacementThreshold,
+             right.OvershootClamping);
+}
+
+bool AnimationCurveCache::ConfigLess::operator()(const DecayCurveConfig &left, const DecayCurveConfig &right)
+    const noexcept {
+  return std::tie(left.Velocity, left.Deceleration) < std::tie(right.Velocity, right.Deceleration);
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+// The keyframes of a calculated animation: the offsets of the animated value from its start value,
+// one per frame at 60 frames per second. The last keyframe is the first one where the animation is done.
+using AnimationCurve = std::vector<float>;
+
+// The spring config with the distance from the start value to the end value.
+// The curve does not depend on the start value itself.
+struct SpringCurveConfig {
+  double Stiffness{0};
+  double Damping{0};
+  double Mass{0};
+  double InitialVelocity{0};
+  double Distance{0};
+  double RestSpeedThreshold{0};
+  double RestDisplacementThreshold{0};
+  bool OvershootClamping{false};
+};
+
+struct DecayCurveConfig {
+  double Velocity{0};
+  double Deceleration{0};
+};
+
+// Samples the same closed-form physics as the spring and decay animation drivers. The exponential envelope and
+// the oscillation are advanced by a constant factor and a constant rotation per frame, so that sampling needs
+// no exp, sin or cos calls.
+AnimationCurve GenerateSpringCurve(const SpringCurveConfig &config) noexcept;
+AnimationCurve GenerateDecayCurve(const DecayCurveConfig &config) noexcept;
+
+// Shares the curves of animations with the same config, such as the same spring started for every list item.
+class AnimationCurveCache {
+ public:
+  static constexpr size_t MaxCurveCount = 64;
+
+  std::shared_ptr<const AnimationCurve> GetSpringCurve(const SpringCurveConfig &config) noexcept;
+  std::shared_ptr<const AnimationCurve> GetDecayCurve(const DecayCurveConfig &config) noexcept;
+
+  size_t HitCount() const noexcept {
+    return m_hitCount;
+  }
+
+  size_t MissCount() const noexcept {
+    return m_missCount;
+  }
+
+ private:
+  template <typename TConfig, typename TCurves, typename TGenerate>
+  std::shared_ptr<const AnimationCurve> GetCurve(TCurves &curves, const TConfig &config, TGenerate generate) noexcept;
+
+  struct ConfigLess {
+    bool operator()(const SpringCurveConfig &left, const SpringCurveConfig &right) const noexcept;
+    bool operator()(const DecayCurveConfig &left, const DecayCurveConfig &right) const noexcept;
+  };
+
+  std::map<SpringCurveConfig, std::shared_ptr<const AnimationCurve>, ConfigLess> m_springCurves;
+  std::map<DecayCurveConfig, std::shared_ptr<const AnimationCurve>, ConfigLess> m_decayCurves;
+  size_t m_hitCount{0};
+  size_t m_missCount{0};
+};
+
+} // namespace Microsoft::ReactNative
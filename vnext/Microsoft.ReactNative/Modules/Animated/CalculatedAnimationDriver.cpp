@@ -19,29 +19,16 @@ std::tuple<comp::CompositionAnimation, comp::CompositionScopedBatch> CalculatedA
   }();
 
   m_startValue = GetAnimatedValue()->Value();
-  std::vector<float> keyFrames = [this]() {
-    std::vector<float> keyFrames;
-    bool done = false;
-    double time = 0;
-    while (!done) {
-      time += 1.0f / 60.0f;
-      auto [currentValue, currentVelocity] = GetValueAndVelocityForTime(time);
-      keyFrames.push_back(currentValue);
-      if (IsAnimationDone(currentValue, currentVelocity)) {
-        done = true;
-      }
-    }
-    return keyFrames;
-  }();
+  const auto keyFrames = GetKeyFrameOffsets();
 
-  std::chrono::milliseconds duration(static_cast<int>(keyFrames.size() / 60.0f * 1000.0f));
+  std::chrono::milliseconds duration(static_cast<int>(keyFrames->size() / 60.0f * 1000.0f));
   animation.Duration(duration);
   auto normalizedProgress = 0.0f;
   // We are animating the values offset property which should start at 0.
   animation.InsertKeyFrame(normalizedProgress, 0.0f, easingFunction);
-  for (const auto keyFrame : keyFrames) {
-    normalizedProgress = std::min(normalizedProgress + 1.0f / keyFrames.size(), 1.0f);
-    animation.InsertKeyFrame(normalizedProgress, keyFrame - static_cast<float>(m_startValue), easingFunction);
+  for (const auto keyFrame : *keyFrames) {
+    normalizedProgress = std::min(normalizedProgress + 1.0f / keyFrames->size(), 1.0f);
+    animation.InsertKeyFrame(normalizedProgress, keyFrame, easingFunction);
   }
 
   if (m_iterations == -1) {
@@ -54,4 +41,19 @@ std::tuple<comp::CompositionAnimation, comp::CompositionScopedBatch> CalculatedA
   return std::make_tuple(animation, scopedBatch);
 }
 
+std::shared_ptr<const AnimationCurve> CalculatedAnimationDriver::GetKeyFrameOffsets() {
+  auto keyFrames = std::make_shared<AnimationCurve>();
+  bool done = false;
+  double time = 0;
+  while (!done) {
+    time += 1.0f / 60.0f;
+    auto [currentValue, currentVelocity] = GetValueAndVelocityForTime(time);
+    keyFrames->push_back(currentValue - static_cast<float>(m_startValue));
+    if (IsAnimationDone(currentValue, currentVelocity)) {
+      done = true;
+    }
+  }
+  return keyFrames;
+}
+
 } // namespace Microsoft::ReactNative
@@ -5,6 +5,7 @@
 #include <folly/dynamic.h>
 #include <utility>
 #include "AnimatedNode.h"
+#include "AnimationCurveCache.h"
 #include "AnimationDriver.h"
 
 namespace Microsoft::ReactNative {
@@ -19,6 +20,11 @@ class CalculatedAnimationDriver : public AnimationDriver {
   virtual std::tuple<float, double> GetValueAndVelocityForTime(double time) = 0;
 
   virtual bool IsAnimationDone(double currentValue, double currentVelocity) = 0;
+
+  // The keyframes of the animation as offsets from m_startValue. Drivers whose curve only depends on their
+  // config share it through the curve cache of the manager.
+  virtual std::shared_ptr<const AnimationCurve> GetKeyFrameOffsets();
+
   double m_startValue{0};
 };
 } // namespace Microsoft::ReactNative
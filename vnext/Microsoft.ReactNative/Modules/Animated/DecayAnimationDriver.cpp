@@ -30,6 +30,17 @@ bool DecayAnimationDriver::IsAnimationDone(double currentValue, double /*current
   return (std::abs(ToValue() - currentValue) < 0.1);
 }
 
+std::shared_ptr<const AnimationCurve> DecayAnimationDriver::GetKeyFrameOffsets() {
+  if (auto const manager = m_manager.lock()) {
+    DecayCurveConfig config;
+    config.Velocity = m_velocity;
+    config.Deceleration = m_deceleration;
+    return manager->GetCurveCache().GetDecayCurve(config);
+  }
+
+  return CalculatedAnimationDriver::GetKeyFrameOffsets();
+}
+
 double DecayAnimationDriver::ToValue() {
   auto const startValue = [this]() {
     if (auto const manager = m_manager.lock()) {
@@ -21,6 +21,7 @@ class DecayAnimationDriver : public CalculatedAnimationDriver {
  protected:
   std::tuple<float, double> GetValueAndVelocityForTime(double time) override;
   bool IsAnimationDone(double currentValue, double currentVelocity) override;
+  std::shared_ptr<const AnimationCurve> GetKeyFrameOffsets() override;
 
  private:
   double m_velocity{0};
@@ -29,17 +29,8 @@ NativeAnimatedModule::~NativeAnimatedModule() {
 
 std::vector<facebook::xplat::module::CxxModule::Method> NativeAnimatedModule::getMethods() {
   return {
-      Method(
-          "startOperationBatch",
-          [](folly::dynamic /*args*/) {
-            // NYI #6161
-          }),
-
-      Method(
-          "finishOperationBatch",
-          [](folly::dynamic /*args*/) {
-            // NYI #6161
-          }),
+      Method("startOperationBatch", [this](folly::dynamic /*args*/) { NativeAnimatedModule::StartOperationBatch(); }),
+      Method("finishOperationBatch", [this](folly::dynamic /*args*/) { NativeAnimatedModule::FinishOperationBatch(); }),
       Method(
           "createAnimatedNode",
           [this](folly::dynamic args) {
@@ -158,28 +149,42 @@ std::vector<facebook::xplat::module::CxxModule::Method> NativeAnimatedModule::ge
   };
 }
 
+void NativeAnimatedModule::StartOperationBatch() {
+  m_nodesManager->StartOperationBatch();
+}
+
+void NativeAnimatedModule::FinishOperationBatch() {
+  m_nodesManager->FinishOperationBatch();
+}
+
 void NativeAnimatedModule::CreateAnimatedNode(int64_t tag, const folly::dynamic &config) {
-  m_nodesManager->CreateAnimatedNode(tag, config, m_context, m_nodesManager);
+  m_nodesManager->QueueOperation([this, tag, config]() {
+    m_nodesManager->CreateAnimatedNode(tag, config, m_context, m_nodesManager);
+  });
 }
 
 void NativeAnimatedModule::GetValue(int64_t animatedNodeTag, const Callback &saveValueCallback) {
-  m_nodesManager->GetValue(animatedNodeTag, saveValueCallback);
+  m_nodesManager->QueueOperation([this, animatedNodeTag, saveValueCallback]() {
+    m_nodesManager->GetValue(animatedNodeTag, saveValueCallback);
+  });
 }
 
 void NativeAnimatedModule::ConnectAnimatedNodeToView(int64_t animatedNodeTag, int64_t viewTag) {
-  m_nodesManager->ConnectAnimatedNodeToView(animatedNodeTag, viewTag);
+  m_nodesManager->QueueOperation(
+      [this, animatedNodeTag, viewTag]() { m_nodesManager->ConnectAnimatedNodeToView(animatedNodeTag, viewTag); });
 }
 
 void NativeAnimatedModule::DisconnectAnimatedNodeFromView(int64_t animatedNodeTag, int64_t viewTag) {
-  m_nodesManager->DisconnectAnimatedNodeToView(animatedNodeTag, viewTag);
+  m_nodesManager->QueueOperation(
+      [this, animatedNodeTag, viewTag]() { m_nodesManager->DisconnectAnimatedNodeToView(animatedNodeTag, viewTag); });
 }
 
 void NativeAnimatedModule::ConnectAnimatedNodes(int64_t parentNodeTag, int64_t childNodeTag) {
-  m_nodesManager->ConnectAnimatedNode(parentNodeTag, childNodeTag);
+  m_nodesManager->QueueEdgeOperation(parentNodeTag, childNodeTag, true);
 }
 
 void NativeAnimatedModule::DisconnectAnimatedNodes(int64_t parentNodeTag, int64_t childNodeTag) {
-  m_nodesManager->DisconnectAnimatedNode(parentNodeTag, childNodeTag);
+  m_nodesManager->QueueEdgeOperation(parentNodeTag, childNodeTag, false);
 }
 
 void NativeAnimatedModule::StartAnimatingNode(
@@ -187,45 +192,51 @@ void NativeAnimatedModule::StartAnimatingNode(
     int64_t animatedNodeTag,
     const folly::dynamic &animationConfig,
     const Callback &endCallback) {
-  m_nodesManager->StartAnimatingNode(animationId, animatedNodeTag, animationConfig, endCallback, m_nodesManager);
+  m_nodesManager->QueueOperation([this, animationId, animatedNodeTag, animationConfig, endCallback]() {
+    m_nodesManager->StartAnimatingNode(animationId, animatedNodeTag, animationConfig, endCallback, m_nodesManager);
+  });
 }
 
 void NativeAnimatedModule::StopAnimation(int64_t animationId) {
-  m_nodesManager->StopAnimation(animationId);
+  m_nodesManager->QueueOperation([this, animationId]() { m_nodesManager->StopAnimation(animationId); });
 }
 
 void NativeAnimatedModule::DropAnimatedNode(int64_t tag) {
-  m_nodesManager->DropAnimatedNode(tag);
+  m_nodesManager->QueueOperation([this, tag]() { m_nodesManager->DropAnimatedNode(tag); });
 }
 
 void NativeAnimatedModule::SetAnimatedNodeValue(int64_t tag, double value) {
-  m_nodesManager->SetAnimatedNodeValue(tag, value);
+  m_nodesManager->QueueOperation([this, tag, value]() { m_nodesManager->SetAnimatedNodeValue(tag, value); });
 }
 
 void NativeAnimatedModule::SetAnimatedNodeOffset(int64_t tag, double offset) {
-  m_nodesManager->SetAnimatedNodeOffset(tag, offset);
+  m_nodesManager->QueueOperation([this, tag, offset]() { m_nodesManager->SetAnimatedNodeOffset(tag, offset); });
 }
 
 void NativeAnimatedModule::FlattenAnimatedNodeOffset(int64_t tag) {
-  m_nodesManager->FlattenAnimatedNodeOffset(tag);
+  m_nodesManager->QueueOperation([this, tag]() { m_nodesManager->FlattenAnimatedNodeOffset(tag); });
 }
 
 void NativeAnimatedModule::ExtractAnimatedNodeOffset(int64_t tag) {
-  m_nodesManager->ExtractAnimatedNodeOffset(tag);
+  m_nodesManager->QueueOperation([this, tag]() { m_nodesManager->ExtractAnimatedNodeOffset(tag); });
 }
 
 void NativeAnimatedModule::AddAnimatedEventToView(
     int64_t tag,
     const std::string &eventName,
     const folly::dynamic &eventMapping) {
-  m_nodesManager->AddAnimatedEventToView(tag, eventName, eventMapping, m_nodesManager);
+  m_nodesManager->QueueOperation([this, tag, eventName, eventMapping]() {
+    m_nodesManager->AddAnimatedEventToView(tag, eventName, eventMapping, m_nodesManager);
+  });
 }
 
 void NativeAnimatedModule::RemoveAnimatedEventFromView(
     int64_t tag,
     const std::string &eventName,
     int64_t animatedValueTag) {
-  m_nodesManager->RemoveAnimatedEventFromView(tag, eventName, animatedValueTag);
+  m_nodesManager->QueueOperation([this, tag, eventName, animatedValueTag]() {
+    m_nodesManager->RemoveAnimatedEventFromView(tag, eventName, animatedValueTag);
+  });
 }
 
 void NativeAnimatedModule::StartListeningToAnimatedNodeValue(int64_t /*tag*/) {
@@ -67,6 +67,8 @@ class NativeAnimatedModule final : public facebook::xplat::module::CxxModule {
   };
   auto getMethods() -> std::vector<Method> override;
 
+  void StartOperationBatch();
+  void FinishOperationBatch();
   void CreateAnimatedNode(int64_t tag, const folly::dynamic &config);
   void GetValue(int64_t tag, const Callback &endCallback);
   void ConnectAnimatedNodeToView(int64_t animatedNodeTag, int64_t viewTag);
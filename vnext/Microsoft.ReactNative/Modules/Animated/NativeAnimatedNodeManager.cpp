@@ -20,71 +20,135 @@
 
 #include "AnimatedNodeType.h"
 #include "AnimationType.h"
+#include "ExtrapolationType.h"
 #include "FacadeType.h"
 
 #include <Modules/NativeUIManager.h>
 #include <Modules/PaperUIManagerModule.h>
 #include <Windows.Foundation.h>
+#include "cdebug.h"
 
 namespace Microsoft::ReactNative {
+void NativeAnimatedNodeManager::StartOperationBatch() noexcept {
+  m_inOperationBatch = true;
+}
+
+void NativeAnimatedNodeManager::FinishOperationBatch() {
+  m_inOperationBatch = false;
+  auto operations = std::move(m_queuedOperations);
+  m_queuedOperations.clear();
+
+  // Mounting a screen creates and connects many nodes in one batch. Consecutive edge operations are staged, so
+  // that the edges that are disconnected and connected again are left as they are. The staged edges are applied
+  // before any other operation, which may read the graph. A failed operation does not stop the batch.
+  std::exception_ptr firstError;
+  for (auto &operation : operations) {
+    if (operation.Apply) {
+      ApplyPendingEdges(firstError);
+      ApplyOperation(operation.Apply, firstError);
+    } else {
+      StageEdge(operation.Edge);
+    }
+  }
+
+  ApplyPendingEdges(firstError);
+  if (firstError) {
+    std::rethrow_exception(firstError);
+  }
+}
+
+void NativeAnimatedNodeManager::QueueOperation(std::function<void()> &&operation) {
+  if (m_inOperationBatch) {
+    m_queuedOperations.push_back(QueuedOperation{std::move(operation), {}});
+  } else {
+    operation();
+  }
+}
+
+void NativeAnimatedNodeManager::QueueEdgeOperation(int64_t parentNodeTag, int64_t childNodeTag, bool connect) {
+  if (m_inOperationBatch) {
+    m_queuedOperations.push_back(QueuedOperation{nullptr, {parentNodeTag, childNodeTag, connect}});
+  } else {
+    ApplyEdge({parentNodeTag, childNodeTag, connect});
+  }
+}
+
+template <typename TOperation>
+void NativeAnimatedNodeManager::ApplyOperation(const TOperation &operation, std::exception_ptr &firstError) noexcept {
+  try {
+    operation();
+  } catch (const std::exception &e) {
+    cdebug << "[NativeAnimated] Operation failed: " << e.what() << "\n";
+    if (!firstError) {
+      firstError = std::current_exception();
+    }
+  } catch (...) {
+    cdebug << "[NativeAnimated] Operation failed\n";
+    if (!firstError) {
+      firstError = std::current_exception();
+    }
+  }
+}
+
 void NativeAnimatedNodeManager::CreateAnimatedNode(
     int64_t tag,
     const folly::dynamic &config,
     const Mso::CntPtr<Mso::React::IReactContext> &context,
     const std::shared_ptr<NativeAnimatedNodeManager> &manager) {
-  if (m_transformNodes.count(tag) > 0 || m_propsNodes.count(tag) > 0 || m_styleNodes.count(tag) > 0 ||
-      m_valueNodes.count(tag) > 0) {
+  if (FindNodeSlot(tag)) {
     throw std::invalid_argument("AnimatedNode with tag " + std::to_string(tag) + " already exists.");
     return;
   }
 
-  switch (const auto type = AnimatedNodeTypeFromString(config.find("type").dereference().second.getString())) {
+  std::unique_ptr<AnimatedNode> node;
+  const auto type = AnimatedNodeTypeFromString(config.find("type").dereference().second.getString());
+  switch (type) {
     case AnimatedNodeType::Style: {
-      m_styleNodes.emplace(tag, std::make_unique<StyleAnimatedNode>(tag, config, manager));
+      node = std::make_unique<StyleAnimatedNode>(tag, config, manager);
       break;
     }
     case AnimatedNodeType::Value: {
-      m_valueNodes.emplace(tag, std::make_unique<ValueAnimatedNode>(tag, config, manager));
+      node = std::make_unique<ValueAnimatedNode>(tag, config, manager);
       break;
     }
     case AnimatedNodeType::Props: {
-      m_propsNodes.emplace(tag, std::make_unique<PropsAnimatedNode>(tag, config, context, manager));
+      node = std::make_unique<PropsAnimatedNode>(tag, config, context, manager);
       break;
     }
     case AnimatedNodeType::Interpolation: {
-      m_valueNodes.emplace(tag, std::make_unique<InterpolationAnimatedNode>(tag, config, manager));
+      node = std::make_unique<InterpolationAnimatedNode>(tag, config, manager);
       break;
     }
     case AnimatedNodeType::Addition: {
-      m_valueNodes.emplace(tag, std::make_unique<AdditionAnimatedNode>(tag, config, manager));
+      node = std::make_unique<AdditionAnimatedNode>(tag, config, manager);
       break;
     }
     case AnimatedNodeType::Subtraction: {
-      m_valueNodes.emplace(tag, std::make_unique<SubtractionAnimatedNode>(tag, config, manager));
+      node = std::make_unique<SubtractionAnimatedNode>(tag, config, manager);
       break;
     }
     case AnimatedNodeType::Division: {
-      m_valueNodes.emplace(tag, std::make_unique<DivisionAnimatedNode>(tag, config, manager));
+      node = std::make_unique<DivisionAnimatedNode>(tag, config, manager);
       break;
     }
     case AnimatedNodeType::Multiplication: {
-      m_valueNodes.emplace(tag, std::make_unique<MultiplicationAnimatedNode>(tag, config, manager));
+      node = std::make_unique<MultiplicationAnimatedNode>(tag, config, manager);
       break;
     }
     case AnimatedNodeType::Modulus: {
-      m_valueNodes.emplace(tag, std::make_unique<ModulusAnimatedNode>(tag, config, manager));
+      node = std::make_unique<ModulusAnimatedNode>(tag, config, manager);
       break;
     }
     case AnimatedNodeType::Diffclamp: {
-      m_valueNodes.emplace(tag, std::make_unique<DiffClampAnimatedNode>(tag, config, manager));
+      node = std::make_unique<DiffClampAnimatedNode>(tag, config, manager);
       break;
     }
     case AnimatedNodeType::Transform: {
-      m_transformNodes.emplace(tag, std::make_unique<TransformAnimatedNode>(tag, config, manager));
+      node = std::make_unique<TransformAnimatedNode>(tag, config, manager);
       break;
     }
     case AnimatedNodeType::Tracking: {
-      m_trackingNodes.emplace(tag, std::make_unique<TrackingAnimatedNode>(tag, config, manager));
+      node = std::make_unique<TrackingAnimatedNode>(tag, config, manager);
       break;
     }
     default: {
@@ -92,31 +156,137 @@ void NativeAnimatedNodeManager::CreateAnimatedNode(
       break;
     }
   }
+
+  if (node) {
+    AddNode(tag, type, std::move(node));
+    AddGraphEvaluatorNode(tag, type, config);
+  }
+}
+
+void NativeAnimatedNodeManager::AddGraphEvaluatorNode(
+    int64_t tag,
+    AnimatedNodeType type,
+    const folly::dynamic &config) {
+  const auto getDouble = [&config](const char *name) { return config.find(name).dereference().second.asDouble(); };
+  const auto getInteger = [&getDouble](const char *name) { return static_cast<int64_t>(getDouble(name)); };
+  const auto getInputTags = [&config]() {
+    std::vector<int64_t> inputTags;
+    for (const auto &inputNode : config.find("input").dereference().second) {
+      inputTags.push_back(static_cast<int64_t>(inputNode.asDouble()));
+    }
+    return inputTags;
+  };
+
+  switch (type) {
+    case AnimatedNodeType::Value:
+      m_graphEvaluator.AddValueNode(tag, getDouble("value"), getDouble("offset"));
+      break;
+    case AnimatedNodeType::Interpolation: {
+      std::vector<double> inputRange;
+      for (const auto &rangeValue : config.find("inputRange").dereference().second) {
+        inputRange.push_back(rangeValue.asDouble());
+      }
+      std::vector<double> outputRange;
+      for (const auto &rangeValue : config.find("outputRange").dereference().second) {
+        outputRange.push_back(rangeValue.asDouble());
+      }
+      m_graphEvaluator.AddInterpolationNode(
+          tag,
+          std::move(inputRange),
+          std::move(outputRange),
+          ExtrapolationTypeFromString(config.find("extrapolateLeft").dereference().second.asString()),
+          ExtrapolationTypeFromString(config.find("extrapolateRight").dereference().second.asString()));
+      break;
+    }
+    case AnimatedNodeType::Addition:
+      m_graphEvaluator.AddOperatorNode(tag, AnimatedGraphOperator::Addition, getInputTags());
+      break;
+    case AnimatedNodeType::Subtraction:
+      m_graphEvaluator.AddOperatorNode(tag, AnimatedGraphOperator::Subtraction, getInputTags());
+      break;
+    case AnimatedNodeType::Multiplication:
+      m_graphEvaluator.AddOperatorNode(tag, AnimatedGraphOperator::Multiplication, getInputTags());
+      break;
+    case AnimatedNodeType::Division:
+      m_graphEvaluator.AddOperatorNode(tag, AnimatedGraphOperator::Division, getInputTags());
+      break;
+    case AnimatedNodeType::Modulus:
+      m_graphEvaluator.AddModulusNode(tag, getInteger("input"), static_cast<double>(getInteger("modulus")));
+      break;
+    case AnimatedNodeType::Diffclamp:
+      m_graphEvaluator.AddDiffClampNode(tag, getInteger("input"), getDouble("min"), getDouble("max"));
+      m_graphEvaluator.SetOffset(tag, getDouble("offset"));
+      break;
+    default:
+      break;
+  }
 }
 
 void NativeAnimatedNodeManager::GetValue(int64_t animatedNodeTag, const Callback &saveValueCallback) {
-  if (const auto valueNode = m_valueNodes.at(animatedNodeTag).get()) {
-    saveValueCallback(std::vector<folly::dynamic>{folly::dynamic(valueNode->Value())});
+  if (const auto valueNode = GetValueAnimatedNode(animatedNodeTag)) {
+    // The other nodes are computed by composition expressions, which cannot be read back from their
+    // property sets. Their values are evaluated from the values of their inputs instead. The inputs are read
+    // from their property sets first, because the animations that drove them may have stopped since.
+    auto value = valueNode->Value();
+    if (FindNodeSlot(animatedNodeTag)->Type != AnimatedNodeType::Value) {
+      m_graphEvaluator.SyncValueNodes([this](int64_t tag, double &rawValue, double &offset) {
+        if (const auto inputNode = GetValueAnimatedNode(tag)) {
+          rawValue = inputNode->RawValue();
+          offset = inputNode->Offset();
+        }
+      });
+      m_graphEvaluator.Update();
+      m_graphEvaluator.TryGetValue(animatedNodeTag, value);
+    }
+
+    saveValueCallback(std::vector<folly::dynamic>{folly::dynamic(value)});
   }
 }
 
 void NativeAnimatedNodeManager::ConnectAnimatedNodeToView(int64_t propsNodeTag, int64_t viewTag) {
-  m_propsNodes.at(propsNodeTag)->ConnectToView(viewTag);
+  if (const auto propsNode = GetPropsAnimatedNode(propsNodeTag)) {
+    propsNode->ConnectToView(viewTag);
+  }
 }
 
 void NativeAnimatedNodeManager::DisconnectAnimatedNodeToView(int64_t propsNodeTag, int64_t viewTag) {
-  m_propsNodes.at(propsNodeTag)->DisconnectFromView(viewTag);
+  if (const auto propsNode = GetPropsAnimatedNode(propsNodeTag)) {
+    propsNode->DisconnectFromView(viewTag);
+  }
 }
 
 void NativeAnimatedNodeManager::ConnectAnimatedNode(int64_t parentNodeTag, int64_t childNodeTag) {
-  if (const auto parentNode = GetAnimatedNode(parentNodeTag)) {
-    parentNode->AddChild(childNodeTag);
-  }
+  ApplyEdge({parentNodeTag, childNodeTag, true});
 }
 
 void NativeAnimatedNodeManager::DisconnectAnimatedNode(int64_t parentNodeTag, int64_t childNodeTag) {
-  if (const auto parentNode = GetAnimatedNode(parentNodeTag)) {
-    parentNode->RemoveChild(childNodeTag);
+  ApplyEdge({parentNodeTag, childNodeTag, false});
+}
+
+void NativeAnimatedNodeManager::StageEdge(const AnimatedEdgeQueue::Edge &edge) {
+  const auto parentNode = GetAnimatedNode(edge.ParentTag);
+  m_pendingEdges.Stage(edge, parentNode && parentNode->HasChild(edge.ChildTag));
+}
+
+void NativeAnimatedNodeManager::ApplyEdge(const AnimatedEdgeQueue::Edge &edge) {
+  if (const auto parentNode = GetAnimatedNode(edge.ParentTag)) {
+    if (edge.Connect) {
+      parentNode->AddChild(edge.ChildTag);
+      m_graphEvaluator.ConnectNodes(edge.ParentTag, edge.ChildTag);
+    } else {
+      parentNode->RemoveChild(edge.ChildTag);
+      m_graphEvaluator.DisconnectNodes(edge.ParentTag, edge.ChildTag);
+    }
+  }
+}
+
+void NativeAnimatedNodeManager::ApplyPendingEdges(std::exception_ptr &firstError) noexcept {
+  if (m_pendingEdges.IsEmpty()) {
+    return;
+  }
+
+  for (const auto &edge : m_pendingEdges.Take()) {
+    ApplyOperation([this, &edge]() { ApplyEdge(edge); }, firstError);
   }
 }
 
@@ -253,32 +423,37 @@ void NativeAnimatedNodeManager::StartAnimatingNode(
 }
 
 void NativeAnimatedNodeManager::DropAnimatedNode(int64_t tag) {
-  m_valueNodes.erase(tag);
-  m_propsNodes.erase(tag);
-  m_styleNodes.erase(tag);
-  m_transformNodes.erase(tag);
+  const auto slotIndex = m_nodeSlotIndexes.Find(tag);
+  if (slotIndex == TagIndex::NoIndex) {
+    return;
+  }
+
+  const auto node = std::move(m_nodeSlots[slotIndex].Node);
+  m_nodeSlotIndexes.Set(tag, TagIndex::NoIndex);
+  m_freeNodeSlots.push_back(slotIndex);
+  m_graphEvaluator.RemoveNode(tag);
 }
 
 void NativeAnimatedNodeManager::SetAnimatedNodeValue(int64_t tag, double value) {
-  if (const auto valueNode = m_valueNodes.at(tag).get()) {
+  if (const auto valueNode = GetValueAnimatedNode(tag)) {
     valueNode->RawValue(static_cast<float>(value));
   }
 }
 
 void NativeAnimatedNodeManager::SetAnimatedNodeOffset(int64_t tag, double offset) {
-  if (const auto valueNode = m_valueNodes.at(tag).get()) {
+  if (const auto valueNode = GetValueAnimatedNode(tag)) {
     valueNode->Offset(static_cast<float>(offset));
   }
 }
 
 void NativeAnimatedNodeManager::FlattenAnimatedNodeOffset(int64_t tag) {
-  if (const auto valueNode = m_valueNodes.at(tag).get()) {
+  if (const auto valueNode = GetValueAnimatedNode(tag)) {
     valueNode->FlattenOffset();
   }
 }
 
 void NativeAnimatedNodeManager::ExtractAnimatedNodeOffset(int64_t tag) {
-  if (const auto valueNode = m_valueNodes.at(tag).get()) {
+  if (const auto valueNode = GetValueAnimatedNode(tag)) {
     valueNode->ExtractOffset();
   }
 }
@@ -332,8 +507,8 @@ void NativeAnimatedNodeManager::ProcessDelayedPropsNodes() {
   const auto delayedPropsNodes = m_delayedPropsNodes;
   m_delayedPropsNodes.clear();
   for (const auto tag : delayedPropsNodes) {
-    if (m_propsNodes.count(tag) > 0) {
-      m_propsNodes.at(tag)->StartAnimations();
+    if (const auto propsNode = GetPropsAnimatedNode(tag)) {
+      propsNode->StartAnimations();
     }
   }
 }
@@ -350,60 +525,92 @@ void NativeAnimatedNodeManager::AddDelayedPropsNode(
 }
 
 AnimatedNode *NativeAnimatedNodeManager::GetAnimatedNode(int64_t tag) {
-  if (m_valueNodes.count(tag)) {
-    return m_valueNodes.at(tag).get();
-  }
-  if (m_styleNodes.count(tag)) {
-    return m_styleNodes.at(tag).get();
-  }
-  if (m_propsNodes.count(tag)) {
-    return m_propsNodes.at(tag).get();
-  }
-  if (m_transformNodes.count(tag)) {
-    return m_transformNodes.at(tag).get();
-  }
-  if (m_trackingNodes.count(tag)) {
-    return m_trackingNodes.at(tag).get();
+  if (const auto slot = FindNodeSlot(tag)) {
+    return slot->Node.get();
   }
   return static_cast<AnimatedNode *>(nullptr);
 }
 
 ValueAnimatedNode *NativeAnimatedNodeManager::GetValueAnimatedNode(int64_t tag) {
-  if (m_valueNodes.count(tag)) {
-    return m_valueNodes.at(tag).get();
+  if (const auto slot = FindNodeSlot(tag); slot && IsValueNodeType(slot->Type)) {
+    return static_cast<ValueAnimatedNode *>(slot->Node.get());
   }
   return static_cast<ValueAnimatedNode *>(nullptr);
 }
 
 PropsAnimatedNode *NativeAnimatedNodeManager::GetPropsAnimatedNode(int64_t tag) {
-  if (m_propsNodes.count(tag)) {
-    return m_propsNodes.at(tag).get();
+  if (const auto slot = FindNodeSlot(tag); slot && slot->Type == AnimatedNodeType::Props) {
+    return static_cast<PropsAnimatedNode *>(slot->Node.get());
   }
   return static_cast<PropsAnimatedNode *>(nullptr);
 }
 
 StyleAnimatedNode *NativeAnimatedNodeManager::GetStyleAnimatedNode(int64_t tag) {
-  if (m_styleNodes.count(tag)) {
-    return m_styleNodes.at(tag).get();
+  if (const auto slot = FindNodeSlot(tag); slot && slot->Type == AnimatedNodeType::Style) {
+    return static_cast<StyleAnimatedNode *>(slot->Node.get());
   }
   return static_cast<StyleAnimatedNode *>(nullptr);
 }
 
 TransformAnimatedNode *NativeAnimatedNodeManager::GetTransformAnimatedNode(int64_t tag) {
-  if (m_transformNodes.count(tag)) {
-    return m_transformNodes.at(tag).get();
+  if (const auto slot = FindNodeSlot(tag); slot && slot->Type == AnimatedNodeType::Transform) {
+    return static_cast<TransformAnimatedNode *>(slot->Node.get());
   }
   return static_cast<TransformAnimatedNode *>(nullptr);
 }
 
 TrackingAnimatedNode *NativeAnimatedNodeManager::GetTrackingAnimatedNode(int64_t tag) {
-  if (m_trackingNodes.count(tag)) {
-    return m_trackingNodes.at(tag).get();
+  if (const auto slot = FindNodeSlot(tag); slot && slot->Type == AnimatedNodeType::Tracking) {
+    return static_cast<TrackingAnimatedNode *>(slot->Node.get());
   }
   return nullptr;
 }
 
+bool NativeAnimatedNodeManager::IsValueNodeType(AnimatedNodeType type) noexcept {
+  switch (type) {
+    case AnimatedNodeType::Value:
+    case AnimatedNodeType::Interpolation:
+    case AnimatedNodeType::Addition:
+    case AnimatedNodeType::Subtraction:
+    case AnimatedNodeType::Division:
+    case AnimatedNodeType::Multiplication:
+    case AnimatedNodeType::Modulus:
+    case AnimatedNodeType::Diffclamp:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const NativeAnimatedNodeManager::AnimatedNodeSlot *NativeAnimatedNodeManager::FindNodeSlot(int64_t tag) const noexcept {
+  const auto slotIndex = m_nodeSlotIndexes.Find(tag);
+  return slotIndex != TagIndex::NoIndex ? &m_nodeSlots[slotIndex] : nullptr;
+}
+
+void NativeAnimatedNodeManager::AddNode(int64_t tag, AnimatedNodeType type, std::unique_ptr<AnimatedNode> &&node) {
+  uint32_t slotIndex;
+  if (!m_freeNodeSlots.empty()) {
+    slotIndex = m_freeNodeSlots.back();
+    m_freeNodeSlots.pop_back();
+  } else {
+    slotIndex = static_cast<uint32_t>(m_nodeSlots.size());
+    m_nodeSlots.emplace_back();
+  }
+
+  m_nodeSlots[slotIndex].Node = std::move(node);
+  m_nodeSlots[slotIndex].Type = type;
+  m_nodeSlotIndexes.Set(tag, slotIndex);
+}
+
 void NativeAnimatedNodeManager::RemoveActiveAnimation(int64_t tag) {
   m_activeAnimations.erase(tag);
 }
+
+AnimationCurveCache &NativeAnimatedNodeManager::GetCurveCache() noexcept {
+  return m_curveCache;
+}
+
+AnimatedGraphEvaluator &NativeAnimatedNodeManager::GetGraphEvaluator() noexcept {
+  return m_graphEvaluator;
+}
 } // namespace Microsoft::ReactNative
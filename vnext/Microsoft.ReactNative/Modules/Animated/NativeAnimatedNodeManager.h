@@ -5,9 +5,14 @@
 // Licensed under the MIT License.
 
 #include <IReactInstance.h>
+#include <Utils/TagIndex.h>
 #include <cxxreact/CxxModule.h>
 #include <folly/dynamic.h>
+#include "AnimatedEdgeQueue.h"
+#include "AnimatedGraphEvaluator.h"
 #include "AnimatedNode.h"
+#include "AnimatedNodeType.h"
+#include "AnimationCurveCache.h"
 #include "AnimationDriver.h"
 #include "EventAnimationDriver.h"
 #include "PropsAnimatedNode.h"
@@ -39,6 +44,14 @@ class AnimationDriver;
 class EventAnimationDriver;
 class NativeAnimatedNodeManager {
  public:
+  // Operations queued between StartOperationBatch and FinishOperationBatch are applied together when the batch
+  // finishes. Operations queued outside of a batch are applied right away. FinishOperationBatch applies all
+  // operations and then rethrows the first error.
+  void StartOperationBatch() noexcept;
+  void FinishOperationBatch();
+  void QueueOperation(std::function<void()> &&operation);
+  void QueueEdgeOperation(int64_t parentNodeTag, int64_t childNodeTag, bool connect);
+
   void CreateAnimatedNode(
       int64_t tag,
       const folly::dynamic &config,
@@ -89,18 +102,48 @@ class NativeAnimatedNodeManager {
   TransformAnimatedNode *GetTransformAnimatedNode(int64_t tag);
   TrackingAnimatedNode *GetTrackingAnimatedNode(int64_t tag);
   void RemoveActiveAnimation(int64_t tag);
+  AnimationCurveCache &GetCurveCache() noexcept;
+  AnimatedGraphEvaluator &GetGraphEvaluator() noexcept;
 
  private:
-  std::unordered_map<int64_t, std::unique_ptr<ValueAnimatedNode>> m_valueNodes{};
-  std::unordered_map<int64_t, std::unique_ptr<PropsAnimatedNode>> m_propsNodes{};
-  std::unordered_map<int64_t, std::unique_ptr<StyleAnimatedNode>> m_styleNodes{};
-  std::unordered_map<int64_t, std::unique_ptr<TransformAnimatedNode>> m_transformNodes{};
-  std::unordered_map<int64_t, std::unique_ptr<TrackingAnimatedNode>> m_trackingNodes{};
+  struct AnimatedNodeSlot {
+    std::unique_ptr<AnimatedNode> Node;
+    AnimatedNodeType Type{AnimatedNodeType::Value};
+  };
+
+  // An operation queued in a batch. Edge operations have no Apply function.
+  struct QueuedOperation {
+    std::function<void()> Apply;
+    AnimatedEdgeQueue::Edge Edge;
+  };
+
+  static bool IsValueNodeType(AnimatedNodeType type) noexcept;
+  const AnimatedNodeSlot *FindNodeSlot(int64_t tag) const noexcept;
+  void AddNode(int64_t tag, AnimatedNodeType type, std::unique_ptr<AnimatedNode> &&node);
+  void AddGraphEvaluatorNode(int64_t tag, AnimatedNodeType type, const folly::dynamic &config);
+  template <typename TOperation>
+  static void ApplyOperation(const TOperation &operation, std::exception_ptr &firstError) noexcept;
+  void StageEdge(const AnimatedEdgeQueue::Edge &edge);
+  void ApplyEdge(const AnimatedEdgeQueue::Edge &edge);
+  void ApplyPendingEdges(std::exception_ptr &firstError) noexcept;
+
+  // All nodes are stored in a flat arena and found by tag with a single index lookup.
+  // The slots of dropped nodes are reused.
+  std::vector<AnimatedNodeSlot> m_nodeSlots{};
+  std::vector<uint32_t> m_freeNodeSlots{};
+  TagIndex m_nodeSlotIndexes{};
+
+  std::vector<QueuedOperation> m_queuedOperations{};
+  bool m_inOperationBatch{false};
+  AnimatedEdgeQueue m_pendingEdges{};
+
   std::unordered_map<std::tuple<int64_t, std::string>, std::vector<std::unique_ptr<EventAnimationDriver>>>
       m_eventDrivers{};
   std::unordered_map<int64_t, std::unique_ptr<AnimationDriver>> m_activeAnimations{};
   std::vector<std::tuple<int64_t, int64_t>> m_trackingAndLeadNodeTags{};
   std::vector<int64_t> m_delayedPropsNodes{};
+  AnimationCurveCache m_curveCache{};
+  AnimatedGraphEvaluator m_graphEvaluator{};
 
   static constexpr std::string_view s_toValueIdName{"toValue"};
   static constexpr std::string_view s_framesName{"frames"};
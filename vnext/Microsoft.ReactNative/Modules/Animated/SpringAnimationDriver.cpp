@@ -70,6 +70,26 @@ std::tuple<float, double> SpringAnimationDriver::GetValueAndVelocityForTime(doub
   }
 }
 
+std::shared_ptr<const AnimationCurve> SpringAnimationDriver::GetKeyFrameOffsets() {
+  // The curve of dynamic to values depends on the start value.
+  if (m_dynamicToValues.empty()) {
+    if (auto const manager = m_manager.lock()) {
+      SpringCurveConfig config;
+      config.Stiffness = m_springStiffness;
+      config.Damping = m_springDamping;
+      config.Mass = m_springMass;
+      config.InitialVelocity = m_initialVelocity;
+      config.Distance = m_endValue - m_startValue;
+      config.RestSpeedThreshold = m_restSpeedThreshold;
+      config.RestDisplacementThreshold = m_displacementFromRestThreshold;
+      config.OvershootClamping = m_overshootClampingEnabled;
+      return manager->GetCurveCache().GetSpringCurve(config);
+    }
+  }
+
+  return CalculatedAnimationDriver::GetKeyFrameOffsets();
+}
+
 bool SpringAnimationDriver::IsAtRest(double currentVelocity, double currentValue, double endValue) {
   return std::abs(currentVelocity) <= m_restSpeedThreshold &&
       (std::abs(currentValue - endValue) <= m_displacementFromRestThreshold || m_springStiffness == 0);
@@ -23,6 +23,7 @@ class SpringAnimationDriver : public CalculatedAnimationDriver {
  protected:
   std::tuple<float, double> GetValueAndVelocityForTime(double time) override;
   bool IsAnimationDone(double currentValue, double currentVelocity) override;
+  std::shared_ptr<const AnimationCurve> GetKeyFrameOffsets() override;
 
  private:
   bool IsAtRest(double currentVelocity, double currentPosition, double endValue);
@@ -39,6 +39,9 @@ double ValueAnimatedNode::RawValue() {
 void ValueAnimatedNode::RawValue(double value) {
   if (RawValue() != value) {
     m_propertySet.InsertScalar(s_valueName, static_cast<float>(value));
+    if (const auto manager = m_manager.lock()) {
+      manager->GetGraphEvaluator().SetRawValue(m_tag, value);
+    }
     UpdateTrackingNodes();
   }
 }
@@ -52,6 +55,9 @@ double ValueAnimatedNode::Offset() {
 void ValueAnimatedNode::Offset(double offset) {
   if (Offset() != offset) {
     m_propertySet.InsertScalar(s_offsetName, static_cast<float>(offset));
+    if (const auto manager = m_manager.lock()) {
+      manager->GetGraphEvaluator().SetOffset(m_tag, offset);
+    }
     UpdateTrackingNodes();
   }
 }
@@ -4,6 +4,7 @@
 #include "pch.h"
 #include "DevSettingsModule.h"
 #include "IReactContext.h"
+#include "ReactHost/ReactInstanceWin.h"
 #include "ReactNativeHost.h"
 
 namespace Microsoft::ReactNative {
@@ -37,7 +38,13 @@ void DevSettings::setIsDebuggingRemotely(bool isDebuggingRemotelyEnabled) noexce
 }
 
 void DevSettings::setProfilingEnabled(bool isProfilingEnabled) noexcept {
-  assert(false);
+  if (auto profiler = m_context.Properties().Get(Mso::React::ReactInstanceWin::SamplingProfilerProperty())) {
+    if (isProfilingEnabled) {
+      (*profiler)->Start();
+    } else {
+      (*profiler)->Stop();
+    }
+  }
 }
 
 void DevSettings::toggleElementInspector() noexcept {
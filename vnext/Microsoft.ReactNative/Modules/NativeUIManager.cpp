@@ -7,13 +7,16 @@
 #include <UI.Xaml.Input.h>
 #include <UI.Xaml.Media.h>
 #include <Views/ShadowNodeBase.h>
+#include <dispatchQueue/dispatchQueue.h>
 #include "Modules/I18nManagerModule.h"
 #include "NativeUIManager.h"
 
 #include "CppWinRTIncludes.h"
 #include "IXamlRootView.h"
+#include "JSValueAtom.h"
 #include "QuirkSettings.h"
 #include "ReactRootViewTagGenerator.h"
+#include "RuntimeOptions.h"
 #include "Unicode.h"
 
 namespace winrt {
@@ -26,11 +29,6 @@ using namespace xaml::Media;
 
 namespace Microsoft::ReactNative {
 
-static YogaNodePtr make_yoga_node(YGConfigRef config) {
-  YogaNodePtr result(YGNodeNewWithConfig(config));
-  return result;
-}
-
 #if defined(_DEBUG)
 static int YogaLog(
     const YGConfigRef /*config*/,
@@ -60,11 +58,39 @@ static int YogaLog(
 }
 #endif
 
+static YogaStyleValue ToYogaStyleValue(const React::JSValue &value) noexcept {
+  switch (value.Type()) {
+    case React::JSValueType::Null:
+      return YogaStyleValue{};
+    case React::JSValueType::Double:
+    case React::JSValueType::Int64:
+      return YogaStyleValue{value.AsDouble()};
+    case React::JSValueType::String:
+      return YogaStyleValue{*value.TryGetString()};
+    case React::JSValueType::Boolean:
+      return YogaStyleValue{value.AsBoolean() ? "true" : "false", YogaStyleValue::Kind::Other};
+    default:
+      return YogaStyleValue{std::string_view{}, YogaStyleValue::Kind::Other};
+  }
+}
+
+// Applies the layout props to the Yoga node. The values are passed to YogaLayoutCore without copying them.
+static void StyleYogaNode(
+    YGNodeRef yogaNode,
+    const React::JSValueObject &props,
+    bool implementsPadding,
+    const YogaStyleErrorHandler &onError) {
+  for (const auto &pair : props) {
+    StyleYogaNode(yogaNode, YogaStyleProp{pair.first, ToYogaStyleValue(pair.second)}, implementsPadding, onError);
+  }
+}
+
+//===========================================================================
+// NativeUIManager implementation
+//===========================================================================
+
 YGNodeRef NativeUIManager::GetYogaNode(int64_t tag) const {
-  auto iter = m_tagsToYogaNodes.find(tag);
-  if (iter == m_tagsToYogaNodes.end())
-    return nullptr;
-  return iter->second.get();
+  return m_layoutCore.FindNode(tag);
 }
 
 void NativeUIManager::DirtyYogaNode(int64_t tag) {
@@ -73,11 +99,10 @@ void NativeUIManager::DirtyYogaNode(int64_t tag) {
     auto *pViewManager = pShadowNodeChild->GetViewManager();
     YGMeasureFunc func = pViewManager->GetYogaCustomMeasureFunc();
     if (func != nullptr) {
-      // If there is a yoga node for this tag mark it as dirty
+      // If there is a yoga node for this tag mark it as dirty. Its content changed, so it must be measured again.
       YGNodeRef yogaNodeChild = GetYogaNode(tag);
       if (yogaNodeChild != nullptr) {
-        // Retrieve and dirty the yoga node
-        YGNodeMarkDirty(yogaNodeChild);
+        m_layoutCore.MarkContentDirty(tag);
 
         // Once we mark a node dirty we can stop because the yoga code will mark
         // all parents anyway
@@ -131,15 +156,19 @@ XamlView NativeUIManager::reactPeerOrContainerFrom(xaml::FrameworkElement fe) {
 
 NativeUIManager::NativeUIManager(winrt::Microsoft::ReactNative::ReactContext const &reactContext)
     : m_context(reactContext) {
-  m_yogaConfig = YGConfigNew();
+  YGConfigRef yogaConfig = m_layoutCore.Config();
   if (React::implementation::QuirkSettings::GetMatchAndroidAndIOSStretchBehavior(m_context.Properties()))
-    YGConfigSetUseLegacyStretchBehaviour(m_yogaConfig, true);
+    YGConfigSetUseLegacyStretchBehaviour(yogaConfig, true);
+
+  if (auto capacity = ::Microsoft::React::TryGetRuntimeOptionInt("YogaLayoutCore.NodePoolCapacity")) {
+    m_layoutCore.SetNodePoolCapacity(static_cast<size_t>(*capacity > 0 ? *capacity : 0));
+  }
 
 #if defined(_DEBUG)
-  YGConfigSetLogger(m_yogaConfig, &YogaLog);
+  YGConfigSetLogger(yogaConfig, &YogaLog);
 
   // To Debug Yoga layout, uncomment the following line.
-  // YGConfigSetPrintTreeFlag(m_yogaConfig, true);
+  // YGConfigSetPrintTreeFlag(yogaConfig, true);
 
   // Additional logging can be enabled editing yoga.cpp (e.g. gPrintChanges,
   // gPrintSkips)
@@ -225,7 +254,7 @@ void NativeUIManager::AddRootView(ShadowNode &shadowNode, facebook::react::IReac
   view.as<xaml::FrameworkElement>().FlowDirection(
       I18nManager::IsRTL(m_context.Properties()) ? xaml::FlowDirection::RightToLeft : xaml::FlowDirection::LeftToRight);
 
-  m_tagsToYogaNodes.emplace(shadowNode.m_tag, make_yoga_node(m_yogaConfig));
+  m_layoutCore.CreateNode(shadowNode.m_tag);
 
   auto element = view.as<xaml::FrameworkElement>();
   element.Tag(winrt::PropertyValue::CreateInt64(shadowNode.m_tag));
@@ -258,505 +287,6 @@ void NativeUIManager::ensureInBatch() {
     m_inBatch = true;
 }
 
-static float NumberOrDefault(const winrt::Microsoft::ReactNative::JSValue &value, float defaultValue) {
-  float result = defaultValue;
-
-  if (value.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-      value.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64)
-    result = value.AsSingle();
-  else if (value.IsNull())
-    result = defaultValue;
-  else if (value.Type() == winrt::Microsoft::ReactNative::JSValueType::String)
-    result = std::stof(value.AsString());
-  else
-    assert(false);
-
-  return result;
-}
-
-static YGValue YGValueOrDefault(
-    const winrt::Microsoft::ReactNative::JSValue &value,
-    YGValue defaultValue,
-    ShadowNodeBase &shadowNode,
-    const std::string &key) {
-  YGValue result = defaultValue;
-
-  if (value.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-      value.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64)
-    return YGValue{value.AsSingle(), YGUnitPoint};
-
-  if (value.IsNull())
-    return defaultValue;
-
-  if (value.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-    std::string str = value.AsString();
-    if (str == "auto")
-      return YGValue{YGUndefined, YGUnitAuto};
-    if (str.length() > 0 && str.back() == '%') {
-      str.pop_back();
-      folly::dynamic pct(str);
-      return YGValue{static_cast<float>(pct.asDouble()), YGUnitPercent};
-    }
-    if (str.length() > 2 && (str.compare(str.length() - 2, 2, "pt") || str.compare(str.length() - 2, 2, "px"))) {
-      shadowNode.RedBox(
-          "Value '" + value.AsString() + "' for " + key + " is invalid. Cannot be converted to YGValue. '" +
-          str.substr((str.length() - 2), 2) + "' unit not needed. Simply use integer value.");
-      return defaultValue;
-    }
-  }
-
-  shadowNode.RedBox(
-      "Value '" + value.AsString() + "' for " + key +
-      " is invalid. Cannot be converted to YGValue. Did you forget the %? Otherwise, simply use integer value.");
-  return defaultValue;
-}
-
-typedef void (*YogaSetterFunc)(const YGNodeRef yogaNode, const YGEdge edge, const float value);
-static void SetYogaValueHelper(
-    const YGNodeRef yogaNode,
-    const YGEdge edge,
-    const YGValue &value,
-    YogaSetterFunc normalSetter,
-    YogaSetterFunc percentSetter) {
-  switch (value.unit) {
-    case YGUnitAuto:
-    case YGUnitUndefined:
-      normalSetter(yogaNode, edge, YGUndefined);
-      break;
-    case YGUnitPoint:
-      normalSetter(yogaNode, edge, value.value);
-      break;
-    case YGUnitPercent:
-      percentSetter(yogaNode, edge, value.value);
-      break;
-  }
-}
-
-typedef void (*YogaUnitSetterFunc)(const YGNodeRef yogaNode, const float value);
-static void SetYogaUnitValueHelper(
-    const YGNodeRef yogaNode,
-    const YGValue &value,
-    YogaUnitSetterFunc normalSetter,
-    YogaUnitSetterFunc percentSetter) {
-  switch (value.unit) {
-    case YGUnitAuto:
-    case YGUnitUndefined:
-      normalSetter(yogaNode, YGUndefined);
-      break;
-    case YGUnitPoint:
-      normalSetter(yogaNode, value.value);
-      break;
-    case YGUnitPercent:
-      percentSetter(yogaNode, value.value);
-      break;
-  }
-}
-
-typedef void (*YogaAutoUnitSetterFunc)(const YGNodeRef yogaNode);
-static void SetYogaUnitValueAutoHelper(
-    const YGNodeRef yogaNode,
-    const YGValue &value,
-    YogaUnitSetterFunc normalSetter,
-    YogaUnitSetterFunc percentSetter,
-    YogaAutoUnitSetterFunc autoSetter) {
-  switch (value.unit) {
-    case YGUnitAuto:
-      autoSetter(yogaNode);
-      break;
-    case YGUnitUndefined:
-      normalSetter(yogaNode, YGUndefined);
-      break;
-    case YGUnitPoint:
-      normalSetter(yogaNode, value.value);
-      break;
-    case YGUnitPercent:
-      percentSetter(yogaNode, value.value);
-      break;
-  }
-}
-
-typedef void (*YogaAutoSetterFunc)(const YGNodeRef yogaNode, const YGEdge edge);
-static void SetYogaValueAutoHelper(
-    const YGNodeRef yogaNode,
-    const YGEdge edge,
-    const YGValue &value,
-    YogaSetterFunc normalSetter,
-    YogaSetterFunc percentSetter,
-    YogaAutoSetterFunc autoSetter) {
-  switch (value.unit) {
-    case YGUnitAuto:
-      autoSetter(yogaNode, edge);
-      break;
-    case YGUnitUndefined:
-      normalSetter(yogaNode, edge, YGUndefined);
-      break;
-    case YGUnitPoint:
-      normalSetter(yogaNode, edge, value.value);
-      break;
-    case YGUnitPercent:
-      percentSetter(yogaNode, edge, value.value);
-      break;
-  }
-}
-
-static void StyleYogaNode(
-    ShadowNodeBase &shadowNode,
-    const YGNodeRef yogaNode,
-    const winrt::Microsoft::ReactNative::JSValueObject &props) {
-  for (const auto &pair : props) {
-    const std::string &key = pair.first;
-    const auto &value = pair.second;
-
-    if (key == "flexDirection") {
-      YGFlexDirection direction = YGFlexDirectionColumn;
-
-      if (value == "column" || value.IsNull())
-        direction = YGFlexDirectionColumn;
-      else if (value == "row")
-        direction = YGFlexDirectionRow;
-      else if (value == "column-reverse")
-        direction = YGFlexDirectionColumnReverse;
-      else if (value == "row-reverse")
-        direction = YGFlexDirectionRowReverse;
-      else
-        assert(false);
-
-      YGNodeStyleSetFlexDirection(yogaNode, direction);
-    } else if (key == "justifyContent") {
-      YGJustify justify = YGJustifyFlexStart;
-
-      if (value == "flex-start" || value.IsNull())
-        justify = YGJustifyFlexStart;
-      else if (value == "flex-end")
-        justify = YGJustifyFlexEnd;
-      else if (value == "center")
-        justify = YGJustifyCenter;
-      else if (value == "space-between")
-        justify = YGJustifySpaceBetween;
-      else if (value == "space-around")
-        justify = YGJustifySpaceAround;
-      else if (value == "space-evenly")
-        justify = YGJustifySpaceEvenly;
-      else
-        assert(false);
-
-      YGNodeStyleSetJustifyContent(yogaNode, justify);
-    } else if (key == "flexWrap") {
-      YGWrap wrap = YGWrapNoWrap;
-
-      if (value == "nowrap" || value.IsNull())
-        wrap = YGWrapNoWrap;
-      else if (value == "wrap")
-        wrap = YGWrapWrap;
-      else
-        assert(false);
-
-      YGNodeStyleSetFlexWrap(yogaNode, wrap);
-    } else if (key == "alignItems") {
-      YGAlign align = YGAlignStretch;
-
-      if (value == "stretch" || value.IsNull())
-        align = YGAlignStretch;
-      else if (value == "flex-start")
-        align = YGAlignFlexStart;
-      else if (value == "flex-end")
-        align = YGAlignFlexEnd;
-      else if (value == "center")
-        align = YGAlignCenter;
-      else if (value == "baseline")
-        align = YGAlignBaseline;
-      else
-        assert(false);
-
-      YGNodeStyleSetAlignItems(yogaNode, align);
-    } else if (key == "alignSelf") {
-      YGAlign align = YGAlignAuto;
-
-      if (value == "auto" || value.IsNull())
-        align = YGAlignAuto;
-      else if (value == "stretch")
-        align = YGAlignStretch;
-      else if (value == "flex-start")
-        align = YGAlignFlexStart;
-      else if (value == "flex-end")
-        align = YGAlignFlexEnd;
-      else if (value == "center")
-        align = YGAlignCenter;
-      else if (value == "baseline")
-        align = YGAlignBaseline;
-      else
-        assert(false);
-
-      YGNodeStyleSetAlignSelf(yogaNode, align);
-    } else if (key == "alignContent") {
-      YGAlign align = YGAlignFlexStart;
-
-      if (value == "stretch")
-        align = YGAlignStretch;
-      else if (value == "flex-start" || value.IsNull())
-        align = YGAlignFlexStart;
-      else if (value == "flex-end")
-        align = YGAlignFlexEnd;
-      else if (value == "center")
-        align = YGAlignCenter;
-      else if (value == "space-between")
-        align = YGAlignSpaceBetween;
-      else if (value == "space-around")
-        align = YGAlignSpaceAround;
-      else
-        assert(false);
-
-      YGNodeStyleSetAlignContent(yogaNode, align);
-    } else if (key == "flex") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetFlex(yogaNode, result);
-    } else if (key == "flexGrow") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetFlexGrow(yogaNode, result);
-    } else if (key == "flexShrink") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetFlexShrink(yogaNode, result);
-    } else if (key == "flexBasis") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueAutoHelper(
-          yogaNode, result, YGNodeStyleSetFlexBasis, YGNodeStyleSetFlexBasisPercent, YGNodeStyleSetFlexBasisAuto);
-    } else if (key == "position") {
-      YGPositionType position = YGPositionTypeRelative;
-
-      if (value == "relative" || value.IsNull())
-        position = YGPositionTypeRelative;
-      else if (value == "absolute")
-        position = YGPositionTypeAbsolute;
-      else if (value == "static")
-        position = YGPositionTypeStatic;
-      else
-        assert(false);
-
-      YGNodeStyleSetPositionType(yogaNode, position);
-    } else if (key == "overflow") {
-      YGOverflow overflow = YGOverflowVisible;
-      if (value == "visible" || value.IsNull())
-        overflow = YGOverflowVisible;
-      else if (value == "hidden")
-        overflow = YGOverflowHidden;
-      else if (value == "scroll")
-        overflow = YGOverflowScroll;
-
-      YGNodeStyleSetOverflow(yogaNode, overflow);
-    } else if (key == "display") {
-      YGDisplay display = YGDisplayFlex;
-      if (value == "flex" || value.IsNull())
-        display = YGDisplayFlex;
-      else if (value == "none")
-        display = YGDisplayNone;
-
-      YGNodeStyleSetDisplay(yogaNode, display);
-    } else if (key == "direction") {
-      // https://github.com/microsoft/react-native-windows/issues/4668
-      // In order to support the direction property, we tell yoga to always layout
-      // in LTR direction, then push the appropriate FlowDirection into XAML.
-      // This way XAML handles flipping in RTL mode, which works both for RN components
-      // as well as native components that have purely XAML sub-trees (eg ComboBox).
-      YGDirection direction = YGDirectionLTR;
-
-      YGNodeStyleSetDirection(yogaNode, direction);
-    } else if (key == "aspectRatio") {
-      float result = NumberOrDefault(value, 1.0f /*default*/);
-
-      YGNodeStyleSetAspectRatio(yogaNode, result);
-    } else if (key == "left") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeLeft, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "top") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeTop, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "right") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeRight, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "bottom") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeBottom, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "end") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeEnd, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "start") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeStart, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "width") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueAutoHelper(
-          yogaNode, result, YGNodeStyleSetWidth, YGNodeStyleSetWidthPercent, YGNodeStyleSetWidthAuto);
-    } else if (key == "minWidth") {
-      YGValue result = YGValueOrDefault(value, YGValue{0.0f, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMinWidth, YGNodeStyleSetMinWidthPercent);
-    } else if (key == "maxWidth") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMaxWidth, YGNodeStyleSetMaxWidthPercent);
-    } else if (key == "height") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueAutoHelper(
-          yogaNode, result, YGNodeStyleSetHeight, YGNodeStyleSetHeightPercent, YGNodeStyleSetHeightAuto);
-    } else if (key == "minHeight") {
-      YGValue result = YGValueOrDefault(value, YGValue{0.0f, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMinHeight, YGNodeStyleSetMinHeightPercent);
-    } else if (key == "maxHeight") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMaxHeight, YGNodeStyleSetMaxHeightPercent);
-    } else if (key == "margin") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeAll, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginLeft") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeLeft, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginStart") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeStart, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginTop") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeTop, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginRight") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeRight, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginEnd") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeEnd, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginBottom") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeBottom, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginHorizontal") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode,
-          YGEdgeHorizontal,
-          result,
-          YGNodeStyleSetMargin,
-          YGNodeStyleSetMarginPercent,
-          YGNodeStyleSetMarginAuto);
-    } else if (key == "marginVertical") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode,
-          YGEdgeVertical,
-          result,
-          YGNodeStyleSetMargin,
-          YGNodeStyleSetMarginPercent,
-          YGNodeStyleSetMarginAuto);
-    } else if (key == "padding") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-        SetYogaValueHelper(yogaNode, YGEdgeAll, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingLeft") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-        SetYogaValueHelper(yogaNode, YGEdgeLeft, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingStart") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-        SetYogaValueHelper(yogaNode, YGEdgeStart, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingTop") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-        SetYogaValueHelper(yogaNode, YGEdgeTop, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingRight") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeRight, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-    } else if (key == "paddingEnd") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-        SetYogaValueHelper(yogaNode, YGEdgeEnd, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingBottom") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-        SetYogaValueHelper(yogaNode, YGEdgeBottom, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingHorizontal") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-        SetYogaValueHelper(yogaNode, YGEdgeHorizontal, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingVertical") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-        SetYogaValueHelper(yogaNode, YGEdgeVertical, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "borderWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetBorder(yogaNode, YGEdgeAll, result);
-    } else if (key == "borderLeftWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetBorder(yogaNode, YGEdgeLeft, result);
-    } else if (key == "borderStartWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetBorder(yogaNode, YGEdgeStart, result);
-    } else if (key == "borderTopWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetBorder(yogaNode, YGEdgeTop, result);
-    } else if (key == "borderRightWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetBorder(yogaNode, YGEdgeRight, result);
-    } else if (key == "borderEndWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetBorder(yogaNode, YGEdgeEnd, result);
-    } else if (key == "borderBottomWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetBorder(yogaNode, YGEdgeBottom, result);
-    }
-  }
-}
-
 void NativeUIManager::CreateView(ShadowNode &shadowNode, React::JSValueObject &props) {
   ShadowNodeBase &node = static_cast<ShadowNodeBase &>(shadowNode);
   auto *pViewManager = node.GetViewManager();
@@ -767,19 +297,17 @@ void NativeUIManager::CreateView(ShadowNode &shadowNode, React::JSValueObject &p
       m_extraLayoutNodes.push_back(node.m_tag);
     }
 
-    auto result = m_tagsToYogaNodes.emplace(node.m_tag, make_yoga_node(m_yogaConfig));
-    if (result.second == true) {
-      YGNodeRef yogaNode = result.first->second.get();
-      StyleYogaNode(node, yogaNode, props);
+    if (YGNodeRef yogaNode = m_layoutCore.CreateNode(node.m_tag)) {
+      StyleYogaNode(
+          yogaNode,
+          props,
+          node.ImplementsPadding(),
+          [&node](const std::string &message) { node.RedBox(message); });
 
       YGMeasureFunc func = pViewManager->GetYogaCustomMeasureFunc();
       if (func != nullptr) {
-        YGNodeSetMeasureFunc(yogaNode, func);
-
-        auto context = std::make_unique<Microsoft::ReactNative::YogaContext>(node.GetView());
-        YGNodeSetContext(yogaNode, reinterpret_cast<void *>(context.get()));
-
-        m_tagsToYogaContext.emplace(node.m_tag, std::move(context));
+        m_layoutCore.SetMeasureFunc(
+            node.m_tag, func, std::make_shared<YogaContext>(node.GetView()), pViewManager->CanCacheMeasurements());
       }
     }
   }
@@ -790,17 +318,8 @@ void NativeUIManager::AddView(ShadowNode &parentShadowNode, ShadowNode &childSha
   auto *pViewManager = parentNode.GetViewManager();
 
   if (pViewManager->RequiresYogaNode() && !pViewManager->IsNativeControlWithSelfLayout()) {
-    YGNodeRef yogaNodeToManage = GetYogaNode(parentNode.m_tag);
-    ShadowNodeBase &childNode = static_cast<ShadowNodeBase &>(childShadowNode);
-    YGNodeRef yogaNodeToAdd = GetYogaNode(childNode.m_tag);
-
-    int64_t oldParentTag = childNode.GetParent();
-    YGNodeRef yogaOldParent = GetYogaNode(oldParentTag);
-    if (yogaOldParent != nullptr) {
-      YGNodeRemoveChild(yogaOldParent, yogaNodeToAdd);
-    }
-
-    YGNodeInsertChild(yogaNodeToManage, yogaNodeToAdd, static_cast<uint32_t>(index));
+    // The child is removed from its previous Yoga parent first.
+    m_layoutCore.InsertChild(parentNode.m_tag, childShadowNode.m_tag, static_cast<uint32_t>(index));
   }
 }
 
@@ -810,18 +329,12 @@ void NativeUIManager::RemoveView(ShadowNode &shadowNode, bool removeChildren /*=
   if (removeChildren) {
     auto *pViewManager = node.GetViewManager();
 
-    YGNodeRef yogaNode = pViewManager->RequiresYogaNode() ? GetYogaNode(node.m_tag) : nullptr;
-    if (yogaNode != nullptr && !pViewManager->IsNativeControlWithSelfLayout()) {
-      uint32_t childCount = YGNodeGetChildCount(yogaNode);
-      for (uint32_t i = childCount; i > 0; --i) {
-        YGNodeRef yogaNodeToRemove = YGNodeGetChild(yogaNode, i - 1);
-        YGNodeRemoveChild(yogaNode, yogaNodeToRemove);
-      }
+    if (pViewManager->RequiresYogaNode() && !pViewManager->IsNativeControlWithSelfLayout()) {
+      m_layoutCore.RemoveChildren(node.m_tag);
     }
   }
 
-  m_tagsToYogaNodes.erase(node.m_tag);
-  m_tagsToYogaContext.erase(node.m_tag);
+  m_layoutCore.RemoveNode(node.m_tag);
 }
 
 void NativeUIManager::ReplaceView(ShadowNode &shadowNode) {
@@ -829,17 +342,11 @@ void NativeUIManager::ReplaceView(ShadowNode &shadowNode) {
   auto *pViewManager = node.GetViewManager();
 
   if (pViewManager->RequiresYogaNode()) {
-    auto it = m_tagsToYogaNodes.find(node.m_tag);
-    if (it != m_tagsToYogaNodes.end()) {
-      YGNodeRef yogaNode = it->second.get();
-
+    if (GetYogaNode(node.m_tag)) {
       YGMeasureFunc func = pViewManager->GetYogaCustomMeasureFunc();
       if (func != nullptr) {
-        auto context = std::make_unique<YogaContext>(node.GetView());
-        YGNodeSetContext(yogaNode, reinterpret_cast<void *>(context.get()));
-
-        m_tagsToYogaContext.erase(node.m_tag);
-        m_tagsToYogaContext.emplace(node.m_tag, std::move(context));
+        m_layoutCore.SetMeasureFunc(
+            node.m_tag, func, std::make_shared<YogaContext>(node.GetView()), pViewManager->CanCacheMeasurements());
       }
     } else {
       assert(false);
@@ -854,7 +361,11 @@ void NativeUIManager::UpdateView(ShadowNode &shadowNode, winrt::Microsoft::React
 
   if (pViewManager->RequiresYogaNode()) {
     YGNodeRef yogaNode = GetYogaNode(node.m_tag);
-    StyleYogaNode(node, yogaNode, props);
+    StyleYogaNode(
+        yogaNode,
+        props,
+        node.ImplementsPadding(),
+        [&node](const std::string &message) { node.RedBox(message); });
   }
 }
 
@@ -889,39 +400,35 @@ void NativeUIManager::DoLayout() {
   // Values need to be cleared from the vector before next call to DoLayout.
   m_extraLayoutNodes.clear();
   auto &rootTags = m_host->GetAllRootTags();
+  std::vector<YogaLayoutRoot> layoutRoots;
+  layoutRoots.reserve(rootTags.size());
   for (int64_t rootTag : rootTags) {
     UpdateExtraLayout(rootTag);
 
     ShadowNodeBase &rootShadowNode = static_cast<ShadowNodeBase &>(m_host->GetShadowNodeForTag(rootTag));
-    YGNodeRef rootNode = GetYogaNode(rootTag);
     auto rootElement = rootShadowNode.GetView().as<xaml::FrameworkElement>();
 
     float actualWidth = static_cast<float>(rootElement.ActualWidth());
     float actualHeight = static_cast<float>(rootElement.ActualHeight());
-
-    // We must always run layout in LTR mode, which might seem unintuitive.
-    // We will flip the root of the tree into RTL by forcing the root XAML node's FlowDirection to RightToLeft
-    // which will inherit down the XAML tree, allowing all native controls to pick it up.
-    YGNodeCalculateLayout(rootNode, actualWidth, actualHeight, YGDirectionLTR);
+    layoutRoots.push_back(YogaLayoutRoot{rootTag, actualWidth, actualHeight});
   }
 
-  for (auto &tagToYogaNode : m_tagsToYogaNodes) {
-    int64_t tag = tagToYogaNode.first;
-    YGNodeRef yogaNode = tagToYogaNode.second.get();
-
-    if (!YGNodeGetHasNewLayout(yogaNode))
-      continue;
-    YGNodeSetHasNewLayout(yogaNode, false);
-
-    float left = YGNodeLayoutGetLeft(yogaNode);
-    float top = YGNodeLayoutGetTop(yogaNode);
-    float width = YGNodeLayoutGetWidth(yogaNode);
-    float height = YGNodeLayoutGetHeight(yogaNode);
+  // We must always run layout in LTR mode, which might seem unintuitive.
+  // We will flip the root of the tree into RTL by forcing the root XAML node's FlowDirection to RightToLeft
+  // which will inherit down the XAML tree, allowing all native controls to pick it up.
+  // The root views are laid out concurrently on this thread and the thread pool. The XAML views are still
+  // measured on this thread.
+  m_layoutCore.CalculateLayouts(layoutRoots, [](std::function<void()> &&task) {
+    Mso::DispatchQueue::ConcurrentQueue().Post([task = std::move(task)]() noexcept { task(); });
+  });
 
-    ShadowNodeBase &shadowNode = static_cast<ShadowNodeBase &>(m_host->GetShadowNodeForTag(tag));
-    auto view = shadowNode.GetView();
-    auto pViewManager = shadowNode.GetViewManager();
-    pViewManager->SetLayoutProps(shadowNode, view, left, top, width, height);
+  YogaLayoutHandler onLayout = [this](int64_t tag, float left, float top, float width, float height) {
+    if (auto shadowNode = static_cast<ShadowNodeBase *>(m_host->FindShadowNodeForTag(tag))) {
+      shadowNode->GetViewManager()->SetLayoutProps(*shadowNode, shadowNode->GetView(), left, top, width, height);
+    }
+  };
+  for (int64_t rootTag : rootTags) {
+    m_layoutCore.ApplyLayout(rootTag, onLayout);
   }
 }
 
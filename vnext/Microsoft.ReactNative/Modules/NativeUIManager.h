@@ -16,6 +16,7 @@
 #include <map>
 #include <memory>
 #include <vector>
+#include "YogaLayoutCore.h"
 
 namespace Microsoft::ReactNative {
 struct IXamlReactControl;
@@ -23,14 +24,6 @@ struct IXamlReactControl;
 
 namespace Microsoft::ReactNative {
 
-struct YogaNodeDeleter {
-  void operator()(YGNodeRef node) {
-    YGNodeFree(node);
-  }
-};
-
-typedef std::unique_ptr<YGNode, YogaNodeDeleter> YogaNodePtr;
-
 class NativeUIManager final : public INativeUIManager {
  public:
   NativeUIManager(winrt::Microsoft::ReactNative::ReactContext const &reactContext);
@@ -104,11 +97,9 @@ class NativeUIManager final : public INativeUIManager {
  private:
   INativeUIManagerHost *m_host = nullptr;
   winrt::Microsoft::ReactNative::ReactContext m_context;
-  YGConfigRef m_yogaConfig;
   bool m_inBatch = false;
 
-  std::map<int64_t, YogaNodePtr> m_tagsToYogaNodes;
-  std::map<int64_t, std::unique_ptr<YogaContext>> m_tagsToYogaContext;
+  YogaLayoutCore m_layoutCore;
   std::vector<xaml::FrameworkElement::SizeChanged_revoker> m_sizeChangedVector;
   std::vector<std::function<void()>> m_batchCompletedCallbacks;
   std::vector<int64_t> m_extraLayoutNodes;
@@ -0,0 +1,1005 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "YogaLayoutCore.h"
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <iterator>
+#include <mutex>
+#include <thread>
+
+namespace Microsoft::ReactNative {
+
+//===========================================================================
+// Yoga style props
+//===========================================================================
+
+static float NumberOrDefault(const YogaStyleValue &value, float defaultValue) {
+  float result = defaultValue;
+
+  if (value.Type == YogaStyleValue::Kind::Number)
+    result = static_cast<float>(value.Number);
+  else if (value.Type == YogaStyleValue::Kind::Null)
+    result = defaultValue;
+  else if (value.Type == YogaStyleValue::Kind::String)
+    result = std::stof(std::string{value.String});
+  else
+    assert(false);
+
+  return result;
+}
+
+static YGValue YGValueOrDefault(
+    const YogaStyleValue &value,
+    YGValue defaultValue,
+    std::string_view key,
+    const YogaStyleErrorHandler &onError) {
+  YGValue result = defaultValue;
+
+  if (value.Type == YogaStyleValue::Kind::Number)
+    return YGValue{static_cast<float>(value.Number), YGUnitPoint};
+
+  if (value.Type == YogaStyleValue::Kind::Null)
+    return defaultValue;
+
+  if (value.Type == YogaStyleValue::Kind::String) {
+    std::string str{value.String};
+    if (str == "auto")
+      return YGValue{YGUndefined, YGUnitAuto};
+    if (str.length() > 0 && str.back() == '%') {
+      str.pop_back();
+      return YGValue{std::stof(str), YGUnitPercent};
+    }
+    if (str.length() > 2 && (str.compare(str.length() - 2, 2, "pt") || str.compare(str.length() - 2, 2, "px"))) {
+      onError(
+          "Value '" + std::string{value.String} + "' for " + std::string{key} +
+          " is invalid. Cannot be converted to YGValue. '" + str.substr((str.length() - 2), 2) +
+          "' unit not needed. Simply use integer value.");
+      return defaultValue;
+    }
+  }
+
+  onError(
+      "Value '" + std::string{value.String} + "' for " + std::string{key} +
+      " is invalid. Cannot be converted to YGValue. Did you forget the %? Otherwise, simply use integer value.");
+  return defaultValue;
+}
+
+typedef void (*YogaSetterFunc)(const YGNodeRef yogaNode, const YGEdge edge, const float value);
+static void SetYogaValueHelper(
+    const YGNodeRef yogaNode,
+    const YGEdge edge,
+    const YGValue &value,
+    YogaSetterFunc normalSetter,
+    YogaSetterFunc percentSetter) {
+  switch (value.unit) {
+    case YGUnitAuto:
+    case YGUnitUndefined:
+      normalSetter(yogaNode, edge, YGUndefined);
+      break;
+    case YGUnitPoint:
+      normalSetter(yogaNode, edge, value.value);
+      break;
+    case YGUnitPercent:
+      percentSetter(yogaNode, edge, value.value);
+      break;
+  }
+}
+
+typedef void (*YogaUnitSetterFunc)(const YGNodeRef yogaNode, const float value);
+static void SetYogaUnitValueHelper(
+    const YGNodeRef yogaNode,
+    const YGValue &value,
+    YogaUnitSetterFunc normalSetter,
+    YogaUnitSetterFunc percentSetter) {
+  switch (value.unit) {
+    case YGUnitAuto:
+    case YGUnitUndefined:
+      normalSetter(yogaNode, YGUndefined);
+      break;
+    case YGUnitPoint:
+      normalSetter(yogaNode, value.value);
+      break;
+    case YGUnitPercent:
+      percentSetter(yogaNode, value.value);
+      break;
+  }
+}
+
+typedef void (*YogaAutoUnitSetterFunc)(const YGNodeRef yogaNode);
+static void SetYogaUnitValueAutoHelper(
+    const YGNodeRef yogaNode,
+    const YGValue &value,
+    YogaUnitSetterFunc normalSetter,
+    YogaUnitSetterFunc percentSetter,
+    YogaAutoUnitSetterFunc autoSetter) {
+  switch (value.unit) {
+    case YGUnitAuto:
+      autoSetter(yogaNode);
+      break;
+    case YGUnitUndefined:
+      normalSetter(yogaNode, YGUndefined);
+      break;
+    case YGUnitPoint:
+      normalSetter(yogaNode, value.value);
+      break;
+    case YGUnitPercent:
+      percentSetter(yogaNode, value.value);
+      break;
+  }
+}
+
+typedef void (*YogaAutoSetterFunc)(const YGNodeRef yogaNode, const YGEdge edge);
+static void SetYogaValueAutoHelper(
+    const YGNodeRef yogaNode,
+    const YGEdge edge,
+    const YGValue &value,
+    YogaSetterFunc normalSetter,
+    YogaSetterFunc percentSetter,
+    YogaAutoSetterFunc autoSetter) {
+  switch (value.unit) {
+    case YGUnitAuto:
+      autoSetter(yogaNode, edge);
+      break;
+    case YGUnitUndefined:
+      normalSetter(yogaNode, edge, YGUndefined);
+      break;
+    case YGUnitPoint:
+      normalSetter(yogaNode, edge, value.value);
+      break;
+    case YGUnitPercent:
+      percentSetter(yogaNode, edge, value.value);
+      break;
+  }
+}
+
+// Maps a fixed set of names to their indexes. The names must outlive the index.
+class YogaNameIndex {
+ public:
+  template <class TIterator>
+  YogaNameIndex(TIterator first, TIterator last) noexcept {
+    for (int index = 0; first != last; ++first, ++index) {
+      m_indexes.emplace(*first, index);
+    }
+  }
+
+  int Find(std::string_view name) const noexcept {
+    auto it = m_indexes.find(name);
+    return it != m_indexes.end() ? it->second : -1;
+  }
+
+ private:
+  std::unordered_map<std::string_view, int> m_indexes;
+};
+
+// Maps the string values of an enum style prop to Yoga constants.
+template <class TEnum>
+class YogaEnumValues {
+ public:
+  YogaEnumValues(
+      TEnum defaultValue,
+      std::initializer_list<std::pair<std::string_view, TEnum>> values,
+      bool isClosedSet = true) noexcept
+      : m_defaultValue{defaultValue}, m_isClosedSet{isClosedSet}, m_names{MakeNames(values)} {
+    for (const auto &value : values) {
+      m_values.push_back(value.second);
+    }
+  }
+
+  // Null resets the prop to its default value.
+  TEnum Find(const YogaStyleValue &value) const noexcept {
+    if (value.Type == YogaStyleValue::Kind::String) {
+      int index = m_names.Find(value.String);
+      if (index >= 0) {
+        return m_values[index];
+      }
+    }
+
+    assert(value.Type == YogaStyleValue::Kind::Null || !m_isClosedSet);
+    return m_defaultValue;
+  }
+
+ private:
+  static YogaNameIndex MakeNames(std::initializer_list<std::pair<std::string_view, TEnum>> values) noexcept {
+    std::vector<std::string_view> names;
+    for (const auto &value : values) {
+      names.push_back(value.first);
+    }
+
+    return YogaNameIndex(names.begin(), names.end());
+  }
+
+ private:
+  TEnum m_defaultValue;
+  bool m_isClosedSet;
+  YogaNameIndex m_names;
+  std::vector<TEnum> m_values;
+};
+
+static const YogaEnumValues<YGFlexDirection> &FlexDirectionValues() noexcept {
+  static const YogaEnumValues<YGFlexDirection> s_values{
+      YGFlexDirectionColumn,
+      {{"column", YGFlexDirectionColumn},
+       {"row", YGFlexDirectionRow},
+       {"column-reverse", YGFlexDirectionColumnReverse},
+       {"row-reverse", YGFlexDirectionRowReverse}}};
+  return s_values;
+}
+
+static const YogaEnumValues<YGJustify> &JustifyValues() noexcept {
+  static const YogaEnumValues<YGJustify> s_values{
+      YGJustifyFlexStart,
+      {{"flex-start", YGJustifyFlexStart},
+       {"flex-end", YGJustifyFlexEnd},
+       {"center", YGJustifyCenter},
+       {"space-between", YGJustifySpaceBetween},
+       {"space-around", YGJustifySpaceAround},
+       {"space-evenly", YGJustifySpaceEvenly}}};
+  return s_values;
+}
+
+static const YogaEnumValues<YGWrap> &WrapValues() noexcept {
+  static const YogaEnumValues<YGWrap> s_values{YGWrapNoWrap, {{"nowrap", YGWrapNoWrap}, {"wrap", YGWrapWrap}}};
+  return s_values;
+}
+
+static const YogaEnumValues<YGAlign> &AlignItemsValues() noexcept {
+  static const YogaEnumValues<YGAlign> s_values{
+      YGAlignStretch,
+      {{"stretch", YGAlignStretch},
+       {"flex-start", YGAlignFlexStart},
+       {"flex-end", YGAlignFlexEnd},
+       {"center", YGAlignCenter},
+       {"baseline", YGAlignBaseline}}};
+  return s_values;
+}
+
+static const YogaEnumValues<YGAlign> &AlignSelfValues() noexcept {
+  static const YogaEnumValues<YGAlign> s_values{
+      YGAlignAuto,
+      {{"auto", YGAlignAuto},
+       {"stretch", YGAlignStretch},
+       {"flex-start", YGAlignFlexStart},
+       {"flex-end", YGAlignFlexEnd},
+       {"center", YGAlignCenter},
+       {"baseline", YGAlignBaseline}}};
+  return s_values;
+}
+
+static const YogaEnumValues<YGAlign> &AlignContentValues() noexcept {
+  static const YogaEnumValues<YGAlign> s_values{
+      YGAlignFlexStart,
+      {{"stretch", YGAlignStretch},
+       {"flex-start", YGAlignFlexStart},
+       {"flex-end", YGAlignFlexEnd},
+       {"center", YGAlignCenter},
+       {"space-between", YGAlignSpaceBetween},
+       {"space-around", YGAlignSpaceAround}}};
+  return s_values;
+}
+
+static const YogaEnumValues<YGPositionType> &PositionTypeValues() noexcept {
+  static const YogaEnumValues<YGPositionType> s_values{
+      YGPositionTypeRelative,
+      {{"relative", YGPositionTypeRelative},
+       {"absolute", YGPositionTypeAbsolute},
+       {"static", YGPositionTypeStatic}}};
+  return s_values;
+}
+
+static const YogaEnumValues<YGOverflow> &OverflowValues() noexcept {
+  static const YogaEnumValues<YGOverflow> s_values{
+      YGOverflowVisible,
+      {{"visible", YGOverflowVisible}, {"hidden", YGOverflowHidden}, {"scroll", YGOverflowScroll}},
+      /*isClosedSet:*/ false};
+  return s_values;
+}
+
+static const YogaEnumValues<YGDisplay> &DisplayValues() noexcept {
+  static const YogaEnumValues<YGDisplay> s_values{
+      YGDisplayFlex, {{"flex", YGDisplayFlex}, {"none", YGDisplayNone}}, /*isClosedSet:*/ false};
+  return s_values;
+}
+
+// The Yoga node and the arguments shared by all style props of one StyleYogaNode call.
+struct YogaStyleTarget {
+  YGNodeRef Node;
+  bool ImplementsPadding;
+  const YogaStyleErrorHandler &OnError;
+};
+
+using YogaStyleSetter = void (*)(
+    const YogaStyleTarget &target,
+    std::string_view key,
+    const YogaStyleValue &value);
+
+template <class TEnum, void (*SetStyle)(YGNodeRef, TEnum), const YogaEnumValues<TEnum> &(*Values)()>
+static void SetEnumStyle(
+    const YogaStyleTarget &target,
+    std::string_view /*key*/,
+    const YogaStyleValue &value) {
+  SetStyle(target.Node, Values().Find(value));
+}
+
+template <void (*SetStyle)(YGNodeRef, float), int DefaultValue>
+static void SetNumberStyle(
+    const YogaStyleTarget &target,
+    std::string_view /*key*/,
+    const YogaStyleValue &value) {
+  SetStyle(target.Node, NumberOrDefault(value, static_cast<float>(DefaultValue)));
+}
+
+template <YGEdge Edge>
+static void SetBorderStyle(
+    const YogaStyleTarget &target,
+    std::string_view /*key*/,
+    const YogaStyleValue &value) {
+  YGNodeStyleSetBorder(target.Node, Edge, NumberOrDefault(value, 0.0f /*default*/));
+}
+
+template <YGEdge Edge>
+static void SetPositionStyle(
+    const YogaStyleTarget &target,
+    std::string_view key,
+    const YogaStyleValue &value) {
+  YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, key, target.OnError);
+  SetYogaValueHelper(target.Node, Edge, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
+}
+
+template <YGEdge Edge>
+static void SetMarginStyle(
+    const YogaStyleTarget &target,
+    std::string_view key,
+    const YogaStyleValue &value) {
+  YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, key, target.OnError);
+  SetYogaValueAutoHelper(
+      target.Node, Edge, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+}
+
+// The padding is ignored if the view implements it. paddingRight has always been applied to Yoga.
+template <YGEdge Edge, bool IgnoreIfViewImplementsPadding = true>
+static void SetPaddingStyle(
+    const YogaStyleTarget &target,
+    std::string_view key,
+    const YogaStyleValue &value) {
+  if (!IgnoreIfViewImplementsPadding || !target.ImplementsPadding) {
+    YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, key, target.OnError);
+    SetYogaValueHelper(target.Node, Edge, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+  }
+}
+
+template <YogaUnitSetterFunc SetStyle, YogaUnitSetterFunc SetStylePercent, YogaAutoUnitSetterFunc SetStyleAuto>
+static void SetAutoDimensionStyle(
+    const YogaStyleTarget &target,
+    std::string_view key,
+    const YogaStyleValue &value) {
+  YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, key, target.OnError);
+  SetYogaUnitValueAutoHelper(target.Node, result, SetStyle, SetStylePercent, SetStyleAuto);
+}
+
+// The min dimensions default to zero and the max dimensions default to undefined.
+template <YogaUnitSetterFunc SetStyle, YogaUnitSetterFunc SetStylePercent, bool IsMinDimension>
+static void SetLimitDimensionStyle(
+    const YogaStyleTarget &target,
+    std::string_view key,
+    const YogaStyleValue &value) {
+  YGValue defaultValue = IsMinDimension ? YGValue{0.0f, YGUnitPoint} : YGValue{YGUndefined, YGUnitPoint};
+  YGValue result = YGValueOrDefault(value, defaultValue, key, target.OnError);
+  SetYogaUnitValueHelper(target.Node, result, SetStyle, SetStylePercent);
+}
+
+// https://github.com/microsoft/react-native-windows/issues/4668
+// In order to support the direction property, we tell yoga to always layout
+// in LTR direction, then push the appropriate FlowDirection into XAML.
+// This way XAML handles flipping in RTL mode, which works both for RN components
+// as well as native components that have purely XAML sub-trees (eg ComboBox).
+static void SetDirectionStyle(
+    const YogaStyleTarget &target,
+    std::string_view /*key*/,
+    const YogaStyleValue & /*value*/) {
+  YGNodeStyleSetDirection(target.Node, YGDirectionLTR);
+}
+
+struct YogaStylePropSetter {
+  std::string_view Name;
+  YogaStyleSetter Setter;
+};
+
+// All props handled by StyleYogaNode with their typed setters.
+static constexpr YogaStylePropSetter s_yogaStyleProps[] = {
+    {"flexDirection", SetEnumStyle<YGFlexDirection, YGNodeStyleSetFlexDirection, FlexDirectionValues>},
+    {"justifyContent", SetEnumStyle<YGJustify, YGNodeStyleSetJustifyContent, JustifyValues>},
+    {"flexWrap", SetEnumStyle<YGWrap, YGNodeStyleSetFlexWrap, WrapValues>},
+    {"alignItems", SetEnumStyle<YGAlign, YGNodeStyleSetAlignItems, AlignItemsValues>},
+    {"alignSelf", SetEnumStyle<YGAlign, YGNodeStyleSetAlignSelf, AlignSelfValues>},
+    {"alignContent", SetEnumStyle<YGAlign, YGNodeStyleSetAlignContent, AlignContentValues>},
+    {"flex", SetNumberStyle<YGNodeStyleSetFlex, 0>},
+    {"flexGrow", SetNumberStyle<YGNodeStyleSetFlexGrow, 0>},
+    {"flexShrink", SetNumberStyle<YGNodeStyleSetFlexShrink, 0>},
+    {"flexBasis",
+     SetAutoDimensionStyle<YGNodeStyleSetFlexBasis, YGNodeStyleSetFlexBasisPercent, YGNodeStyleSetFlexBasisAuto>},
+    {"position", SetEnumStyle<YGPositionType, YGNodeStyleSetPositionType, PositionTypeValues>},
+    {"overflow", SetEnumStyle<YGOverflow, YGNodeStyleSetOverflow, OverflowValues>},
+    {"display", SetEnumStyle<YGDisplay, YGNodeStyleSetDisplay, DisplayValues>},
+    {"direction", SetDirectionStyle},
+    {"aspectRatio", SetNumberStyle<YGNodeStyleSetAspectRatio, 1>},
+    {"left", SetPositionStyle<YGEdgeLeft>},
+    {"top", SetPositionStyle<YGEdgeTop>},
+    {"right", SetPositionStyle<YGEdgeRight>},
+    {"bottom", SetPositionStyle<YGEdgeBottom>},
+    {"end", SetPositionStyle<YGEdgeEnd>},
+    {"start", SetPositionStyle<YGEdgeStart>},
+    {"width", SetAutoDimensionStyle<YGNodeStyleSetWidth, YGNodeStyleSetWidthPercent, YGNodeStyleSetWidthAuto>},
+    {"minWidth", SetLimitDimensionStyle<YGNodeStyleSetMinWidth, YGNodeStyleSetMinWidthPercent, true>},
+    {"maxWidth", SetLimitDimensionStyle<YGNodeStyleSetMaxWidth, YGNodeStyleSetMaxWidthPercent, false>},
+    {"height", SetAutoDimensionStyle<YGNodeStyleSetHeight, YGNodeStyleSetHeightPercent, YGNodeStyleSetHeightAuto>},
+    {"minHeight", SetLimitDimensionStyle<YGNodeStyleSetMinHeight, YGNodeStyleSetMinHeightPercent, true>},
+    {"maxHeight", SetLimitDimensionStyle<YGNodeStyleSetMaxHeight, YGNodeStyleSetMaxHeightPercent, false>},
+    {"margin", SetMarginStyle<YGEdgeAll>},
+    {"marginLeft", SetMarginStyle<YGEdgeLeft>},
+    {"marginStart", SetMarginStyle<YGEdgeStart>},
+    {"marginTop", SetMarginStyle<YGEdgeTop>},
+    {"marginRight", SetMarginStyle<YGEdgeRight>},
+    {"marginEnd", SetMarginStyle<YGEdgeEnd>},
+    {"marginBottom", SetMarginStyle<YGEdgeBottom>},
+    {"marginHorizontal", SetMarginStyle<YGEdgeHorizontal>},
+    {"marginVertical", SetMarginStyle<YGEdgeVertical>},
+    {"padding", SetPaddingStyle<YGEdgeAll>},
+    {"paddingLeft", SetPaddingStyle<YGEdgeLeft>},
+    {"paddingStart", SetPaddingStyle<YGEdgeStart>},
+    {"paddingTop", SetPaddingStyle<YGEdgeTop>},
+    {"paddingRight", SetPaddingStyle<YGEdgeRight, /*IgnoreIfViewImplementsPadding:*/ false>},
+    {"paddingEnd", SetPaddingStyle<YGEdgeEnd>},
+    {"paddingBottom", SetPaddingStyle<YGEdgeBottom>},
+    {"paddingHorizontal", SetPaddingStyle<YGEdgeHorizontal>},
+    {"paddingVertical", SetPaddingStyle<YGEdgeVertical>},
+    {"borderWidth", SetBorderStyle<YGEdgeAll>},
+    {"borderLeftWidth", SetBorderStyle<YGEdgeLeft>},
+    {"borderStartWidth", SetBorderStyle<YGEdgeStart>},
+    {"borderTopWidth", SetBorderStyle<YGEdgeTop>},
+    {"borderRightWidth", SetBorderStyle<YGEdgeRight>},
+    {"borderEndWidth", SetBorderStyle<YGEdgeEnd>},
+    {"borderBottomWidth", SetBorderStyle<YGEdgeBottom>},
+};
+
+// Index of the s_yogaStyleProps names. The index of a name is the index of its prop.
+static const YogaNameIndex &YogaPropertyNames() noexcept {
+  static const YogaNameIndex s_names = []() noexcept {
+    std::vector<std::string_view> names;
+    for (const auto &prop : s_yogaStyleProps) {
+      names.push_back(prop.Name);
+    }
+
+    return YogaNameIndex(names.begin(), names.end());
+  }();
+  return s_names;
+}
+
+bool IsYogaStyleProp(std::string_view propName) noexcept {
+  return YogaPropertyNames().Find(propName) >= 0;
+}
+
+// The props that are only drawn. They never change the size of a view or of its measured content.
+static constexpr std::string_view s_paintOnlyProps[] = {
+    "backgroundColor",
+    "opacity",
+    "color",
+    "tintColor",
+    "selectionColor",
+    "placeholderTextColor",
+    "textDecorationColor",
+    "borderColor",
+    "borderLeftColor",
+    "borderStartColor",
+    "borderTopColor",
+    "borderRightColor",
+    "borderEndColor",
+    "borderBottomColor",
+    "borderRadius",
+    "borderTopLeftRadius",
+    "borderTopRightRadius",
+    "borderBottomLeftRadius",
+    "borderBottomRightRadius",
+    "transform",
+    "zIndex",
+    "backfaceVisibility",
+    "pointerEvents",
+    "onLayout",
+    "keyDownEvents",
+    "keyUpEvents",
+    "testID",
+    "nativeID",
+    "tooltip",
+    "accessible",
+    "focusable",
+    "accessibilityLabel",
+    "accessibilityHint",
+    "accessibilityRole",
+    "accessibilityState",
+    "accessibilityValue",
+    "accessibilityLiveRegion",
+    "accessibilityPosInSet",
+    "accessibilitySetSize",
+    "importantForAccessibility",
+};
+
+bool IsPaintOnlyProp(std::string_view propName) noexcept {
+  static const YogaNameIndex s_names(std::begin(s_paintOnlyProps), std::end(s_paintOnlyProps));
+  return s_names.Find(propName) >= 0;
+}
+
+bool StyleYogaNode(
+    YGNodeRef yogaNode,
+    const YogaStyleProp &prop,
+    bool implementsPadding,
+    const YogaStyleErrorHandler &onError) {
+  // Most props are not layout props. Each prop costs one hash lookup, and the layout props are applied
+  // with their typed setters.
+  int propIndex = YogaPropertyNames().Find(prop.Name);
+  if (propIndex < 0) {
+    return false;
+  }
+
+  s_yogaStyleProps[propIndex].Setter(YogaStyleTarget{yogaNode, implementsPadding, onError}, prop.Name, prop.Value);
+  return true;
+}
+
+//===========================================================================
+// YogaNodeTable implementation
+//===========================================================================
+
+YogaNodeTable::Entry *YogaNodeTable::Find(int64_t tag) noexcept {
+  uint32_t entryIndex = m_entryIndexes.Find(tag);
+  return entryIndex != TagIndex::NoIndex ? &m_entries[entryIndex] : nullptr;
+}
+
+const YogaNodeTable::Entry *YogaNodeTable::Find(int64_t tag) const noexcept {
+  uint32_t entryIndex = m_entryIndexes.Find(tag);
+  return entryIndex != TagIndex::NoIndex ? &m_entries[entryIndex] : nullptr;
+}
+
+YogaNodeTable::Entry *YogaNodeTable::Add(int64_t tag, YogaNodePtr &&node) noexcept {
+  if (tag < 0 || m_entryIndexes.Find(tag) != TagIndex::NoIndex) {
+    return nullptr;
+  }
+
+  m_entryIndexes.Set(tag, static_cast<uint32_t>(m_entries.size()));
+  m_entries.push_back(Entry{tag, std::move(node), nullptr, -1, {}});
+  return &m_entries.back();
+}
+
+void YogaNodeTable::Remove(int64_t tag) noexcept {
+  uint32_t entryIndex = m_entryIndexes.Find(tag);
+  if (entryIndex == TagIndex::NoIndex) {
+    return;
+  }
+
+  // Keep the entries dense by moving the last entry into the removed one.
+  uint32_t lastEntryIndex = static_cast<uint32_t>(m_entries.size() - 1);
+  if (entryIndex != lastEntryIndex) {
+    m_entries[entryIndex] = std::move(m_entries[lastEntryIndex]);
+    m_entryIndexes.Set(m_entries[entryIndex].Tag, entryIndex);
+  }
+
+  m_entries.pop_back();
+  m_entryIndexes.Set(tag, TagIndex::NoIndex);
+}
+
+//===========================================================================
+// YogaParallelLayout implementation
+//===========================================================================
+
+class YogaParallelLayout;
+
+// The layout that runs on the current thread. The measure functions are found through it.
+static thread_local YogaLayoutCore *t_layoutCore{nullptr};
+static thread_local YogaParallelLayout *t_parallelLayout{nullptr};
+
+// Sets the current layout for the lifetime of the scope.
+struct YogaLayoutScope {
+  YogaLayoutScope(YogaLayoutCore *layoutCore, YogaParallelLayout *parallelLayout) noexcept {
+    t_layoutCore = layoutCore;
+    t_parallelLayout = parallelLayout;
+  }
+
+  ~YogaLayoutScope() noexcept {
+    t_layoutCore = nullptr;
+    t_parallelLayout = nullptr;
+  }
+};
+
+// Shared by the workers of one CalculateLayouts call and the thread that waits for them.
+// Each root is laid out by the first thread that takes it, and the waiting thread takes roots too.
+// It does not depend on the workers to start, and it does not block while there are roots to lay out.
+class YogaParallelLayout final {
+ public:
+  struct Root {
+    YGNodeRef Node;
+    float Width;
+    float Height;
+  };
+
+  YogaParallelLayout(YogaLayoutCore *layoutCore, std::vector<Root> &&roots) noexcept
+      : m_layoutCore{layoutCore},
+        m_waitingThreadId{std::this_thread::get_id()},
+        m_roots{std::move(roots)},
+        m_pendingRootCount{m_roots.size()} {}
+
+  // Called by the workers. The measure function runs on the waiting thread.
+  YGSize Measure(
+      YGMeasureFunc measureFunc,
+      YGNodeRef node,
+      float width,
+      YGMeasureMode widthMode,
+      float height,
+      YGMeasureMode heightMode) noexcept {
+    if (std::this_thread::get_id() == m_waitingThreadId) {
+      return measureFunc(node, width, widthMode, height, heightMode);
+    }
+
+    MeasureRequest request{measureFunc, node, width, widthMode, height, heightMode};
+    std::unique_lock lock{m_mutex};
+    m_measureRequests.push_back(&request);
+    m_condition.notify_all();
+    m_condition.wait(lock, [&request]() noexcept { return request.IsDone; });
+    return request.Result;
+  }
+
+  // Called by the workers. A worker that starts after all roots are taken returns without any work.
+  void CalculateRoots() noexcept {
+    while (CalculateNextRoot()) {
+    }
+  }
+
+  // Runs the measure requests and lays out the roots that are not taken until all roots are laid out.
+  // The measure requests go first, because the workers are blocked on them.
+  void Wait() noexcept {
+    std::unique_lock lock{m_mutex};
+    for (;;) {
+      if (!m_measureRequests.empty()) {
+        auto requests = std::move(m_measureRequests);
+        m_measureRequests.clear();
+        lock.unlock();
+        for (auto request : requests) {
+          request->Result = request->MeasureFunc(
+              request->Node, request->Width, request->WidthMode, request->Height, request->HeightMode);
+        }
+
+        lock.lock();
+        for (auto request : requests) {
+          request->IsDone = true;
+        }
+
+        m_condition.notify_all();
+      } else if (m_nextRootIndex < m_roots.size()) {
+        lock.unlock();
+        CalculateNextRoot();
+        lock.lock();
+      } else if (m_pendingRootCount == 0) {
+        return;
+      } else {
+        m_condition.wait(lock, [this]() noexcept { return m_pendingRootCount == 0 || !m_measureRequests.empty(); });
+      }
+    }
+  }
+
+ private:
+  // Returns false if all roots are taken.
+  bool CalculateNextRoot() noexcept {
+    size_t rootIndex;
+    {
+      std::scoped_lock lock{m_mutex};
+      if (m_nextRootIndex == m_roots.size()) {
+        return false;
+      }
+
+      rootIndex = m_nextRootIndex++;
+    }
+
+    const Root &root = m_roots[rootIndex];
+    {
+      YogaLayoutScope layoutScope{m_layoutCore, this};
+      YGNodeCalculateLayout(root.Node, root.Width, root.Height, YGDirectionLTR);
+    }
+
+    std::scoped_lock lock{m_mutex};
+    --m_pendingRootCount;
+    m_condition.notify_all();
+    return true;
+  }
+
+ private:
+  struct MeasureRequest {
+    YGMeasureFunc MeasureFunc;
+    YGNodeRef Node;
+    float Width;
+    YGMeasureMode WidthMode;
+    float Height;
+    YGMeasureMode HeightMode;
+    YGSize Result{};
+    bool IsDone{false};
+  };
+
+  YogaLayoutCore *const m_layoutCore;
+  const std::thread::id m_waitingThreadId;
+  const std::vector<Root> m_roots;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  size_t m_nextRootIndex{0};
+  size_t m_pendingRootCount;
+  std::vector<MeasureRequest *> m_measureRequests;
+};
+
+//===========================================================================
+// YogaLayoutCore implementation
+//===========================================================================
+
+YogaLayoutCore::YogaLayoutCore() noexcept : m_config{YGConfigNew()} {
+  m_nodePool.reserve(m_nodePoolCapacity);
+}
+
+YGNodeRef YogaLayoutCore::FindNode(int64_t tag) const noexcept {
+  const auto *entry = m_nodes.Find(tag);
+  return entry ? entry->Node.get() : nullptr;
+}
+
+YGNodeRef YogaLayoutCore::CreateNode(int64_t tag) noexcept {
+  if (m_nodes.Find(tag)) {
+    return nullptr;
+  }
+
+  YogaNodePtr node;
+  if (!m_nodePool.empty()) {
+    node = std::move(m_nodePool.back());
+    m_nodePool.pop_back();
+    ++m_nodePoolHitCount;
+  } else {
+    node = YogaNodePtr{YGNodeNewWithConfig(m_config.get())};
+    ++m_nodePoolMissCount;
+  }
+
+  auto *entry = m_nodes.Add(tag, std::move(node));
+  return entry ? entry->Node.get() : nullptr;
+}
+
+void YogaLayoutCore::SetNodePoolCapacity(size_t capacity) noexcept {
+  m_nodePoolCapacity = capacity;
+  if (m_nodePool.size() > capacity) {
+    m_nodePool.resize(capacity);
+  }
+
+  m_nodePool.reserve(capacity);
+}
+
+void YogaLayoutCore::SetMeasureFunc(
+    int64_t tag,
+    YGMeasureFunc measureFunc,
+    std::shared_ptr<void> &&context,
+    bool canCacheMeasurements) noexcept {
+  if (auto *entry = m_nodes.Find(tag)) {
+    YGNodeRef yogaNode = entry->Node.get();
+    if (measureFunc) {
+      // The new measure function may return other sizes for the same content.
+      auto &measureCache = m_measureCaches[yogaNode];
+      measureCache.MeasureFunc = measureFunc;
+      measureCache.CanCacheMeasurements = canCacheMeasurements;
+      ++measureCache.ContentVersion;
+      YGNodeSetMeasureFunc(yogaNode, MeasureOnLayoutThread);
+    } else {
+      m_measureCaches.erase(yogaNode);
+      YGNodeSetMeasureFunc(yogaNode, nullptr);
+    }
+
+    YGNodeSetContext(yogaNode, context.get());
+    entry->Context = std::move(context);
+  }
+}
+
+void YogaLayoutCore::MarkContentDirty(int64_t tag) noexcept {
+  if (YGNodeRef yogaNode = FindNode(tag)) {
+    auto it = m_measureCaches.find(yogaNode);
+    if (it != m_measureCaches.end()) {
+      ++it->second.ContentVersion;
+    }
+
+    YGNodeMarkDirty(yogaNode);
+  }
+}
+
+void YogaLayoutCore::InsertChild(int64_t parentTag, int64_t childTag, uint32_t index) noexcept {
+  auto *child = m_nodes.Find(childTag);
+  if (!child || !m_nodes.Find(parentTag)) {
+    return;
+  }
+
+  DetachFromParent(*child);
+
+  auto *parent = m_nodes.Find(parentTag);
+  index = std::min(index, static_cast<uint32_t>(parent->ChildTags.size()));
+  YGNodeInsertChild(parent->Node.get(), child->Node.get(), index);
+  parent->ChildTags.insert(parent->ChildTags.begin() + index, childTag);
+  child->ParentTag = parentTag;
+}
+
+void YogaLayoutCore::RemoveChildren(int64_t tag) noexcept {
+  auto *entry = m_nodes.Find(tag);
+  if (!entry) {
+    return;
+  }
+
+  for (size_t i = entry->ChildTags.size(); i > 0; --i) {
+    if (auto *child = m_nodes.Find(entry->ChildTags[i - 1])) {
+      YGNodeRemoveChild(entry->Node.get(), child->Node.get());
+      child->ParentTag = -1;
+    }
+  }
+
+  entry->ChildTags.clear();
+}
+
+void YogaLayoutCore::RemoveNode(int64_t tag) noexcept {
+  auto *entry = m_nodes.Find(tag);
+  if (!entry) {
+    return;
+  }
+
+  DetachFromParent(*entry);
+  for (int64_t childTag : entry->ChildTags) {
+    if (auto *child = m_nodes.Find(childTag)) {
+      child->ParentTag = -1;
+    }
+  }
+
+  YogaNodePtr node = std::move(entry->Node);
+  m_measureCaches.erase(node.get());
+  m_nodes.Remove(tag);
+
+  // The removed node is reset to the default style and kept for the next CreateNode call.
+  // YGNodeReset keeps the config of the node.
+  if (m_nodePool.size() < m_nodePoolCapacity) {
+    YGNodeRemoveAllChildren(node.get());
+    YGNodeReset(node.get());
+    m_nodePool.push_back(std::move(node));
+  }
+}
+
+void YogaLayoutCore::CalculateLayout(int64_t rootTag, float width, float height) noexcept {
+  if (YGNodeRef rootNode = FindNode(rootTag)) {
+    YogaLayoutScope layoutScope{this, nullptr};
+    YGNodeCalculateLayout(rootNode, width, height, YGDirectionLTR);
+  }
+}
+
+void YogaLayoutCore::CalculateLayouts(
+    const std::vector<YogaLayoutRoot> &roots,
+    const YogaTaskScheduler &scheduler) noexcept {
+  // The clean roots only check their cached layout. It is not worth a thread switch.
+  std::vector<YogaParallelLayout::Root> dirtyRoots;
+  for (const auto &root : roots) {
+    if (YGNodeRef rootNode = FindNode(root.Tag)) {
+      if (YGNodeIsDirty(rootNode)) {
+        dirtyRoots.push_back(YogaParallelLayout::Root{rootNode, root.Width, root.Height});
+      } else {
+        CalculateLayout(root.Tag, root.Width, root.Height);
+      }
+    }
+  }
+
+  if (dirtyRoots.size() == 1) {
+    YogaLayoutScope layoutScope{this, nullptr};
+    YGNodeCalculateLayout(dirtyRoots[0].Node, dirtyRoots[0].Width, dirtyRoots[0].Height, YGDirectionLTR);
+  } else if (dirtyRoots.size() > 1) {
+    // This thread lays out roots too, so one worker less than there are roots is needed.
+    // The workers may start after this call returns, so they share the ownership of the parallel layout.
+    size_t workerCount = dirtyRoots.size() - 1;
+    auto parallelLayout = std::make_shared<YogaParallelLayout>(this, std::move(dirtyRoots));
+    for (size_t i = 0; i < workerCount; ++i) {
+      scheduler([parallelLayout]() noexcept { parallelLayout->CalculateRoots(); });
+    }
+
+    parallelLayout->Wait();
+  }
+}
+
+void YogaLayoutCore::ApplyLayout(int64_t rootTag, const YogaLayoutHandler &onLayout) {
+  auto *entry = m_nodes.Find(rootTag);
+  if (!entry) {
+    return;
+  }
+
+  YGNodeRef yogaNode = entry->Node.get();
+  if (!YGNodeGetHasNewLayout(yogaNode)) {
+    return;
+  }
+
+  YGNodeSetHasNewLayout(yogaNode, false);
+  onLayout(
+      rootTag,
+      YGNodeLayoutGetLeft(yogaNode),
+      YGNodeLayoutGetTop(yogaNode),
+      YGNodeLayoutGetWidth(yogaNode),
+      YGNodeLayoutGetHeight(yogaNode));
+
+  // The handler must not change the nodes, so the child tags can be walked in place.
+  for (int64_t childTag : entry->ChildTags) {
+    ApplyLayout(childTag, onLayout);
+  }
+}
+
+YGSize YogaLayoutCore::MeasureOnLayoutThread(
+    YGNodeRef node,
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode) {
+  // The map is not changed during layout, and each worker changes only the caches of its own root's nodes.
+  YogaLayoutCore *layoutCore = t_layoutCore;
+  assert(layoutCore);
+  auto it = layoutCore->m_measureCaches.find(node);
+  if (it == layoutCore->m_measureCaches.end()) {
+    return YGSize{0, 0};
+  }
+
+  auto &measureCache = it->second;
+  if (measureCache.CanCacheMeasurements) {
+    if (auto measurement = measureCache.Find(width, widthMode, height, heightMode)) {
+      return measurement->Size;
+    }
+  }
+
+  YGSize size = t_parallelLayout
+      ? t_parallelLayout->Measure(measureCache.MeasureFunc, node, width, widthMode, height, heightMode)
+      : measureCache.MeasureFunc(node, width, widthMode, height, heightMode);
+  if (measureCache.CanCacheMeasurements) {
+    measureCache.Add(width, widthMode, height, heightMode, size);
+  }
+
+  return size;
+}
+
+// The value of an undefined constraint is not used by the measure functions.
+static bool IsSameConstraint(float value, YGMeasureMode mode, float otherValue, YGMeasureMode otherMode) noexcept {
+  return mode == otherMode && (mode == YGMeasureModeUndefined || value == otherValue);
+}
+
+const YogaLayoutCore::MeasureCache::Measurement *YogaLayoutCore::MeasureCache::Find(
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode) const noexcept {
+  for (uint32_t i = 0; i < Count; ++i) {
+    const auto &measurement = Measurements[i];
+    if (measurement.ContentVersion == ContentVersion &&
+        IsSameConstraint(measurement.Width, measurement.WidthMode, width, widthMode) &&
+        IsSameConstraint(measurement.Height, measurement.HeightMode, height, heightMode)) {
+      return &measurement;
+    }
+  }
+
+  return nullptr;
+}
+
+void YogaLayoutCore::MeasureCache::Add(
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode,
+    YGSize size) noexcept {
+  Measurements[NextIndex] = Measurement{ContentVersion, width, widthMode, height, heightMode, size};
+  NextIndex = (NextIndex + 1) % Capacity;
+  Count = std::min(Count + 1, Capacity);
+}
+
+void YogaLayoutCore::DetachFromParent(YogaNodeTable::Entry &entry) noexcept {
+  if (auto *parent = m_nodes.Find(entry.ParentTag)) {
+    YGNodeRemoveChild(parent->Node.get(), entry.Node.get());
+    auto &siblingTags = parent->ChildTags;
+    siblingTags.erase(std::remove(siblingTags.begin(), siblingTags.end(), entry.Tag), siblingTags.end());
+  }
+
+  entry.ParentTag = -1;
+}
+
+} // namespace Microsoft::ReactNative
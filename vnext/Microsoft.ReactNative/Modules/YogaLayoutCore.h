@@ -0,0 +1,232 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <Utils/TagIndex.h>
+#include <yoga/yoga.h>
+#include <array>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+// The platform neutral part of the layout: Yoga nodes indexed by React tag, the style props applied to them,
+// and the layout calculation. It only depends on Yoga and the standard library, so that the layout can be tested
+// and measured without UI or the Windows Runtime. NativeUIManager drives it with the createView, updateView and
+// manageChildren batches.
+
+struct YogaNodeDeleter {
+  void operator()(YGNodeRef node) {
+    YGNodeFree(node);
+  }
+};
+
+typedef std::unique_ptr<YGNode, YogaNodeDeleter> YogaNodePtr;
+
+struct YogaConfigDeleter {
+  void operator()(YGConfigRef config) {
+    YGConfigFree(config);
+  }
+};
+
+// Receives the error message for a style value that cannot be applied to a Yoga node.
+using YogaStyleErrorHandler = std::function<void(const std::string &message)>;
+
+// Receives the new layout of a node relative to its parent.
+using YogaLayoutHandler = std::function<void(int64_t tag, float left, float top, float width, float height)>;
+
+// A root node to lay out with the size available to it.
+struct YogaLayoutRoot {
+  int64_t Tag;
+  float Width;
+  float Height;
+};
+
+// Runs the task on a worker thread.
+using YogaTaskScheduler = std::function<void(std::function<void()> &&task)>;
+
+// A prop value in the form the Yoga style setters read it. The string is not owned.
+// The values that are neither null, a number nor a string keep their text for the error messages.
+struct YogaStyleValue {
+  enum class Kind { Null, Number, String, Other };
+
+  YogaStyleValue() noexcept = default;
+  YogaStyleValue(double number) noexcept : Type{Kind::Number}, Number{number} {}
+  YogaStyleValue(int number) noexcept : YogaStyleValue{static_cast<double>(number)} {}
+  YogaStyleValue(std::string_view str, Kind type = Kind::String) noexcept : Type{type}, String{str} {}
+  YogaStyleValue(const char *str) noexcept : YogaStyleValue{std::string_view{str}} {}
+
+  Kind Type{Kind::Null};
+  double Number{0};
+  std::string_view String;
+};
+
+// A prop name with its value.
+struct YogaStyleProp {
+  std::string_view Name;
+  YogaStyleValue Value;
+};
+
+// Returns true if the prop is applied to Yoga nodes by StyleYogaNode.
+bool IsYogaStyleProp(std::string_view propName) noexcept;
+
+// Returns true if the prop changes only how a view is drawn. Such props never invalidate the measured size.
+bool IsPaintOnlyProp(std::string_view propName) noexcept;
+
+// Applies the prop to the Yoga node if it is a layout prop, and returns false for all other props.
+// The padding props are ignored if the view implements the padding itself.
+bool StyleYogaNode(
+    YGNodeRef yogaNode,
+    const YogaStyleProp &prop,
+    bool implementsPadding,
+    const YogaStyleErrorHandler &onError);
+
+// Yoga nodes and their contexts indexed by the React tag.
+// The entries are stored densely, and a TagIndex maps a tag to its entry in constant time.
+class YogaNodeTable final {
+ public:
+  struct Entry {
+    int64_t Tag;
+    YogaNodePtr Node;
+    std::shared_ptr<void> Context; // owns the data used by the measure function
+    int64_t ParentTag{-1};
+    std::vector<int64_t> ChildTags; // children in the Yoga tree
+  };
+
+  Entry *Find(int64_t tag) noexcept;
+  const Entry *Find(int64_t tag) const noexcept;
+
+  // Returns nullptr if the tag already has a Yoga node.
+  Entry *Add(int64_t tag, YogaNodePtr &&node) noexcept;
+  void Remove(int64_t tag) noexcept;
+
+  size_t Size() const noexcept {
+    return m_entries.size();
+  }
+
+ private:
+  std::vector<Entry> m_entries;
+  TagIndex m_entryIndexes;
+};
+
+class YogaLayoutCore final {
+ public:
+  YogaLayoutCore() noexcept;
+
+  YogaLayoutCore(const YogaLayoutCore &) = delete;
+  YogaLayoutCore &operator=(const YogaLayoutCore &) = delete;
+
+  YGConfigRef Config() const noexcept {
+    return m_config.get();
+  }
+
+  size_t NodeCount() const noexcept {
+    return m_nodes.Size();
+  }
+
+  YGNodeRef FindNode(int64_t tag) const noexcept;
+
+  // Creates a Yoga node for the tag. Returns nullptr if the tag already has a Yoga node.
+  // The nodes of removed tags are reset and reused, so that mounting and unmounting views at a steady rate
+  // does not allocate Yoga nodes.
+  YGNodeRef CreateNode(int64_t tag) noexcept;
+
+  // Sets how many removed Yoga nodes are kept for reuse.
+  // NativeUIManager takes it from the "YogaLayoutCore.NodePoolCapacity" runtime option.
+  void SetNodePoolCapacity(size_t capacity) noexcept;
+
+  size_t NodePoolHitCount() const noexcept {
+    return m_nodePoolHitCount;
+  }
+
+  size_t NodePoolMissCount() const noexcept {
+    return m_nodePoolMissCount;
+  }
+
+  // Sets the measure function and the context it gets from YGNodeGetContext. The context is owned by the node.
+  // The measure function is always called on the thread that runs CalculateLayout or CalculateLayouts.
+  // Its results are cached unless canCacheMeasurements is false, which is needed when they depend on state
+  // that MarkContentDirty is not called for.
+  void SetMeasureFunc(
+      int64_t tag,
+      YGMeasureFunc measureFunc,
+      std::shared_ptr<void> &&context,
+      bool canCacheMeasurements = true) noexcept;
+
+  // Marks the node dirty after the content seen by its measure function changed, e.g. its text or font.
+  // The measure results are cached per content version and constraints. Nodes that are dirty only because
+  // of style or child changes reuse them, so that the measure function runs again only for new content
+  // or new constraints.
+  void MarkContentDirty(int64_t tag) noexcept;
+
+  // Inserts the child into the parent's children. The child is removed from its previous parent first.
+  void InsertChild(int64_t parentTag, int64_t childTag, uint32_t index) noexcept;
+  void RemoveChildren(int64_t tag) noexcept;
+  void RemoveNode(int64_t tag) noexcept;
+
+  // We always run layout in LTR mode. RTL is applied by the platform views.
+  void CalculateLayout(int64_t rootTag, float width, float height) noexcept;
+
+  // Lays out the roots that have dirty nodes concurrently on the calling thread and the scheduler's workers.
+  // Separate roots share no Yoga nodes, and the Yoga config must not change while they are laid out.
+  // The calling thread lays out the roots that no worker has taken yet, so it never waits for a worker to start.
+  // The measure functions measure thread-affine views: the workers pass their calls to the calling thread,
+  // which runs them between its roots. A single dirty root is laid out on the calling thread only.
+  void CalculateLayouts(const std::vector<YogaLayoutRoot> &roots, const YogaTaskScheduler &scheduler) noexcept;
+
+  // Calls onLayout for the nodes with a new layout under the root and clears their new layout flag.
+  // Yoga does not visit the children of nodes that keep their cached layout. Such nodes and their subtrees
+  // do not have a new layout, so only the changed subtrees are walked.
+  void ApplyLayout(int64_t rootTag, const YogaLayoutHandler &onLayout);
+
+ private:
+  // The measure function of a node and its last results.
+  struct MeasureCache {
+    struct Measurement {
+      uint32_t ContentVersion;
+      float Width;
+      YGMeasureMode WidthMode;
+      float Height;
+      YGMeasureMode HeightMode;
+      YGSize Size;
+    };
+
+    static constexpr uint32_t Capacity = 4;
+
+    YGMeasureFunc MeasureFunc{nullptr};
+    bool CanCacheMeasurements{true};
+    uint32_t ContentVersion{0};
+    uint32_t Count{0};
+    uint32_t NextIndex{0};
+    std::array<Measurement, Capacity> Measurements;
+
+    const Measurement *Find(float width, YGMeasureMode widthMode, float height, YGMeasureMode heightMode)
+        const noexcept;
+    void Add(float width, YGMeasureMode widthMode, float height, YGMeasureMode heightMode, YGSize size) noexcept;
+  };
+
+  void DetachFromParent(YogaNodeTable::Entry &entry) noexcept;
+  static YGSize MeasureOnLayoutThread(
+      YGNodeRef node,
+      float width,
+      YGMeasureMode widthMode,
+      float height,
+      YGMeasureMode heightMode);
+
+ private:
+  // The config is declared first to be destroyed after the nodes that use it.
+  std::unique_ptr<YGConfig, YogaConfigDeleter> m_config;
+  YogaNodeTable m_nodes;
+  std::unordered_map<YGNodeRef, MeasureCache> m_measureCaches;
+  std::vector<YogaNodePtr> m_nodePool;
+  size_t m_nodePoolCapacity{256};
+  size_t m_nodePoolHitCount{0};
+  size_t m_nodePoolMissCount{0};
+};
+
+} // namespace Microsoft::ReactNative
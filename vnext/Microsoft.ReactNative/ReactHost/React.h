@@ -111,6 +111,8 @@ struct IReactContext : IUnknown {
   virtual winrt::Microsoft::ReactNative::IReactNotificationService Notifications() const noexcept = 0;
   virtual winrt::Microsoft::ReactNative::IReactPropertyBag Properties() const noexcept = 0;
   virtual void CallJSFunction(std::string &&module, std::string &&method, folly::dynamic &&params) const noexcept = 0;
+  // Calls several JS functions with one call into JS. The calls are a flat array of module, method and params.
+  virtual void CallJSFunctions(folly::dynamic &&calls) const noexcept = 0;
   virtual void DispatchEvent(int64_t viewTag, std::string &&eventName, folly::dynamic &&eventData) const noexcept = 0;
   virtual winrt::Microsoft::ReactNative::JsiRuntime JsiRuntime() const noexcept = 0;
   virtual ReactInstanceState State() const noexcept = 0;
@@ -237,6 +239,9 @@ struct ReactOptions {
 
   std::string ByteCodeFileUri;
   bool EnableByteCodeCaching{true};
+
+  //! Flag controlling whether the loaded JavaScript bundle is kept in memory for other instances and reloads.
+  bool EnableJSBundleCache{false};
   JSIEngine JsiEngine{JSIEngine::Chakra};
 
   //! Enable function nativePerformanceNow.
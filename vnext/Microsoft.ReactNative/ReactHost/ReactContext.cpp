@@ -127,6 +127,12 @@ void ReactContext::CallJSFunction(std::string &&module, std::string &&method, fo
   }
 }
 
+void ReactContext::CallJSFunctions(folly::dynamic &&calls) const noexcept {
+  if (auto instance = m_reactInstance.GetStrongPtr()) {
+    instance->CallJsFunctions(std::move(calls));
+  }
+}
+
 void ReactContext::DispatchEvent(int64_t viewTag, std::string &&eventName, folly::dynamic &&eventData) const noexcept {
 #ifndef CORE_ABI // requires instance
   if (auto instance = m_reactInstance.GetStrongPtr()) {
@@ -61,6 +61,7 @@
 #endif
 #include "Modules/ReactRootViewTagGenerator.h"
 
+#include <Utils/JSCallBatch.h>
 #ifndef CORE_ABI
 #include <Utils/UwpPreparedScriptStore.h>
 #include <Utils/UwpScriptStore.h>
@@ -83,6 +84,7 @@
 
 #include "JsiApi.h"
 #include "ReactCoreInjection.h"
+#include "RuntimeOptions.h"
 
 namespace Microsoft::ReactNative {
 
@@ -131,6 +133,11 @@ struct BridgeUIBatchInstanceCallback final : public facebook::react::InstanceCal
   void onBatchComplete() override {
     if (auto instance = m_wkInstance.GetStrongPtr()) {
       if (instance->IsLoaded()) {
+        bool isFirstUIBatchCompletedExpected = false;
+        if (instance->m_isFirstUIBatchCompleted.compare_exchange_strong(isFirstUIBatchCompletedExpected, true)) {
+          instance->m_startupTimeline->Mark("FirstUIBatchComplete");
+        }
+
         if (instance->UseWebDebugger()) {
           // While using a CxxModule for UIManager (which we do when running under webdebugger)
           // We need to post the batch complete to the NativeQueue to ensure that the UIManager
@@ -247,13 +254,25 @@ ReactInstanceWin::ReactInstanceWin(
         }
       });
 
+  // Publish the startup timeline so that the app can query it after the instance is loaded.
+  ReactPropertyBag(m_reactContext->Properties()).Set(StartupTimelineProperty(), m_startupTimeline);
+
+  // The profiler is idle until DevSettings.setProfilingEnabled is called.
+  ReactPropertyBag(m_reactContext->Properties()).Set(SamplingProfilerProperty(), m_samplingProfiler);
+  // The counter is removed in the destructor, because the profiler may outlive the instance.
+  m_jsCallQueueCounterCookie = m_samplingProfiler->AddCounter("JSCallQueue.Pending", [this]() noexcept {
+    return static_cast<int64_t>(m_jsCallQueueSize.load(std::memory_order_relaxed));
+  });
+
   // We notify the ReactHost immediately that the instance is created, but the
   // OnInstanceCreated event is raised only after the internal react-native instance is ready and
   // it starts handling JS queue work items.
   m_whenCreated.SetValue();
 }
 
-ReactInstanceWin::~ReactInstanceWin() noexcept {}
+ReactInstanceWin::~ReactInstanceWin() noexcept {
+  m_samplingProfiler->RemoveCounter(m_jsCallQueueCounterCookie);
+}
 
 void ReactInstanceWin::LoadModules(
     const std::shared_ptr<winrt::Microsoft::ReactNative::NativeModulesProvider> &nativeModulesProvider,
@@ -336,13 +355,30 @@ void ReactInstanceWin::LoadModules(
 
 //! Initialize() is called from the native queue.
 void ReactInstanceWin::Initialize() noexcept {
-  InitJSMessageThread();
-  InitNativeMessageThread();
-  InitUIMessageThread();
+  // The InstanceLoad phase ends in OnReactInstanceLoaded.
+  m_startupTimeline->BeginPhase("InstanceLoad");
+
+  // Bridge call arguments are built on the JS thread and destroyed on the UI thread.
+  // The pool lets them reuse memory instead of going to the heap for each property.
+  // It only enables the pool of Microsoft.ReactNative.dll. Native modules in other binaries compile their own
+  // copy of JSValue.cpp and must call JSValuePool::SetEnabled themselves.
+  if (::Microsoft::React::GetRuntimeOptionBool("JSValue.Pooling")) {
+    winrt::Microsoft::ReactNative::JSValuePool::SetEnabled(true);
+  }
+
+  {
+    facebook::react::tracing::StartupTimelineScope scope{m_startupTimeline.get(), "InitMessageThreads"};
+    InitJSMessageThread();
+    InitNativeMessageThread();
+    InitUIMessageThread();
+  }
 
 #ifndef CORE_ABI
-  // InitUIManager uses m_legacyReactInstance
-  InitUIManager();
+  {
+    // InitUIManager uses m_legacyReactInstance
+    facebook::react::tracing::StartupTimelineScope scope{m_startupTimeline.get(), "InitUIManager"};
+    InitUIManager();
+  }
 
   Microsoft::ReactNative::DevMenuManager::InitDevMenu(m_reactContext, [weakReactHost = m_weakReactHost]() noexcept {
     Microsoft::ReactNative::ShowConfigureBundlerDialog(weakReactHost);
@@ -353,6 +389,7 @@ void ReactInstanceWin::Initialize() noexcept {
 #ifndef CORE_ABI
     // Objects that must be created on the UI thread
     if (auto strongThis = weakThis.GetStrongPtr()) {
+      facebook::react::tracing::StartupTimelineScope scope{strongThis->m_startupTimeline.get(), "InitUIThreadObjects"};
       strongThis->m_appTheme = std::make_shared<Microsoft::ReactNative::AppTheme>(
           strongThis->GetReactContext(), strongThis->m_uiMessageThread.LoadWithLock());
       Microsoft::ReactNative::I18nManager::InitI18nInfo(
@@ -382,8 +419,9 @@ void ReactInstanceWin::Initialize() noexcept {
       devSettings->debuggerRuntimeName = m_options.DeveloperSettings.DebuggerRuntimeName;
       devSettings->useWebDebugger = m_useWebDebugger;
       devSettings->useFastRefresh = m_isFastReloadEnabled;
-      // devSettings->memoryTracker = GetMemoryTracker();
+      devSettings->samplingProfiler = m_samplingProfiler;
       devSettings->bundleRootPath = BundleRootPath();
+      devSettings->useJSBundleCache = m_options.EnableJSBundleCache;
 
       devSettings->waitingForDebuggerCallback = GetWaitingForDebuggerCallback();
       devSettings->debuggerAttachCallback = GetDebuggerAttachCallback();
@@ -416,6 +454,7 @@ void ReactInstanceWin::Initialize() noexcept {
           m_reactContext);
 #endif
 
+      m_startupTimeline->BeginPhase("LoadModules");
       auto nmp = std::make_shared<winrt::Microsoft::ReactNative::NativeModulesProvider>();
 
       LoadModules(nmp, m_options.TurboModuleProvider);
@@ -429,6 +468,9 @@ void ReactInstanceWin::Initialize() noexcept {
             m_options.ModuleProvider->GetModules(m_reactContext, m_jsMessageThread.Load());
         cxxModules.insert(std::end(cxxModules), std::begin(customCxxModules), std::end(customCxxModules));
       }
+      m_startupTimeline->EndPhase("LoadModules");
+
+      m_startupTimeline->BeginPhase("CreateRuntimeHolder");
 
       std::unique_ptr<facebook::jsi::ScriptStore> scriptStore = nullptr;
       std::unique_ptr<facebook::jsi::PreparedScriptStore> preparedScriptStore = nullptr;
@@ -459,18 +501,26 @@ void ReactInstanceWin::Initialize() noexcept {
                 winrt::to_hstring(m_options.ByteCodeFileUri));
           }
 #endif
+          // Only the Chakra runtime reports its allocations. The tracker feeds the JSHeap profiler counter,
+          // and it slows down every JS allocation, so it is only created when its data can be read:
+          // profiling is started from the developer menu, or detailed tracking is turned on.
+          if (UseDeveloperSupport() || ::Microsoft::React::GetRuntimeOptionBool("MemoryTracker.DetailedTracking")) {
+            devSettings->memoryTracker = facebook::react::CreateMemoryTracker(Mso::Copy(m_jsMessageThread.Load()));
+          }
           devSettings->jsiRuntimeHolder = std::make_shared<Microsoft::JSI::ChakraRuntimeHolder>(
               devSettings, m_jsMessageThread.Load(), std::move(scriptStore), std::move(preparedScriptStore));
           break;
       }
 
       m_jsiRuntimeHolder = devSettings->jsiRuntimeHolder;
+      m_startupTimeline->EndPhase("CreateRuntimeHolder");
 
       try {
         // We need to keep the instance wrapper alive as its destruction shuts down the native queue.
         m_options.TurboModuleProvider->SetReactContext(
             winrt::make<implementation::ReactContext>(Mso::Copy(m_reactContext)));
         auto bundleRootPath = devSettings->bundleRootPath;
+        m_startupTimeline->BeginPhase("CreateReactInstance");
         auto instanceWrapper = facebook::react::CreateReactInstance(
             std::shared_ptr<facebook::react::Instance>(strongThis->m_instance.Load()),
             std::move(bundleRootPath), // bundleRootPath
@@ -482,6 +532,7 @@ void ReactInstanceWin::Initialize() noexcept {
             std::move(devSettings));
 
         m_instanceWrapper.Exchange(std::move(instanceWrapper));
+        m_startupTimeline->EndPhase("CreateReactInstance");
 
 #ifdef USE_FABRIC
         // Eagerly init the FabricUI binding
@@ -536,6 +587,7 @@ void ReactInstanceWin::LoadJSBundles() noexcept {
 
   if (m_useWebDebugger || m_isFastReloadEnabled) {
     // Getting bundle from the packager, so do everything async.
+    m_startupTimeline->BeginPhase("LoadJSBundle");
     auto instanceWrapper = m_instanceWrapper.LoadWithLock();
     instanceWrapper->loadBundle(Mso::Copy(JavaScriptBundleFile()));
 
@@ -543,7 +595,9 @@ void ReactInstanceWin::LoadJSBundles() noexcept {
         [weakThis = Mso::WeakPtr{this},
          loadCallbackGuard = Mso::MakeMoveOnCopyWrapper(LoadedCallbackGuard{*this})]() noexcept {
           if (auto strongThis = weakThis.GetStrongPtr()) {
+            strongThis->m_startupTimeline->EndPhase("LoadJSBundle");
             if (strongThis->State() != ReactInstanceState::HasError) {
+              strongThis->InstallJSCallBatchDispatcher();
               strongThis->OnReactInstanceLoaded(Mso::ErrorCode{});
             }
           }
@@ -560,7 +614,13 @@ void ReactInstanceWin::LoadJSBundles() noexcept {
             }
 
             try {
-              instanceWrapper->loadBundleSync(Mso::Copy(strongThis->JavaScriptBundleFile()));
+              {
+                // Loading the bundle includes the prepared script lookup done by the runtime holder.
+                facebook::react::tracing::StartupTimelineScope scope{
+                    strongThis->m_startupTimeline.get(), "LoadJSBundle"};
+                instanceWrapper->loadBundleSync(Mso::Copy(strongThis->JavaScriptBundleFile()));
+              }
+              strongThis->InstallJSCallBatchDispatcher();
               strongThis->OnReactInstanceLoaded(Mso::ErrorCode{});
             } catch (...) {
               strongThis->OnReactInstanceLoaded(Mso::ExceptionErrorProvider().MakeErrorCode(std::current_exception()));
@@ -570,9 +630,31 @@ void ReactInstanceWin::LoadJSBundles() noexcept {
   }
 }
 
+void ReactInstanceWin::InstallJSCallBatchDispatcher() noexcept {
+  // The JSI runtime is not available when we do Web debugging. The JS calls are not batched in that case.
+  std::shared_ptr<facebook::jsi::RuntimeHolderLazyInit> jsiRuntimeHolder;
+  {
+    std::scoped_lock lock{m_mutex};
+    jsiRuntimeHolder = m_jsiRuntimeHolder;
+  }
+
+  auto jsiRuntime = jsiRuntimeHolder ? jsiRuntimeHolder->getRuntime() : nullptr;
+  if (!jsiRuntime) {
+    return;
+  }
+
+  try {
+    m_hasJSCallBatchDispatcher = ::Microsoft::ReactNative::InstallJSCallBatchDispatcher(*jsiRuntime);
+  } catch (...) {
+    // Keep calling the JS functions one by one.
+    m_hasJSCallBatchDispatcher = false;
+  }
+}
+
 void ReactInstanceWin::OnReactInstanceLoaded(const Mso::ErrorCode &errorCode) noexcept {
   bool isLoadedExpected = false;
   if (m_isLoaded.compare_exchange_strong(isLoadedExpected, true)) {
+    m_startupTimeline->EndPhase("InstanceLoad");
     if (!errorCode) {
       m_state = ReactInstanceState::Loaded;
       m_whenLoaded.SetValue();
@@ -837,6 +919,7 @@ void ReactInstanceWin::DrainJSCallQueue() noexcept {
       if (m_state == ReactInstanceState::Loaded && !m_jsCallQueue.empty()) {
         entry = std::move(m_jsCallQueue.front());
         m_jsCallQueue.pop_front();
+        m_jsCallQueueSize.store(m_jsCallQueue.size(), std::memory_order_relaxed);
       } else {
         break;
       }
@@ -854,6 +937,7 @@ void ReactInstanceWin::AbandonJSCallQueue() noexcept {
     std::scoped_lock lock{m_mutex};
     if (m_state == ReactInstanceState::HasError || m_state == ReactInstanceState::Unloaded) {
       jsCallQueue = std::move(m_jsCallQueue);
+      m_jsCallQueueSize.store(0, std::memory_order_relaxed);
     }
   }
 }
@@ -871,6 +955,7 @@ void ReactInstanceWin::CallJsFunction(
         m_state == ReactInstanceState::Loading || m_state == ReactInstanceState::WaitingForDebugger ||
         (m_state == ReactInstanceState::Loaded && !m_jsCallQueue.empty())) {
       m_jsCallQueue.push_back(JSCallEntry{std::move(moduleName), std::move(method), std::move(params)});
+      m_jsCallQueueSize.store(m_jsCallQueue.size(), std::memory_order_relaxed);
     }
     // otherwise ignore the call
   }
@@ -882,6 +967,21 @@ void ReactInstanceWin::CallJsFunction(
   }
 }
 
+void ReactInstanceWin::CallJsFunctions(folly::dynamic &&calls) noexcept {
+  if (m_hasJSCallBatchDispatcher) {
+    CallJsFunction(
+        ::Microsoft::ReactNative::JSCallBatchModuleName,
+        ::Microsoft::ReactNative::JSCallBatchMethodName,
+        folly::dynamic::array(std::move(calls)));
+    return;
+  }
+
+  ::Microsoft::ReactNative::ForEachJSCall(
+      std::move(calls), [this](std::string &&module, std::string &&method, folly::dynamic &&args) noexcept {
+        CallJsFunction(std::move(module), std::move(method), std::move(args));
+      });
+}
+
 void ReactInstanceWin::DispatchEvent(int64_t viewTag, std::string &&eventName, folly::dynamic &&eventData) noexcept {
   folly::dynamic params = folly::dynamic::array(viewTag, std::move(eventName), std::move(eventData));
   CallJsFunction("RCTEventEmitter", "receiveEvent", std::move(params));
@@ -920,6 +1020,28 @@ bool ReactInstanceWin::IsLoaded() const noexcept {
   return m_state == ReactInstanceState::Loaded;
 }
 
+std::shared_ptr<facebook::react::tracing::StartupTimeline> ReactInstanceWin::GetStartupTimeline() const noexcept {
+  return m_startupTimeline;
+}
+
+/*static*/ winrt::Microsoft::ReactNative::ReactPropertyId<
+    winrt::Microsoft::ReactNative::ReactNonAbiValue<std::shared_ptr<facebook::react::tracing::StartupTimeline>>>
+ReactInstanceWin::StartupTimelineProperty() noexcept {
+  static winrt::Microsoft::ReactNative::ReactPropertyId<
+      winrt::Microsoft::ReactNative::ReactNonAbiValue<std::shared_ptr<facebook::react::tracing::StartupTimeline>>>
+      prop{L"ReactNative.ReactInstance", L"StartupTimeline"};
+  return prop;
+}
+
+/*static*/ winrt::Microsoft::ReactNative::ReactPropertyId<
+    winrt::Microsoft::ReactNative::ReactNonAbiValue<std::shared_ptr<facebook::react::tracing::SamplingProfiler>>>
+ReactInstanceWin::SamplingProfilerProperty() noexcept {
+  static winrt::Microsoft::ReactNative::ReactPropertyId<
+      winrt::Microsoft::ReactNative::ReactNonAbiValue<std::shared_ptr<facebook::react::tracing::SamplingProfiler>>>
+      prop{L"ReactNative.ReactInstance", L"SamplingProfiler"};
+  return prop;
+}
+
 void ReactInstanceWin::AttachMeasuredRootView(
     facebook::react::IReactRootView *rootView,
     folly::dynamic &&initialProps,
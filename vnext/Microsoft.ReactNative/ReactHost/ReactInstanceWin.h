@@ -6,9 +6,13 @@
 #include "IReactInstanceInternal.h"
 #include "ReactContext.h"
 #include "ReactNativeHeaders.h"
+#include "ReactPropertyBag.h"
 #include "React_win.h"
 #include "activeObject/activeObject.h"
 
+#include <tracing/SamplingProfiler.h>
+#include <tracing/StartupTimeline.h>
+
 #ifndef CORE_ABI
 #include <Modules/AppThemeModuleUwp.h>
 #include <Modules/AppearanceModule.h>
@@ -63,10 +67,22 @@ class ReactInstanceWin final : public Mso::ActiveObject<IReactInstanceInternal>
 
  public:
   void CallJsFunction(std::string &&moduleName, std::string &&method, folly::dynamic &&params) noexcept;
+  void CallJsFunctions(folly::dynamic &&calls) noexcept;
   void DispatchEvent(int64_t viewTag, std::string &&eventName, folly::dynamic &&eventData) noexcept;
   winrt::Microsoft::ReactNative::JsiRuntime JsiRuntime() noexcept;
   std::shared_ptr<facebook::react::Instance> GetInnerInstance() noexcept;
   bool IsLoaded() const noexcept;
+  std::shared_ptr<facebook::react::tracing::StartupTimeline> GetStartupTimeline() const noexcept;
+
+  //! Property used to publish the instance startup timeline to the instance properties.
+  static winrt::Microsoft::ReactNative::ReactPropertyId<
+      winrt::Microsoft::ReactNative::ReactNonAbiValue<std::shared_ptr<facebook::react::tracing::StartupTimeline>>>
+  StartupTimelineProperty() noexcept;
+
+  //! Property used to publish the instance sampling profiler, so that DevSettings can start and stop it.
+  static winrt::Microsoft::ReactNative::ReactPropertyId<
+      winrt::Microsoft::ReactNative::ReactNonAbiValue<std::shared_ptr<facebook::react::tracing::SamplingProfiler>>>
+  SamplingProfilerProperty() noexcept;
 
   bool UseWebDebugger() const noexcept;
   bool UseFastRefresh() const noexcept;
@@ -119,6 +135,7 @@ class ReactInstanceWin final : public Mso::ActiveObject<IReactInstanceInternal>
   friend struct LoadedCallbackGuard;
   void OnReactInstanceLoaded(const Mso::ErrorCode &errorCode) noexcept;
 
+  void InstallJSCallBatchDispatcher() noexcept;
   void DrainJSCallQueue() noexcept;
   void AbandonJSCallQueue() noexcept;
 
@@ -148,10 +165,18 @@ class ReactInstanceWin final : public Mso::ActiveObject<IReactInstanceInternal>
   const bool m_useWebDebugger : 1;
 
   const Mso::CntPtr<ReactContext> m_reactContext;
+  const std::shared_ptr<facebook::react::tracing::StartupTimeline> m_startupTimeline{
+      std::make_shared<facebook::react::tracing::StartupTimeline>()};
+  const std::shared_ptr<facebook::react::tracing::SamplingProfiler> m_samplingProfiler{
+      std::make_shared<facebook::react::tracing::SamplingProfiler>()};
 
   std::atomic<bool> m_isLoaded{false};
   std::atomic<bool> m_isDestroyed{false};
   std::atomic<bool> m_isRekaInitialized{false};
+  std::atomic<bool> m_isFirstUIBatchCompleted{false};
+  std::atomic<bool> m_hasJSCallBatchDispatcher{false};
+  // Mirrors m_jsCallQueue.size() for the sampling profiler, which must not take m_mutex.
+  std::atomic<size_t> m_jsCallQueueSize{0};
 
  private: // fields controlled by mutex
   mutable std::mutex m_mutex;
@@ -181,6 +206,7 @@ class ReactInstanceWin final : public Mso::ActiveObject<IReactInstanceInternal>
 #endif
   Mso::DispatchQueue m_uiQueue;
   std::deque<JSCallEntry> m_jsCallQueue;
+  facebook::react::tracing::SamplingProfiler::CounterCookie m_jsCallQueueCounterCookie{};
 
   std::shared_ptr<facebook::jsi::RuntimeHolderLazyInit> m_jsiRuntimeHolder;
   winrt::Microsoft::ReactNative::JsiRuntime m_jsiRuntime{nullptr};
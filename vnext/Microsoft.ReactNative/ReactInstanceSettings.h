@@ -96,6 +96,9 @@ struct ReactInstanceSettings : ReactInstanceSettingsT<ReactInstanceSettings> {
   bool EnableByteCodeCaching() noexcept;
   void EnableByteCodeCaching(bool value) noexcept;
 
+  bool EnableJSBundleCache() noexcept;
+  void EnableJSBundleCache(bool value) noexcept;
+
   //! Same as UseDeveloperSupport
   bool EnableDeveloperMenu() noexcept;
   void EnableDeveloperMenu(bool value) noexcept;
@@ -160,6 +163,7 @@ struct ReactInstanceSettings : ReactInstanceSettingsT<ReactInstanceSettings> {
   hstring m_javaScriptBundleFile{};
   bool m_enableJITCompilation{true};
   bool m_enableByteCodeCaching{false};
+  bool m_enableJSBundleCache{false};
   hstring m_byteCodeFileUri{};
   hstring m_debugBundlePath{};
   hstring m_bundleRootPath{};
@@ -228,6 +232,14 @@ inline void ReactInstanceSettings::EnableByteCodeCaching(bool value) noexcept {
   m_enableByteCodeCaching = value;
 }
 
+inline bool ReactInstanceSettings::EnableJSBundleCache() noexcept {
+  return m_enableJSBundleCache;
+}
+
+inline void ReactInstanceSettings::EnableJSBundleCache(bool value) noexcept {
+  m_enableJSBundleCache = value;
+}
+
 inline hstring ReactInstanceSettings::ByteCodeFileUri() noexcept {
   return m_byteCodeFileUri;
 }
@@ -7,6 +7,7 @@
 #include <regex>
 #include "Base/FollyIncludes.h"
 #include "DevServerHelper.h"
+#include "JSValueJson.h"
 #include "RedBoxErrorInfo.h"
 #include "Unicode.h"
 
@@ -262,12 +263,18 @@ struct RedBox : public std::enable_shared_from_this<RedBox> {
 
     if (!plain.empty() && plain[0] == '{') {
       try {
-        auto json = folly::parseJson(plain);
-        if (json.count("type") && json["type"] == "InternalError") {
-          auto message = json["message"].asString();
+        // Messages that are not JSON or miss the message property are displayed as the raw message string.
+        winrt::Microsoft::ReactNative::JSValue json;
+        const bool isJson = winrt::Microsoft::ReactNative::TryParseJson(plain, json);
+        auto type = json["type"].TryGetString();
+        auto name = json["name"].TryGetString();
+        auto jsonMessage = json["message"].TryGetString();
+        auto jsonStack = json["stack"].TryGetString();
+        if (isJson && jsonMessage && type && *type == "InternalError") {
+          const auto &message = *jsonMessage;
           m_errorMessageText.Text(Microsoft::Common::Unicode::Utf8ToUtf16(message));
 
-          if (IsMetroBundlerError(message, json["type"].asString())) {
+          if (IsMetroBundlerError(message, *type)) {
             xaml::Documents::Hyperlink link;
             link.NavigateUri(Uri(MAKE_WIDE_STR(METRO_TROUBLESHOOTING_URL)));
             xaml::Documents::Run linkRun;
@@ -276,18 +283,18 @@ struct RedBox : public std::enable_shared_from_this<RedBox> {
             link.Foreground(xaml::Media::SolidColorBrush(winrt::ColorHelper::FromArgb(0xff, 0xff, 0xff, 0xff)));
             link.Inlines().Append(linkRun);
             xaml::Documents::Run normalRun;
-            normalRun.Text(Microsoft::Common::Unicode::Utf8ToUtf16(json["type"].asString() + (" ─ See ")));
+            normalRun.Text(Microsoft::Common::Unicode::Utf8ToUtf16(*type + (" ─ See ")));
             m_errorStackText.Inlines().Append(normalRun);
             m_errorStackText.Inlines().Append(link);
           } else {
-            m_errorStackText.Text(Microsoft::Common::Unicode::Utf8ToUtf16(json["type"].asString()));
+            m_errorStackText.Text(Microsoft::Common::Unicode::Utf8ToUtf16(*type));
           }
           return;
-        } else if (json.count("name") && boost::ends_with(json["name"].asString(), "Error")) {
-          auto message = std::regex_replace(json["message"].asString(), colorsRegex, "");
-          const auto originalStack = std::regex_replace(json["stack"].asString(), colorsRegex, "");
+        } else if (isJson && jsonMessage && jsonStack && name && boost::ends_with(*name, "Error")) {
+          auto message = std::regex_replace(*jsonMessage, colorsRegex, "");
+          const auto originalStack = std::regex_replace(*jsonStack, colorsRegex, "");
 
-          const auto errorName = json["name"].asString();
+          const auto errorName = *name;
           std::string stack;
 
           const auto prefix = errorName + ": " + message;
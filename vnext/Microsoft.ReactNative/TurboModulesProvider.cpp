@@ -14,6 +14,7 @@
 #include "Crash.h"
 #else
 #include <crash/verifyElseCrash.h>
+#include <tracing/SamplingProfiler.h>
 #endif
 
 using namespace winrt;
@@ -29,6 +30,56 @@ struct TurboModuleMethodInfo {
   MethodDelegate Method;
 };
 
+// A sync method bound to a JSI host function.
+// JS may call sync methods such as feature flag getters very often. To avoid allocating a new reader and writer
+// for each call, they are created once and reused for the calls that are not nested into another call of the method.
+struct TurboModuleSyncMethod {
+  TurboModuleSyncMethod(SyncMethodDelegate const &method, std::string const &moduleName, std::string const &methodName)
+      : Method{method}, ModuleName{moduleName}, MethodName{methodName} {}
+
+  facebook::jsi::Value Call(facebook::jsi::Runtime &runtime, const facebook::jsi::Value *args, size_t count) {
+#ifndef __APPLE__
+    facebook::react::tracing::NativeCallScope scope{ModuleName.c_str(), MethodName.c_str()};
+#endif
+
+    if (m_isInUse) {
+      // The method is called recursively: the reused reader and writer are busy.
+      auto argReader = winrt::make<JsiReader>(runtime, args, count);
+      auto writer = winrt::make<JsiWriter>(runtime);
+      Method(argReader, writer);
+      return writer.as<JsiWriter>()->MoveResult();
+    }
+
+    if (!m_argReader) {
+      m_argReader = winrt::make<JsiReader>(runtime, args, count);
+      m_writer = winrt::make<JsiWriter>(runtime);
+    } else {
+      get_self<JsiReader>(m_argReader)->Reset(args, count);
+      get_self<JsiWriter>(m_writer)->Reset();
+    }
+
+    // If the method throws, then m_isInUse stays set and the next calls use new readers and writers.
+    m_isInUse = true;
+    Method(m_argReader, m_writer);
+    m_isInUse = false;
+
+    // Do not keep any JSI values alive after the call: the host function may be released after the runtime.
+    get_self<JsiReader>(m_argReader)->Reset(nullptr, 0);
+    auto result = get_self<JsiWriter>(m_writer)->MoveResult();
+    get_self<JsiWriter>(m_writer)->Reset();
+    return result;
+  }
+
+  SyncMethodDelegate Method;
+  std::string ModuleName;
+  std::string MethodName;
+
+ private:
+  IJSValueReader m_argReader{nullptr};
+  IJSValueWriter m_writer{nullptr};
+  bool m_isInUse{false};
+};
+
 struct TurboModuleBuilder : winrt::implements<TurboModuleBuilder, IReactModuleBuilder> {
   TurboModuleBuilder(const IReactContext &reactContext) noexcept : m_reactContext(reactContext) {}
 
@@ -109,9 +160,60 @@ class TurboModuleImpl : public facebook::react::TurboModule {
       return m_hostObjectWrapper->get(runtime, propName);
     }
 
-    // it is not safe to assume that "runtime" never changes, so members are not cached here
+    // JS code gets the member function each time it calls a method, so the created functions are cached.
+    // The cache is a JS object that the runtime owns: the host object must not hold jsi::Values, because
+    // the runtime owns the host object and may release it after the values are gone.
+    // It also keeps the members of different runtimes apart.
+    auto memberCache = GetMemberCache(runtime);
+    auto member = memberCache.getProperty(runtime, propName);
+    if (member.isObject()) {
+      return member;
+    }
+
+    member = CreateMember(runtime, propName, propName.utf8(runtime));
+    if (member.isObject()) {
+      memberCache.setProperty(runtime, propName, member);
+    }
+
+    return member;
+  }
+
+  void set(facebook::jsi::Runtime &rt, const facebook::jsi::PropNameID &name, const facebook::jsi::Value &value)
+      override {
+    if (m_hostObjectWrapper) {
+      return m_hostObjectWrapper->set(rt, name, value);
+    }
+
+    facebook::react::TurboModule::set(rt, name, value);
+  }
+
+ private:
+  // Returns the JS object with the created member functions of this module in the runtime.
+  facebook::jsi::Object GetMemberCache(facebook::jsi::Runtime &runtime) {
+    constexpr char MemberCachesPropertyName[] = "__turboModuleMemberCaches";
+    auto global = runtime.global();
+    auto caches = global.getProperty(runtime, MemberCachesPropertyName);
+    if (!caches.isObject()) {
+      caches = facebook::jsi::Object{runtime};
+      global.setProperty(runtime, MemberCachesPropertyName, caches);
+    }
+
+    auto cachesObject = caches.getObject(runtime);
+    auto cache = cachesObject.getProperty(runtime, name_.c_str());
+    if (cache.isObject()) {
+      return cache.getObject(runtime);
+    }
+
+    facebook::jsi::Object newCache{runtime};
+    cachesObject.setProperty(runtime, name_.c_str(), newCache);
+    return newCache;
+  }
+
+  facebook::jsi::Value CreateMember(
+      facebook::jsi::Runtime &runtime,
+      const facebook::jsi::PropNameID &propName,
+      const std::string &key) {
     auto tmb = m_moduleBuilder.as<TurboModuleBuilder>();
-    auto key = propName.utf8(runtime);
 
     if (key == "getConstants" && tmb->m_constantProviders.size() > 0) {
       // try to find getConstants if there is any constant
@@ -143,11 +245,15 @@ class TurboModuleImpl : public facebook::react::TurboModule {
             runtime,
             propName,
             0,
-            [&runtime, method = it->second](
+            [&runtime, method = it->second, moduleName = name_, methodName = key](
                 facebook::jsi::Runtime &rt,
                 const facebook::jsi::Value &thisVal,
                 const facebook::jsi::Value *args,
                 size_t count) {
+#ifndef __APPLE__
+              facebook::react::tracing::NativeCallScope scope{moduleName.c_str(), methodName.c_str()};
+#endif
+
               // prepare input arguments
               size_t serializableArgumentCount = count;
               switch (method.ReturnType) {
@@ -266,22 +372,11 @@ class TurboModuleImpl : public facebook::react::TurboModule {
             runtime,
             propName,
             0,
-            [&runtime, method = it->second](
+            [&runtime, syncMethod = std::make_shared<TurboModuleSyncMethod>(it->second, name_, key)](
                 facebook::jsi::Runtime &rt,
                 const facebook::jsi::Value &thisVal,
                 const facebook::jsi::Value *args,
-                size_t count) {
-              // prepare input arguments
-              auto argReader = winrt::make<JsiReader>(runtime, args, count);
-
-              // prepare output value
-              auto writer = winrt::make<JsiWriter>(runtime);
-
-              // call the function
-              method(argReader, writer);
-
-              return writer.as<JsiWriter>()->MoveResult();
-            });
+                size_t count) { return syncMethod->Call(runtime, args, count); });
       }
     }
 
@@ -289,15 +384,6 @@ class TurboModuleImpl : public facebook::react::TurboModule {
     return facebook::jsi::Value::undefined();
   }
 
-  void set(facebook::jsi::Runtime &rt, const facebook::jsi::PropNameID &name, const facebook::jsi::Value &value)
-      override {
-    if (m_hostObjectWrapper) {
-      return m_hostObjectWrapper->set(rt, name, value);
-    }
-
-    facebook::react::TurboModule::set(rt, name, value);
-  }
-
  private:
   IReactModuleBuilder m_moduleBuilder;
   IInspectable providedModule;
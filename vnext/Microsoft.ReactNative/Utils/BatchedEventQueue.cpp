@@ -0,0 +1,45 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "BatchedEventQueue.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace winrt::Microsoft::ReactNative {
+
+bool BatchedEventQueue::Push(implementation::BatchedEvent &&event) noexcept {
+  std::scoped_lock lock(m_mutex);
+  bool wasEmpty = m_events.empty();
+  m_events.push_back(std::move(event));
+  return wasEmpty;
+}
+
+bool BatchedEventQueue::PushCoalescing(implementation::BatchedEvent &&event) noexcept {
+  std::scoped_lock lock(m_mutex);
+  bool wasEmpty = m_events.empty();
+
+  auto endIter = std::remove_if(m_events.begin(), m_events.end(), [&](const auto &evt) noexcept {
+    return evt.eventEmitterName == event.eventEmitterName && evt.emitterMethod == event.emitterMethod &&
+        evt.eventName == event.eventName && evt.coalescingKey == event.coalescingKey;
+  });
+
+  m_events.erase(endIter, m_events.end());
+  m_events.push_back(std::move(event));
+  return wasEmpty;
+}
+
+std::vector<implementation::BatchedEvent> BatchedEventQueue::TakeFrameEvents(bool &hasMoreEvents) noexcept {
+  std::vector<implementation::BatchedEvent> events;
+
+  std::scoped_lock lock(m_mutex);
+  size_t eventCount = (std::min)(m_events.size(), MaxEventCountPerFrame);
+  events.reserve(eventCount);
+  std::move(m_events.begin(), m_events.begin() + eventCount, std::back_inserter(events));
+  m_events.erase(m_events.begin(), m_events.begin() + eventCount);
+  hasMoreEvents = !m_events.empty();
+  return events;
+}
+
+} // namespace winrt::Microsoft::ReactNative
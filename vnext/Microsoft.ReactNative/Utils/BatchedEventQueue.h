@@ -0,0 +1,48 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <folly/dynamic.h>
+#include <winrt/base.h>
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace winrt::Microsoft::ReactNative::implementation {
+struct BatchedEvent {
+  winrt::hstring eventEmitterName;
+  winrt::hstring emitterMethod;
+  winrt::hstring eventName;
+  int64_t coalescingKey;
+  folly::dynamic params;
+};
+} // namespace winrt::Microsoft::ReactNative::implementation
+
+namespace winrt::Microsoft::ReactNative {
+
+//! The events queued by the BatchingEventEmitter. Events are added on the UI thread and taken on the JS thread.
+//! The frame callback that delivers the events must be registered when the first event is added to the empty queue,
+//! and again when the events taken in a frame leave some events in the queue.
+struct BatchedEventQueue {
+  //! The maximum number of events delivered to JS in one frame. The remaining events stay in the queue for the next
+  //! frames, so that a burst of events does not block the JS thread and the events still can be coalesced.
+  static constexpr size_t MaxEventCountPerFrame = 256;
+
+  //! Adds the event. Returns true if the queue was empty.
+  bool Push(implementation::BatchedEvent &&event) noexcept;
+
+  //! Removes the events with the same emitter, method, event name and coalescing key, and adds the event.
+  //! Returns true if the queue was empty.
+  bool PushCoalescing(implementation::BatchedEvent &&event) noexcept;
+
+  //! Takes the events of one frame in the order they were added. hasMoreEvents is set to true if events are left.
+  std::vector<implementation::BatchedEvent> TakeFrameEvents(bool &hasMoreEvents) noexcept;
+
+ private:
+  std::deque<implementation::BatchedEvent> m_events;
+  std::mutex m_mutex;
+};
+
+} // namespace winrt::Microsoft::ReactNative
@@ -4,6 +4,7 @@
 #include "pch.h"
 #include "BatchingEventEmitter.h"
 #include "DynamicWriter.h"
+#include "JSCallBatch.h"
 #include "JSValueWriter.h"
 
 namespace winrt::Microsoft::ReactNative {
@@ -37,16 +38,7 @@ void BatchingEventEmitter::EmitJSEvent(
 
   implementation::BatchedEvent newEvent{
       std::move(eventEmitterName), std::move(emitterMethod), L"", 0, DynamicWriter::ToDynamic(eventDataWriter)};
-  bool isFirstEventInBatch = false;
-
-  {
-    std::scoped_lock lock(m_eventQueueMutex);
-
-    isFirstEventInBatch = m_eventQueue.size() == 0;
-    m_eventQueue.push_back(std::move(newEvent));
-  }
-
-  if (isFirstEventInBatch) {
+  if (m_eventQueue.Push(std::move(newEvent))) {
     RegisterFrameCallback();
   }
 }
@@ -83,23 +75,7 @@ void BatchingEventEmitter::EmitCoalescingJSEvent(
       std::move(eventName),
       coalescingKey,
       DynamicWriter::ToDynamic(params)};
-  bool isFirstEventInBatch = false;
-
-  {
-    std::scoped_lock lock(m_eventQueueMutex);
-
-    isFirstEventInBatch = m_eventQueue.size() == 0;
-
-    auto endIter = std::remove_if(m_eventQueue.begin(), m_eventQueue.end(), [&](const auto &evt) noexcept {
-      return evt.eventEmitterName == newEvent.eventEmitterName && evt.emitterMethod == newEvent.emitterMethod &&
-          evt.eventName == newEvent.eventName && evt.coalescingKey == newEvent.coalescingKey;
-    });
-
-    m_eventQueue.erase(endIter, m_eventQueue.end());
-    m_eventQueue.push_back(std::move(newEvent));
-  }
-
-  if (isFirstEventInBatch) {
+  if (m_eventQueue.PushCoalescing(std::move(newEvent))) {
     RegisterFrameCallback();
   }
 }
@@ -130,18 +106,33 @@ void BatchingEventEmitter::OnFrameUI() noexcept {
 }
 
 void BatchingEventEmitter::OnFrameJS() noexcept {
-  std::deque<implementation::BatchedEvent> currentBatch;
-
-  {
-    std::scoped_lock lock(m_eventQueueMutex);
-    currentBatch.swap(m_eventQueue);
+  bool hasMoreEvents = false;
+  auto currentBatch = m_eventQueue.TakeFrameEvents(hasMoreEvents);
+
+  if (hasMoreEvents) {
+    // New events do not register the frame callback while the queue is not empty.
+    m_uiDispatcher.Post([weakThis{weak_from_this()}]() noexcept {
+      if (auto strongThis = weakThis.lock()) {
+        if (!strongThis->m_renderingRevoker) {
+          strongThis->RegisterFrameCallback();
+        }
+      }
+    });
   }
 
-  while (!currentBatch.empty()) {
+  if (currentBatch.size() == 1) {
     auto &evt = currentBatch.front();
     m_context->CallJSFunction(
         winrt::to_string(evt.eventEmitterName), winrt::to_string(evt.emitterMethod), std::move(evt.params));
-    currentBatch.pop_front();
+  } else if (!currentBatch.empty()) {
+    // Deliver the whole batch to JS with one call.
+    folly::dynamic calls = folly::dynamic::array;
+    for (auto &evt : currentBatch) {
+      ::Microsoft::ReactNative::AppendJSCall(
+          calls, winrt::to_string(evt.eventEmitterName), winrt::to_string(evt.emitterMethod), std::move(evt.params));
+    }
+
+    m_context->CallJSFunctions(std::move(calls));
   }
 }
 
@@ -3,30 +3,19 @@
 
 #pragma once
 
+#include "BatchedEventQueue.h"
 #include "JSValue.h"
 #include "ReactHost/React.h"
 #include "ReactPropertyBag.h"
 #include "winrt/Microsoft.ReactNative.h"
 
-#include <deque>
-#include <mutex>
-
-namespace winrt::Microsoft::ReactNative::implementation {
-struct BatchedEvent {
-  winrt::hstring eventEmitterName;
-  winrt::hstring emitterMethod;
-  winrt::hstring eventName;
-  int64_t coalescingKey;
-  folly::dynamic params;
-};
-} // namespace winrt::Microsoft::ReactNative::implementation
-
 namespace winrt::Microsoft::ReactNative {
 
 //! Emits events from native to JS in queued batches (at most once per-native frame). Events within a batch may be
 //! coalesced. The batch is finished at the time the JS thread starts to process it. I.e. it is possible for a batch to
 //! last for multiple frames if the JS thread is blocked. This is by-design as it allows our coalescing strategy to
-//! account for long operations on the JS thread.
+//! account for long operations on the JS thread. The events of a batch are delivered to JS with one call, and the
+//! number of events delivered per frame is limited.
 struct BatchingEventEmitter : public std::enable_shared_from_this<BatchingEventEmitter> {
  public:
   BatchingEventEmitter(Mso::CntPtr<const Mso::React::IReactContext> &&context) noexcept;
@@ -55,8 +44,7 @@ struct BatchingEventEmitter : public std::enable_shared_from_this<BatchingEventE
   void OnFrameJS() noexcept;
 
   Mso::CntPtr<const Mso::React::IReactContext> m_context;
-  std::deque<implementation::BatchedEvent> m_eventQueue;
-  std::mutex m_eventQueueMutex;
+  BatchedEventQueue m_eventQueue;
   xaml::Media::CompositionTarget::Rendering_revoker m_renderingRevoker;
   IReactDispatcher m_uiDispatcher;
 };
@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "JSCallBatch.h"
+
+namespace Microsoft::ReactNative {
+
+// Each call goes through the same MessageQueue.__callFunction as an individual call, and the JS-to-native calls
+// made by the handlers are flushed once for the whole batch. An error in one handler does not stop the rest of
+// the batch. The first error is thrown after the batch, so that it goes to the same native error handling as the
+// error of an individual call. The other errors are reported to ErrorUtils, or logged if it is not set up.
+constexpr char JSCallBatchDispatcherScript[] = R"JS((function (global) {
+  var bridge = global.__fbBatchedBridge;
+  if (!bridge || typeof bridge.registerCallableModule !== 'function' ||
+      typeof bridge.__callFunction !== 'function') {
+    return false;
+  }
+  function reportError(e) {
+    var errorUtils = global.ErrorUtils;
+    if (errorUtils && typeof errorUtils.reportError === 'function') {
+      errorUtils.reportError(e);
+    } else if (global.console && typeof global.console.error === 'function') {
+      global.console.error(e);
+    }
+  }
+  bridge.registerCallableModule('RNWBatchedCalls', {
+    callFunctions: function (calls) {
+      var firstError;
+      var hasError = false;
+      for (var i = 0; i + 2 < calls.length; i += 3) {
+        try {
+          bridge.__callFunction(calls[i], calls[i + 1], calls[i + 2]);
+        } catch (e) {
+          if (!hasError) {
+            firstError = e;
+            hasError = true;
+          } else {
+            reportError(e);
+          }
+        }
+      }
+      if (hasError) {
+        throw firstError;
+      }
+    },
+  });
+  return true;
+})(this);
+)JS";
+
+void AppendJSCall(folly::dynamic &calls, std::string &&module, std::string &&method, folly::dynamic &&args) {
+  calls.push_back(std::move(module));
+  calls.push_back(std::move(method));
+  calls.push_back(std::move(args));
+}
+
+void ForEachJSCall(
+    folly::dynamic &&calls,
+    const Mso::FunctorRef<void(std::string &&, std::string &&, folly::dynamic &&) noexcept> &fnCall) noexcept {
+  for (size_t i = 0; i + 2 < calls.size(); i += 3) {
+    fnCall(std::move(calls[i].getString()), std::move(calls[i + 1].getString()), std::move(calls[i + 2]));
+  }
+}
+
+bool InstallJSCallBatchDispatcher(facebook::jsi::Runtime &runtime) {
+  facebook::jsi::Value result = runtime.evaluateJavaScript(
+      std::make_shared<facebook::jsi::StringBuffer>(JSCallBatchDispatcherScript), "RNWBatchedCalls.js");
+  return result.isBool() && result.getBool();
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <folly/dynamic.h>
+#include <functional/functorref.h>
+#include <jsi/jsi.h>
+#include <string>
+
+namespace Microsoft::ReactNative {
+
+// A batch of native-to-JS calls is a flat [module, method, args, ...] array. It is delivered to JS with one call
+// to the RNWBatchedCalls callable module that unpacks it.
+constexpr char JSCallBatchModuleName[] = "RNWBatchedCalls";
+constexpr char JSCallBatchMethodName[] = "callFunctions";
+
+// Adds the call to the batch.
+void AppendJSCall(folly::dynamic &calls, std::string &&module, std::string &&method, folly::dynamic &&args);
+
+// Calls fnCall for each call in the batch in order. It is used when JS has no RNWBatchedCalls module.
+void ForEachJSCall(
+    folly::dynamic &&calls,
+    const Mso::FunctorRef<void(std::string &&, std::string &&, folly::dynamic &&) noexcept> &fnCall) noexcept;
+
+// Registers the RNWBatchedCalls module in the bridge. It must be called after the JS bundle is loaded.
+// Returns false if the runtime has no bridge. The JS errors are thrown as facebook::jsi::JSError.
+bool InstallJSCallBatchDispatcher(facebook::jsi::Runtime &runtime);
+
+} // namespace Microsoft::ReactNative
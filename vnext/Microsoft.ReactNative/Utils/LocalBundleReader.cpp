@@ -4,6 +4,7 @@
 #include "pch.h"
 
 #include <Utils/LocalBundleReader.h>
+#include <winrt/Windows.Storage.FileProperties.h>
 #include <winrt/Windows.Storage.Streams.h>
 #include <winrt/Windows.Storage.h>
 #include "Unicode.h"
@@ -15,20 +16,23 @@
 
 namespace Microsoft::ReactNative {
 
-std::future<std::string> LocalBundleReader::LoadBundleAsync(const std::string &bundleUri) {
+static winrt::Windows::Foundation::IAsyncOperation<winrt::Windows::Storage::StorageFile> GetBundleFileAsync(
+    const std::string &bundleUri) {
   winrt::hstring str(Microsoft::Common::Unicode::Utf8ToUtf16(bundleUri));
 
-  co_await winrt::resume_background();
-
-  winrt::Windows::Storage::StorageFile file{nullptr};
-
   // Supports "ms-appx://" or "ms-appdata://"
   if (bundleUri._Starts_with("ms-app")) {
     winrt::Windows::Foundation::Uri uri(str);
-    file = co_await winrt::Windows::Storage::StorageFile::GetFileFromApplicationUriAsync(uri);
+    co_return co_await winrt::Windows::Storage::StorageFile::GetFileFromApplicationUriAsync(uri);
   } else {
-    file = co_await winrt::Windows::Storage::StorageFile::GetFileFromPathAsync(str);
+    co_return co_await winrt::Windows::Storage::StorageFile::GetFileFromPathAsync(str);
   }
+}
+
+std::future<std::string> LocalBundleReader::LoadBundleAsync(const std::string &bundleUri) {
+  co_await winrt::resume_background();
+
+  auto file = co_await GetBundleFileAsync(bundleUri);
 
   // Read the buffer manually to avoid a Utf8 -> Utf16 -> Utf8 encoding
   // roundtrip.
@@ -52,6 +56,15 @@ std::string LocalBundleReader::LoadBundle(const std::string &bundlePath) {
   return LoadBundleAsync(bundlePath).get();
 }
 
+std::future<std::string> LocalBundleReader::GetBundleVersionAsync(const std::string &bundleUri) {
+  co_await winrt::resume_background();
+
+  auto file = co_await GetBundleFileAsync(bundleUri);
+  auto properties = co_await file.GetBasicPropertiesAsync();
+  co_return std::to_string(properties.DateModified().time_since_epoch().count()) + ':' +
+      std::to_string(properties.Size());
+}
+
 StorageFileBigString::StorageFileBigString(const std::string &path) {
   m_futureBuffer = LocalBundleReader::LoadBundleAsync(path);
 }
@@ -12,6 +12,9 @@ class LocalBundleReader {
  public:
   static std::future<std::string> LoadBundleAsync(const std::string &bundlePath);
   static std::string LoadBundle(const std::string &bundlePath);
+
+  // Gets the last write time and the size of the bundle file. It changes when the bundle is updated.
+  static std::future<std::string> GetBundleVersionAsync(const std::string &bundlePath);
 };
 
 class StorageFileBigString : public facebook::react::JSBigString {
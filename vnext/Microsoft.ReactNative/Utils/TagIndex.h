@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+// Maps React tags to indexes into dense arrays in constant time.
+// React tags are allocated in increasing order and are not reused, so the index is split into pages
+// of consecutive tags. A page is released when all of its tags are removed.
+class TagIndex final {
+ public:
+  static constexpr uint32_t NoIndex = UINT32_MAX;
+
+  // Returns NoIndex if the tag has no index.
+  uint32_t Find(int64_t tag) const noexcept {
+    if (tag < 0) {
+      return NoIndex;
+    }
+
+    size_t pageIndex = static_cast<size_t>(tag >> PageBits);
+    if (pageIndex >= m_pages.size() || !m_pages[pageIndex]) {
+      return NoIndex;
+    }
+
+    return m_pages[pageIndex]->Indexes[static_cast<size_t>(tag) & (PageSize - 1)];
+  }
+
+  // Sets the index of a non-negative tag. NoIndex removes the tag.
+  void Set(int64_t tag, uint32_t index) noexcept {
+    size_t pageIndex = static_cast<size_t>(tag >> PageBits);
+    if (pageIndex >= m_pages.size()) {
+      m_pages.resize(pageIndex + 1);
+    }
+
+    auto &page = m_pages[pageIndex];
+    if (!page) {
+      page = std::make_unique<Page>();
+    }
+
+    uint32_t &pageIndexOfTag = page->Indexes[static_cast<size_t>(tag) & (PageSize - 1)];
+    if (pageIndexOfTag == NoIndex && index != NoIndex) {
+      ++page->Count;
+    } else if (pageIndexOfTag != NoIndex && index == NoIndex) {
+      --page->Count;
+    }
+
+    pageIndexOfTag = index;
+    if (page->Count == 0) {
+      page.reset();
+    }
+  }
+
+ private:
+  static constexpr uint32_t PageBits = 10;
+  static constexpr uint32_t PageSize = 1u << PageBits;
+
+  struct Page {
+    Page() noexcept {
+      Indexes.fill(NoIndex);
+    }
+
+    std::array<uint32_t, PageSize> Indexes;
+    uint32_t Count{0};
+  };
+
+  std::vector<std::unique_ptr<Page>> m_pages;
+};
+
+} // namespace Microsoft::ReactNative
@@ -108,7 +108,7 @@ XamlView ImageViewManager::CreateViewCore(int64_t /*tag*/, const winrt::Microsof
 }
 
 ShadowNode *ImageViewManager::createShadow() const {
-  return new ImageShadowNode();
+  return m_shadowNodePool.Create<ImageShadowNode>();
 }
 
 bool ImageViewManager::UpdateProperty(
@@ -22,7 +22,7 @@ class RawTextViewManager : public ViewManagerBase {
 
   const wchar_t *GetName() const override;
   ShadowNode *createShadow() const override {
-    return new RawTextShadowNode();
+    return m_shadowNodePool.Create<RawTextShadowNode>();
   }
 
   void SetLayoutProps(
@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <Views/PaperShadowNode.h>
+#include <new>
+#include <typeinfo>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+// Recycles the memory of the shadow nodes of one view manager.
+// The pool recycles nodes of the first type it creates. A view manager creates shadow nodes of a single type,
+// so all nodes of a pool have the same size. A released node is destroyed right away to drop its view and state,
+// and its memory is kept for the next node. Only the allocation of the node itself is saved: the next node is
+// constructed from scratch in that memory, so its members, such as the children and the strings, allocate again
+// when they are filled. Virtualized lists that mount and unmount views at a steady rate then skip one allocation
+// per node.
+class ShadowNodePool final {
+ public:
+  static constexpr size_t DefaultCapacity = 128;
+
+  explicit ShadowNodePool(size_t capacity = DefaultCapacity) noexcept : m_capacity{capacity} {
+    m_storage.reserve(capacity);
+  }
+
+  ~ShadowNodePool() noexcept {
+    for (void *storage : m_storage) {
+      ::operator delete(storage);
+    }
+  }
+
+  ShadowNodePool(const ShadowNodePool &) = delete;
+  ShadowNodePool &operator=(const ShadowNodePool &) = delete;
+
+  // Creates a node. A node of another type than the first one is allocated with new and is not recycled.
+  template <typename TShadowNode>
+  TShadowNode *Create() {
+    if (!m_nodeType) {
+      m_nodeType = &typeid(TShadowNode);
+    } else if (*m_nodeType != typeid(TShadowNode)) {
+      return new TShadowNode();
+    }
+
+    void *storage;
+    if (!m_storage.empty()) {
+      storage = m_storage.back();
+      m_storage.pop_back();
+      ++m_hitCount;
+    } else {
+      storage = ::operator new(sizeof(TShadowNode));
+      ++m_missCount;
+    }
+
+    try {
+      return new (storage) TShadowNode();
+    } catch (...) {
+      m_storage.push_back(storage);
+      throw;
+    }
+  }
+
+  // Destroys the node. Nodes of another type than the recycled one are deleted.
+  // A node of the recycled type that was allocated with new has the same size and comes from the same global
+  // allocator, so its memory can be kept as well.
+  void Release(ShadowNode *node) noexcept {
+    if (!m_nodeType || typeid(*node) != *m_nodeType) {
+      delete node;
+      return;
+    }
+
+    void *storage = dynamic_cast<void *>(node);
+    node->~ShadowNode();
+    if (m_storage.size() < m_capacity) {
+      m_storage.push_back(storage);
+    } else {
+      ::operator delete(storage);
+    }
+  }
+
+  void SetCapacity(size_t capacity) noexcept {
+    m_capacity = capacity;
+    while (m_storage.size() > capacity) {
+      ::operator delete(m_storage.back());
+      m_storage.pop_back();
+    }
+
+    m_storage.reserve(capacity);
+  }
+
+  size_t HitCount() const noexcept {
+    return m_hitCount;
+  }
+
+  size_t MissCount() const noexcept {
+    return m_missCount;
+  }
+
+ private:
+  size_t m_capacity;
+  const std::type_info *m_nodeType{nullptr};
+  size_t m_hitCount{0};
+  size_t m_missCount{0};
+  std::vector<void *> m_storage;
+};
+
+} // namespace Microsoft::ReactNative
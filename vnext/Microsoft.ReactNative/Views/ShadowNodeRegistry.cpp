@@ -6,6 +6,7 @@
 #include "Views/ViewManager.h"
 
 #include <glog/logging.h>
+#include <stdexcept>
 
 namespace Microsoft::ReactNative {
 
@@ -16,7 +17,7 @@ void ShadowNodeDeleter::operator()(ShadowNode *node) {
 
 void ShadowNodeRegistry::addRootView(std::unique_ptr<ShadowNode, ShadowNodeDeleter> &&root, int64_t rootViewTag) {
   m_roots.insert(rootViewTag);
-  m_allNodes[rootViewTag] = std::move(root);
+  addNode(std::move(root), rootViewTag);
 }
 
 ShadowNode &ShadowNodeRegistry::getRoot(int64_t rootViewTag) {
@@ -30,20 +31,68 @@ void ShadowNodeRegistry::removeRootView(int64_t rootViewTag) {
 }
 
 void ShadowNodeRegistry::addNode(std::unique_ptr<ShadowNode, ShadowNodeDeleter> &&node, int64_t tag) {
-  m_allNodes[tag] = std::move(node);
+  CHECK(tag >= 0);
+  uint32_t slot = m_slotIndexes.Find(tag);
+  if (slot != TagIndex::NoIndex) {
+    // The new node replaces the node of the tag. The handles of the replaced node become invalid.
+    shadow_ptr replacedNode = std::move(m_slotNodes[slot]);
+    m_slotNodes[slot] = std::move(node);
+    ++m_slotGenerations[slot];
+    return;
+  }
+
+  if (!m_freeSlots.empty()) {
+    slot = m_freeSlots.back();
+    m_freeSlots.pop_back();
+    m_slotNodes[slot] = std::move(node);
+    m_slotTags[slot] = tag;
+  } else {
+    slot = static_cast<uint32_t>(m_slotNodes.size());
+    m_slotNodes.push_back(std::move(node));
+    m_slotTags.push_back(tag);
+    m_slotGenerations.push_back(0);
+  }
+
+  m_slotIndexes.Set(tag, slot);
 }
 
 ShadowNode *ShadowNodeRegistry::findNode(int64_t tag) {
-  auto iter = m_allNodes.find(tag);
-  return (iter != m_allNodes.end()) ? iter->second.get() : nullptr;
+  uint32_t slot = m_slotIndexes.Find(tag);
+  return slot != TagIndex::NoIndex ? m_slotNodes[slot].get() : nullptr;
 }
 
 ShadowNode &ShadowNodeRegistry::getNode(int64_t tag) {
-  return *m_allNodes.at(tag);
+  uint32_t slot = m_slotIndexes.Find(tag);
+  if (slot == TagIndex::NoIndex) {
+    throw std::out_of_range("No shadow node for the tag");
+  }
+
+  return *m_slotNodes[slot];
 }
 
 void ShadowNodeRegistry::removeNode(int64_t tag) {
-  m_allNodes.erase(tag);
+  uint32_t slot = m_slotIndexes.Find(tag);
+  if (slot == TagIndex::NoIndex) {
+    return;
+  }
+
+  // The slot is released before the node is destroyed.
+  shadow_ptr removedNode = std::move(m_slotNodes[slot]);
+  m_slotIndexes.Set(tag, TagIndex::NoIndex);
+  m_slotTags[slot] = -1;
+  ++m_slotGenerations[slot];
+  m_freeSlots.push_back(slot);
+}
+
+ShadowNodeHandle ShadowNodeRegistry::getHandle(int64_t tag) const noexcept {
+  uint32_t slot = m_slotIndexes.Find(tag);
+  return slot != TagIndex::NoIndex ? ShadowNodeHandle{slot, m_slotGenerations[slot]} : ShadowNodeHandle{};
+}
+
+ShadowNode *ShadowNodeRegistry::findNode(ShadowNodeHandle handle) const noexcept {
+  return handle.Slot < m_slotNodes.size() && m_slotGenerations[handle.Slot] == handle.Generation
+      ? m_slotNodes[handle.Slot].get()
+      : nullptr;
 }
 
 void ShadowNodeRegistry::removeAllRootViews(const std::function<void(int64_t rootViewTag)> &fn) {
@@ -68,8 +117,10 @@ ShadowNode *ShadowNodeRegistry::getParentRootShadowNode(int64_t nodeTag) {
 }
 
 void ShadowNodeRegistry::ForAllNodes(const Mso::FunctorRef<void(int64_t, shadow_ptr const &) noexcept> &fnDo) noexcept {
-  for (auto &kvp : m_allNodes) {
-    fnDo(kvp.first, kvp.second);
+  for (size_t slot = 0; slot < m_slotNodes.size(); ++slot) {
+    if (m_slotNodes[slot]) {
+      fnDo(m_slotTags[slot], m_slotNodes[slot]);
+    }
   }
 }
 
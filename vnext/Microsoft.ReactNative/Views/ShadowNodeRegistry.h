@@ -2,9 +2,10 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <Utils/TagIndex.h>
 #include <Views/PaperShadowNode.h>
 #include <functional/functorref.h>
-#include <map>
+#include <unordered_set>
 
 namespace Microsoft::ReactNative {
 
@@ -16,6 +17,15 @@ struct ShadowNodeDeleter {
 
 using shadow_ptr = std::unique_ptr<ShadowNode, ShadowNodeDeleter>;
 
+// Refers to a registered node without a tag lookup. It does not find a node that reuses the slot of a removed node.
+struct ShadowNodeHandle {
+  uint32_t Slot{TagIndex::NoIndex};
+  uint32_t Generation{0};
+};
+
+// The shadow nodes are stored in slots of a structure of arrays. A TagIndex maps a tag to its slot
+// in constant time. The slots of removed nodes are reused, and each reuse increments the slot generation.
+// ForAllNodes visits the nodes in slot order.
 struct ShadowNodeRegistry {
   void addRootView(std::unique_ptr<ShadowNode, ShadowNodeDeleter> &&root, int64_t rootViewTag);
   ShadowNode &getRoot(int64_t rootViewTag);
@@ -26,6 +36,9 @@ struct ShadowNodeRegistry {
   ShadowNode *findNode(int64_t tag);
   void removeNode(int64_t tag);
 
+  ShadowNodeHandle getHandle(int64_t tag) const noexcept;
+  ShadowNode *findNode(ShadowNodeHandle handle) const noexcept;
+
   void removeAllRootViews(const std::function<void(int64_t rootViewTag)> &);
 
   std::unordered_set<int64_t> &getAllRoots();
@@ -36,7 +49,11 @@ struct ShadowNodeRegistry {
 
  private:
   std::unordered_set<int64_t> m_roots;
-  std::map<int64_t, std::unique_ptr<ShadowNode, ShadowNodeDeleter>> m_allNodes;
+  std::vector<shadow_ptr> m_slotNodes;
+  std::vector<int64_t> m_slotTags;
+  std::vector<uint32_t> m_slotGenerations;
+  std::vector<uint32_t> m_freeSlots;
+  TagIndex m_slotIndexes;
 };
 
 } // namespace Microsoft::ReactNative
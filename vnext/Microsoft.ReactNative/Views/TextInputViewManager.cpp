@@ -177,6 +177,11 @@ void TextInputShadowNode::createView(const winrt::Microsoft::ReactNative::JSValu
 }
 
 void TextInputShadowNode::dispatchTextInputChangeEvent(winrt::hstring newText) {
+  // Typed text does not come as a prop update, so the measured size must be invalidated here.
+  if (auto uiManager = GetNativeUIManager(GetViewManager()->GetReactContext()).lock()) {
+    uiManager->DirtyYogaNode(m_tag);
+  }
+
   if (!m_initialUpdateComplete) {
     return;
   }
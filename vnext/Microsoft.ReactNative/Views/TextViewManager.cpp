@@ -146,7 +146,7 @@ class TextShadowNode final : public ShadowNodeBase {
 TextViewManager::TextViewManager(const Mso::React::IReactContext &context) : Super(context) {}
 
 ShadowNode *TextViewManager::createShadow() const {
-  return new TextShadowNode();
+  return m_shadowNodePool.Create<TextShadowNode>();
 }
 
 const wchar_t *TextViewManager::GetName() const {
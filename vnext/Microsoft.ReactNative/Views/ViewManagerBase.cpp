@@ -13,6 +13,7 @@
 
 #include <IReactInstance.h>
 #include <IXamlRootView.h>
+#include <RuntimeOptions.h>
 #include <Modules/PaperUIManagerModule.h>
 #include <ReactPropertyBag.h>
 #include <TestHook.h>
@@ -80,7 +81,17 @@ YGSize DefaultYogaSelfMeasureFunc(
   return desiredSize;
 }
 
-ViewManagerBase::ViewManagerBase(const Mso::React::IReactContext &context) : m_context(&context) {}
+// The "ShadowNodePool.Capacity" runtime option sets how many released shadow nodes each view manager keeps.
+static size_t GetShadowNodePoolCapacity() noexcept {
+  static const size_t s_capacity = []() noexcept {
+    auto capacity = ::Microsoft::React::TryGetRuntimeOptionInt("ShadowNodePool.Capacity");
+    return capacity ? static_cast<size_t>(*capacity > 0 ? *capacity : 0) : ShadowNodePool::DefaultCapacity;
+  }();
+  return s_capacity;
+}
+
+ViewManagerBase::ViewManagerBase(const Mso::React::IReactContext &context)
+    : m_context(&context), m_shadowNodePool{GetShadowNodePoolCapacity()} {}
 
 void ViewManagerBase::GetExportedViewConstants(const winrt::Microsoft::ReactNative::IJSValueWriter &writer) const {}
 
@@ -124,11 +135,11 @@ ShadowNode *ViewManagerBase::createShadow() const {
   // they need special functionality
   //  they should override this function and create their own ShadowNodeBase
   //  sub-class.
-  return new ShadowNodeBase();
+  return m_shadowNodePool.Create<ShadowNodeBase>();
 }
 
 void ViewManagerBase::destroyShadow(ShadowNode *node) const {
-  delete node;
+  m_shadowNodePool.Release(node);
 }
 
 void ViewManagerBase::GetExportedCustomBubblingEventTypeConstants(
@@ -235,9 +246,18 @@ void ViewManagerBase::UpdateProperties(
   //  There isn't actually a yoga node for RawText views, but it will invalidate
   //  the ancestors which
   //  will include the containing Text element. And that's what matters.
-  int64_t tag = GetTag(nodeToUpdate->GetView());
-  if (auto uiManager = GetNativeUIManager(GetReactContext()).lock())
-    uiManager->DirtyYogaNode(tag);
+  // The Yoga style props dirty the Yoga node themselves, and the paint-only props
+  // do not change the measured content, so they keep the cached measurements.
+  // Nodes without a Yoga node are always dirtied, since any of their props may
+  // change the content measured by their ancestor.
+  bool isContentChanged = !RequiresYogaNode() || std::any_of(props.begin(), props.end(), [](const auto &pair) {
+    return !IsYogaStyleProp(pair.first) && !IsPaintOnlyProp(pair.first);
+  });
+  if (isContentChanged) {
+    int64_t tag = GetTag(nodeToUpdate->GetView());
+    if (auto uiManager = GetNativeUIManager(GetReactContext()).lock())
+      uiManager->DirtyYogaNode(tag);
+  }
 
   for (const auto &pair : props) {
     const std::string &propertyName = pair.first;
@@ -362,6 +382,10 @@ bool ViewManagerBase::RequiresYogaNode() const {
   return true;
 }
 
+bool ViewManagerBase::CanCacheMeasurements() const {
+  return true;
+}
+
 bool ViewManagerBase::IsNativeControlWithSelfLayout() const {
   return GetYogaCustomMeasureFunc() != nullptr;
 }
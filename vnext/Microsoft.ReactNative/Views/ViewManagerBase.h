@@ -5,6 +5,7 @@
 
 #include <React.h>
 #include <Shared/ReactWindowsAPI.h>
+#include <Views/ShadowNodePool.h>
 #include <Views/ViewManager.h>
 #include <XamlView.h>
 #include <folly/dynamic.h>
@@ -48,6 +49,11 @@ class REACTWINDOWS_EXPORT ViewManagerBase : public IViewManager {
   ShadowNode *createShadow() const override;
   void destroyShadow(ShadowNode *node) const override;
 
+  // The shadow nodes created from the pool are recycled by destroyShadow.
+  ShadowNodePool &GetShadowNodePool() const noexcept {
+    return m_shadowNodePool;
+  }
+
   void GetConstants(const winrt::Microsoft::ReactNative::IJSValueWriter &writer) const override;
   void GetExportedCustomBubblingEventTypeConstants(
       const winrt::Microsoft::ReactNative::IJSValueWriter &writer) const override;
@@ -75,6 +81,9 @@ class REACTWINDOWS_EXPORT ViewManagerBase : public IViewManager {
       float width,
       float height);
   virtual YGMeasureFunc GetYogaCustomMeasureFunc() const;
+  // Returns false if the measure function depends on state that is not updated through props or
+  // DirtyYogaNode, so that its results must not be reused.
+  virtual bool CanCacheMeasurements() const;
   virtual bool RequiresYogaNode() const;
   bool IsNativeControlWithSelfLayout() const;
 
@@ -101,6 +110,7 @@ class REACTWINDOWS_EXPORT ViewManagerBase : public IViewManager {
 
  protected:
   Mso::CntPtr<const Mso::React::IReactContext> m_context;
+  mutable ShadowNodePool m_shadowNodePool;
 };
 #pragma warning(pop)
 
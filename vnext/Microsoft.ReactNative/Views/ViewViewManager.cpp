@@ -362,7 +362,7 @@ void ViewViewManager::GetExportedCustomDirectEventTypeConstants(
 }
 
 ShadowNode *ViewViewManager::createShadow() const {
-  return new ViewShadowNode();
+  return m_shadowNodePool.Create<ViewShadowNode>();
 }
 
 XamlView ViewViewManager::CreateViewCore(int64_t /*tag*/, const winrt::Microsoft::ReactNative::JSValueObject &) {
@@ -37,7 +37,7 @@ class VirtualTextViewManager : public ViewManagerBase {
 
   const wchar_t *GetName() const override;
   ShadowNode *createShadow() const override {
-    return new VirtualTextShadowNode();
+    return m_shadowNodePool.Create<VirtualTextShadowNode>();
   }
 
   void AddView(const XamlView &parent, const XamlView &child, int64_t index) override;
@@ -19,6 +19,11 @@ namespace facebook {
 namespace jsi {
 struct RuntimeHolderLazyInit;
 }
+namespace react {
+namespace tracing {
+class SamplingProfiler;
+}
+} // namespace react
 } // namespace facebook
 
 namespace facebook {
@@ -51,6 +56,10 @@ struct DevSettings {
   /// Enables the user to set a custom root path for bundle resolution
   std::string bundleRootPath;
 
+  /// Shares the bundles loaded from bundleRootPath with other instances through
+  /// the process wide JSBundleCache.
+  bool useJSBundleCache{false};
+
   /// Enables debugging directly in the JavaScript engine.
   bool useDirectDebugger{false};
 
@@ -83,6 +92,10 @@ struct DevSettings {
   /// Dispatcher for notifications about JS engine memory consumption.
   std::shared_ptr<MemoryTracker> memoryTracker;
 
+  /// Profiler that samples the JS heap usage reported by memoryTracker while it
+  /// is running.
+  std::shared_ptr<tracing::SamplingProfiler> samplingProfiler;
+
   /// A factory and holder of jsi::Runtime instance to be used for this react
   /// instance. This object should in general be used only from the JS engine
   /// thread, unless the specific runtime implementation explicitly guarantees
@@ -0,0 +1,187 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "JSBundleCache.h"
+#include "RuntimeOptions.h"
+
+#include <algorithm>
+#include <iterator>
+#include <optional>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+// Hands out a cached bundle without copying it.
+struct SharedJSBigString final : JSBigString {
+  SharedJSBigString(std::shared_ptr<const JSBigString> bundle) noexcept : m_bundle{std::move(bundle)} {}
+
+  bool isAscii() const override {
+    return m_bundle->isAscii();
+  }
+
+  const char *c_str() const override {
+    return m_bundle->c_str();
+  }
+
+  size_t size() const override {
+    return m_bundle->size();
+  }
+
+ private:
+  const std::shared_ptr<const JSBigString> m_bundle;
+};
+
+} // namespace
+
+/*static*/ JSBundleCache &JSBundleCache::Instance() noexcept {
+  static JSBundleCache s_instance{[]() noexcept {
+    if (Microsoft::React::GetRuntimeOptionBool("JSBundleCache.Disabled")) {
+      return JSBundleCache{0, 0};
+    }
+
+    auto maxEntryCount = Microsoft::React::TryGetRuntimeOptionInt("JSBundleCache.MaxEntryCount");
+    auto maxByteCount = Microsoft::React::TryGetRuntimeOptionInt("JSBundleCache.MaxByteCount");
+    return JSBundleCache{
+        maxEntryCount ? static_cast<size_t>(std::max(*maxEntryCount, 0)) : DefaultMaxEntryCount,
+        maxByteCount ? static_cast<size_t>(std::max(*maxByteCount, 0)) : DefaultMaxByteCount};
+  }()};
+  return s_instance;
+}
+
+JSBundleCache::JSBundleCache(size_t maxEntryCount, size_t maxByteCount) noexcept
+    : m_maxEntryCount{maxEntryCount}, m_maxByteCount{maxByteCount} {}
+
+void JSBundleCache::SetLimits(size_t maxEntryCount, size_t maxByteCount) noexcept {
+  std::scoped_lock lock{m_mutex};
+  m_maxEntryCount = maxEntryCount;
+  m_maxByteCount = maxByteCount;
+  EvictLocked();
+}
+
+std::unique_ptr<const JSBigString>
+JSBundleCache::GetOrLoad(const std::string &key, const std::string &version, const Loader &loader) {
+  return GetOrLoad(key, [&version]() { return version; }, loader);
+}
+
+std::unique_ptr<const JSBigString>
+JSBundleCache::GetOrLoad(const std::string &key, const VersionGetter &getVersion, const Loader &loader) {
+  bool isCached{false};
+  {
+    std::scoped_lock lock{m_mutex};
+    if (m_maxEntryCount == 0) {
+      return loader();
+    }
+
+    isCached = FindLocked(key) != m_entries.end();
+  }
+
+  // The version is only needed to validate a cached bundle or to cache a loaded one.
+  std::optional<std::string> version;
+  if (isCached) {
+    version = getVersion();
+
+    std::scoped_lock lock{m_mutex};
+    auto it = FindLocked(key);
+    if (it != m_entries.end()) {
+      if (it->Version == *version) {
+        m_entries.splice(m_entries.begin(), m_entries, it);
+        return std::make_unique<SharedJSBigString>(it->Bundle);
+      }
+
+      // The bundle was updated since it was cached.
+      EraseLocked(it);
+    }
+  }
+
+  std::shared_ptr<const JSBigString> bundle = loader();
+  if (!bundle) {
+    return nullptr;
+  }
+
+  // The size is read outside of the lock, because lazily loaded bundles finish loading when it is accessed.
+  size_t bundleSize = bundle->size();
+  if (!IsCacheable(bundleSize)) {
+    return std::make_unique<SharedJSBigString>(std::move(bundle));
+  }
+
+  if (!version) {
+    version = getVersion();
+  }
+
+  std::scoped_lock lock{m_mutex};
+  if (bundleSize <= m_maxByteCount && m_maxEntryCount > 0) {
+    // Another instance may have loaded the same bundle in the meantime.
+    auto it = FindLocked(key);
+    if (it != m_entries.end() && it->Version != *version) {
+      EraseLocked(it);
+      it = m_entries.end();
+    }
+
+    if (it == m_entries.end()) {
+      m_entries.push_front(Entry{key, std::move(*version), bundle});
+      m_byteCount += bundleSize;
+      EvictLocked();
+    }
+  }
+
+  return std::make_unique<SharedJSBigString>(std::move(bundle));
+}
+
+bool JSBundleCache::IsCacheable(size_t bundleSize) const noexcept {
+  std::scoped_lock lock{m_mutex};
+  return bundleSize <= m_maxByteCount && m_maxEntryCount > 0;
+}
+
+std::list<JSBundleCache::Entry>::iterator JSBundleCache::FindLocked(const std::string &key) noexcept {
+  return std::find_if(m_entries.begin(), m_entries.end(), [&key](const Entry &entry) { return entry.Key == key; });
+}
+
+void JSBundleCache::EraseLocked(std::list<Entry>::iterator it) noexcept {
+  m_byteCount -= it->Bundle->size();
+  m_entries.erase(it);
+}
+
+bool JSBundleCache::Contains(const std::string &key) const noexcept {
+  std::scoped_lock lock{m_mutex};
+  return std::any_of(m_entries.begin(), m_entries.end(), [&key](const Entry &entry) { return entry.Key == key; });
+}
+
+bool JSBundleCache::Remove(const std::string &key) noexcept {
+  std::scoped_lock lock{m_mutex};
+  auto it = FindLocked(key);
+  if (it == m_entries.end()) {
+    return false;
+  }
+
+  EraseLocked(it);
+  return true;
+}
+
+void JSBundleCache::Clear() noexcept {
+  std::scoped_lock lock{m_mutex};
+  m_entries.clear();
+  m_byteCount = 0;
+}
+
+size_t JSBundleCache::GetEntryCount() const noexcept {
+  std::scoped_lock lock{m_mutex};
+  return m_entries.size();
+}
+
+size_t JSBundleCache::GetByteCount() const noexcept {
+  std::scoped_lock lock{m_mutex};
+  return m_byteCount;
+}
+
+void JSBundleCache::EvictLocked() noexcept {
+  while (!m_entries.empty() && (m_entries.size() > m_maxEntryCount || m_byteCount > m_maxByteCount)) {
+    EraseLocked(std::prev(m_entries.end()));
+  }
+}
+
+} // namespace react
+} // namespace facebook
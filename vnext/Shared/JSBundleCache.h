@@ -0,0 +1,106 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cxxreact/JSBigString.h>
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace facebook {
+namespace react {
+
+/**
+ * @class JSBundleCache
+ *
+ * @brief Keeps loaded JS bundles in memory, so that creating another instance
+ * for the same bundle does not read it again.
+ *
+ * Bundles are cached with a version, such as the last write time and size of
+ * the bundle file. A cached bundle with another version is loaded again. The
+ * version is only queried when a cached bundle must be validated or a loaded
+ * bundle is added to the cache, so a disabled cache never queries it.
+ *
+ * The least recently used bundles are evicted to stay within the entry count
+ * and byte count limits. Bundles larger than the byte count limit are never
+ * cached.
+ */
+class JSBundleCache {
+ public:
+  using Loader = std::function<std::unique_ptr<const JSBigString>()>;
+  using VersionGetter = std::function<std::string()>;
+
+  static constexpr size_t DefaultMaxEntryCount = 2;
+  static constexpr size_t DefaultMaxByteCount = 64 * 1024 * 1024;
+
+  /**
+   * @brief Gets the process wide cache. Its limits are read from the
+   * "JSBundleCache.MaxEntryCount" and "JSBundleCache.MaxByteCount" runtime
+   * options when set. The "JSBundleCache.Disabled" option or a zero
+   * "JSBundleCache.MaxEntryCount" turns it off.
+   *
+   * @remarks Instances only use it when DevSettings::useJSBundleCache is set.
+   */
+  static JSBundleCache &Instance() noexcept;
+
+  explicit JSBundleCache(
+      size_t maxEntryCount = DefaultMaxEntryCount,
+      size_t maxByteCount = DefaultMaxByteCount) noexcept;
+
+  JSBundleCache(const JSBundleCache &) = delete;
+  JSBundleCache &operator=(const JSBundleCache &) = delete;
+
+  /**
+   * @brief Changes the limits and evicts bundles that no longer fit.
+   * Zero entries disables the cache.
+   */
+  void SetLimits(size_t maxEntryCount, size_t maxByteCount) noexcept;
+
+  /**
+   * @brief Gets the bundle cached under the key with the same version, or
+   * calls the loader and caches its result. Exceptions thrown by the loader
+   * or the version getter are propagated.
+   *
+   * @remarks The loader and the version getter run without holding the cache
+   * lock. The version getter is called at most once.
+   */
+  std::unique_ptr<const JSBigString>
+  GetOrLoad(const std::string &key, const VersionGetter &getVersion, const Loader &loader);
+
+  std::unique_ptr<const JSBigString>
+  GetOrLoad(const std::string &key, const std::string &version, const Loader &loader);
+
+  bool Contains(const std::string &key) const noexcept;
+  bool Remove(const std::string &key) noexcept;
+  void Clear() noexcept;
+
+  size_t GetEntryCount() const noexcept;
+  size_t GetByteCount() const noexcept;
+
+ private:
+  struct Entry {
+    std::string Key;
+    std::string Version;
+    std::shared_ptr<const JSBigString> Bundle;
+  };
+
+  bool IsCacheable(size_t bundleSize) const noexcept;
+  std::list<Entry>::iterator FindLocked(const std::string &key) noexcept;
+  void EraseLocked(std::list<Entry>::iterator it) noexcept;
+  void EvictLocked() noexcept;
+
+  mutable std::mutex m_mutex;
+  size_t m_maxEntryCount;
+  size_t m_maxByteCount;
+  size_t m_byteCount{0};
+
+  // Most recently used entries first.
+  std::list<Entry> m_entries;
+};
+
+} // namespace react
+} // namespace facebook
@@ -919,6 +919,10 @@ void ChakraRuntime::setupMemoryTracker() noexcept {
 
           return true;
         });
+
+    JsSetRuntimeBeforeCollectCallback(m_runtime, runtimeArgs().memoryTracker.get(), [](void *callbackState) {
+      static_cast<facebook::react::MemoryTracker *>(callbackState)->OnGarbageCollection();
+    });
   }
 }
 
@@ -4,10 +4,12 @@
 #include "pch.h"
 
 #include <cassert>
+#include <deque>
 #include <limits>
 #include <unordered_map>
 
 #include <MemoryTracker.h>
+#include <tracing/TraceSink.h>
 
 namespace facebook {
 namespace react {
@@ -27,8 +29,40 @@ class MemoryTrackerImpl final : public MemoryTracker {
   void Initialize(size_t initialMemoryUsage) noexcept override;
   void OnAllocation(size_t size) noexcept override;
   void OnDeallocation(size_t size) noexcept override;
+  void SetDetailedTrackingEnabled(bool isEnabled) noexcept override;
+  bool IsDetailedTrackingEnabled() const noexcept override;
+  MemoryAllocationStatistics GetAllocationStatistics() const noexcept override;
+  std::vector<MemoryGarbageCollectionSnapshot> GetGarbageCollectionSnapshots() const noexcept override;
+  CallbackRegistrationCookie AddAllocationRateCallback(
+      size_t threshold,
+      std::chrono::milliseconds minCallbackInterval,
+      MemoryAllocationRateCallback &&callback) noexcept override;
+  void OnGarbageCollection() noexcept override;
 
  private:
+  // The sliding window is split into slots that are reused once they fall out of the window.
+  static constexpr size_t AllocationRateSlotCount = 10;
+  static constexpr std::chrono::steady_clock::duration AllocationRateSlotDuration =
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(MemoryAllocationRateWindow) /
+      AllocationRateSlotCount;
+
+  struct AllocationRateCallbackRecord {
+    const size_t Threshold;
+    const std::chrono::milliseconds MinCallbackInterval;
+    const MemoryAllocationRateCallback Callback;
+    std::chrono::steady_clock::time_point LastNotificationTime;
+  };
+
+  struct AllocationRateSlot {
+    int64_t Index{-1};
+    uint64_t AllocatedBytes{0};
+  };
+
+  void NotifyThresholdCallbacks(std::chrono::steady_clock::time_point currentTime) noexcept;
+  void TrackAllocation(size_t size, std::chrono::steady_clock::time_point currentTime) noexcept;
+  size_t GetAllocationRate(int64_t currentSlotIndex) const noexcept;
+  void OnAllocationRateSlotCompleted(size_t allocationRate, std::chrono::steady_clock::time_point currentTime) noexcept;
+
   struct ThresholdCallbackRecord {
     ThresholdCallbackRecord(
         size_t threshold,
@@ -48,8 +82,33 @@ class MemoryTrackerImpl final : public MemoryTracker {
   CallbackRegistrationCookie m_nextCookie = 0;
   std::unordered_map<CallbackRegistrationCookie, ThresholdCallbackRecord> m_thresholdCallbackRecords;
   std::shared_ptr<MessageQueueThread> m_callbackMessageQueueThread;
+
+  // Detailed tracking state
+  bool m_isDetailedTrackingEnabled = false;
+  std::chrono::steady_clock::time_point m_detailedTrackingStartTime;
+  MemoryAllocationStatistics m_statistics;
+  std::array<AllocationRateSlot, AllocationRateSlotCount> m_allocationRateSlots;
+  std::unordered_map<CallbackRegistrationCookie, AllocationRateCallbackRecord> m_allocationRateCallbackRecords;
+  std::deque<MemoryGarbageCollectionSnapshot> m_garbageCollectionSnapshots;
+  uint64_t m_garbageCollectionCycle = 0;
+  size_t m_lastCycleMemoryUsage = 0;
+  uint64_t m_lastCycleAllocatedBytes = 0;
+  uint64_t m_lastCycleDeallocatedBytes = 0;
 };
 
+namespace {
+
+size_t GetHistogramBucket(size_t size) noexcept {
+  size_t bucket = 0;
+  while (size > 1 && bucket < MemoryAllocationHistogramBucketCount - 1) {
+    size >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+} // namespace
+
 MemoryTrackerImpl::MemoryTrackerImpl(std::shared_ptr<MessageQueueThread> &&callbackMessageQueueThread) noexcept
     : m_callbackMessageQueueThread{std::move(callbackMessageQueueThread)} {}
 
@@ -97,14 +156,20 @@ CallbackRegistrationCookie MemoryTrackerImpl::AddThresholdCallback(
 
 bool MemoryTrackerImpl::RemoveThresholdCallback(CallbackRegistrationCookie cookie) noexcept {
   std::lock_guard<std::recursive_mutex> lockGuard{m_mutex};
-  return m_thresholdCallbackRecords.erase(cookie) == 1;
+  return m_thresholdCallbackRecords.erase(cookie) == 1 || m_allocationRateCallbackRecords.erase(cookie) == 1;
 }
 
 void MemoryTrackerImpl::Initialize(size_t initialMemoryUsage) noexcept {
   std::lock_guard<std::recursive_mutex> lockGuard{m_mutex};
   assert(!m_isInitialized);
+  assert(m_callbackMessageQueueThread);
   m_isInitialized = true;
-  OnAllocation(initialMemoryUsage);
+
+  // The initial usage is the engine's own heap rather than an allocation,
+  // so it is not recorded in the detailed allocation statistics.
+  m_currentMemoryUsage = initialMemoryUsage;
+  m_peakMemoryUsage = initialMemoryUsage;
+  NotifyThresholdCallbacks(std::chrono::steady_clock::now());
 }
 
 void MemoryTrackerImpl::OnAllocation(size_t size) noexcept {
@@ -123,6 +188,14 @@ void MemoryTrackerImpl::OnAllocation(size_t size) noexcept {
 
   std::chrono::steady_clock::time_point currentTime = std::chrono::steady_clock::now();
 
+  if (m_isDetailedTrackingEnabled) {
+    TrackAllocation(size, currentTime);
+  }
+
+  NotifyThresholdCallbacks(currentTime);
+}
+
+void MemoryTrackerImpl::NotifyThresholdCallbacks(std::chrono::steady_clock::time_point currentTime) noexcept {
   for (auto &record : m_thresholdCallbackRecords) {
     if (m_currentMemoryUsage >= record.second.Threshold &&
         currentTime > record.second.LastNotificationTime + record.second.MinCallbackInterval) {
@@ -140,6 +213,137 @@ void MemoryTrackerImpl::OnDeallocation(size_t size) noexcept {
   assert(m_isInitialized);
   assert(size <= m_currentMemoryUsage);
   m_currentMemoryUsage -= size;
+
+  if (m_isDetailedTrackingEnabled) {
+    ++m_statistics.DeallocationCount;
+    m_statistics.DeallocatedBytes += size;
+  }
+}
+
+void MemoryTrackerImpl::SetDetailedTrackingEnabled(bool isEnabled) noexcept {
+  std::lock_guard<std::recursive_mutex> lockGuard{m_mutex};
+  if (isEnabled && !m_isDetailedTrackingEnabled) {
+    m_detailedTrackingStartTime = std::chrono::steady_clock::now();
+    m_statistics = {};
+    m_allocationRateSlots = {};
+    m_garbageCollectionSnapshots.clear();
+    m_lastCycleMemoryUsage = m_currentMemoryUsage;
+    m_lastCycleAllocatedBytes = 0;
+    m_lastCycleDeallocatedBytes = 0;
+  }
+
+  m_isDetailedTrackingEnabled = isEnabled;
+}
+
+bool MemoryTrackerImpl::IsDetailedTrackingEnabled() const noexcept {
+  std::lock_guard<std::recursive_mutex> lockGuard{m_mutex};
+  return m_isDetailedTrackingEnabled;
+}
+
+MemoryAllocationStatistics MemoryTrackerImpl::GetAllocationStatistics() const noexcept {
+  std::lock_guard<std::recursive_mutex> lockGuard{m_mutex};
+  MemoryAllocationStatistics statistics = m_statistics;
+  if (m_isDetailedTrackingEnabled) {
+    statistics.AllocationRate = GetAllocationRate(
+        (std::chrono::steady_clock::now() - m_detailedTrackingStartTime) / AllocationRateSlotDuration);
+  }
+  return statistics;
+}
+
+std::vector<MemoryGarbageCollectionSnapshot> MemoryTrackerImpl::GetGarbageCollectionSnapshots() const noexcept {
+  std::lock_guard<std::recursive_mutex> lockGuard{m_mutex};
+  return {m_garbageCollectionSnapshots.begin(), m_garbageCollectionSnapshots.end()};
+}
+
+CallbackRegistrationCookie MemoryTrackerImpl::AddAllocationRateCallback(
+    size_t threshold,
+    std::chrono::milliseconds minCallbackInterval,
+    MemoryAllocationRateCallback &&callback) noexcept {
+  std::lock_guard<std::recursive_mutex> lockGuard{m_mutex};
+  assert(m_nextCookie < std::numeric_limits<decltype(m_nextCookie)>::max());
+  CallbackRegistrationCookie cookie = m_nextCookie++;
+  m_allocationRateCallbackRecords.emplace(
+      cookie, AllocationRateCallbackRecord{threshold, minCallbackInterval, std::move(callback), {}});
+  return cookie;
+}
+
+void MemoryTrackerImpl::OnGarbageCollection() noexcept {
+  std::lock_guard<std::recursive_mutex> lockGuard{m_mutex};
+  if (!m_isDetailedTrackingEnabled) {
+    return;
+  }
+
+  MemoryGarbageCollectionSnapshot snapshot;
+  snapshot.Cycle = ++m_garbageCollectionCycle;
+  snapshot.Time = std::chrono::steady_clock::now();
+  snapshot.MemoryUsage = m_currentMemoryUsage;
+  snapshot.AllocatedBytesSinceLastCycle = m_statistics.AllocatedBytes - m_lastCycleAllocatedBytes;
+  snapshot.DeallocatedBytesSinceLastCycle = m_statistics.DeallocatedBytes - m_lastCycleDeallocatedBytes;
+  snapshot.MemoryUsageDelta =
+      static_cast<int64_t>(m_currentMemoryUsage) - static_cast<int64_t>(m_lastCycleMemoryUsage);
+
+  m_lastCycleMemoryUsage = m_currentMemoryUsage;
+  m_lastCycleAllocatedBytes = m_statistics.AllocatedBytes;
+  m_lastCycleDeallocatedBytes = m_statistics.DeallocatedBytes;
+
+  tracing::WriteTraceEvent(tracing::TraceEventType::Instant, "JSHeap.GarbageCollection", snapshot.Cycle);
+  tracing::WriteTraceEvent(
+      tracing::TraceEventType::Counter, "JSHeap.MemoryUsage", 0, static_cast<int64_t>(snapshot.MemoryUsage));
+  tracing::WriteTraceEvent(
+      tracing::TraceEventType::Counter,
+      "JSHeap.AllocatedSinceLastGC",
+      0,
+      static_cast<int64_t>(snapshot.AllocatedBytesSinceLastCycle));
+
+  if (m_garbageCollectionSnapshots.size() == MemoryGarbageCollectionSnapshotCapacity) {
+    m_garbageCollectionSnapshots.pop_front();
+  }
+  m_garbageCollectionSnapshots.push_back(snapshot);
+}
+
+void MemoryTrackerImpl::TrackAllocation(size_t size, std::chrono::steady_clock::time_point currentTime) noexcept {
+  ++m_statistics.AllocationSizeHistogram[GetHistogramBucket(size)];
+  ++m_statistics.AllocationCount;
+  m_statistics.AllocatedBytes += size;
+
+  int64_t slotIndex = (currentTime - m_detailedTrackingStartTime) / AllocationRateSlotDuration;
+  auto &slot = m_allocationRateSlots[slotIndex % AllocationRateSlotCount];
+  if (slot.Index != slotIndex) {
+    // The previous slot is complete: report the rate before the new slot starts to fill up.
+    OnAllocationRateSlotCompleted(GetAllocationRate(slotIndex), currentTime);
+    slot.Index = slotIndex;
+    slot.AllocatedBytes = 0;
+  }
+  slot.AllocatedBytes += size;
+}
+
+size_t MemoryTrackerImpl::GetAllocationRate(int64_t currentSlotIndex) const noexcept {
+  uint64_t allocatedBytes = 0;
+  for (const auto &slot : m_allocationRateSlots) {
+    if (slot.Index >= 0 && slot.Index > currentSlotIndex - static_cast<int64_t>(AllocationRateSlotCount)) {
+      allocatedBytes += slot.AllocatedBytes;
+    }
+  }
+  return static_cast<size_t>(allocatedBytes * 1000 / MemoryAllocationRateWindow.count());
+}
+
+void MemoryTrackerImpl::OnAllocationRateSlotCompleted(
+    size_t allocationRate,
+    std::chrono::steady_clock::time_point currentTime) noexcept {
+  tracing::WriteTraceEvent(
+      tracing::TraceEventType::Counter, "JSHeap.AllocationRate", 0, static_cast<int64_t>(allocationRate));
+
+  MemoryAllocationStatistics statistics = m_statistics;
+  statistics.AllocationRate = allocationRate;
+
+  for (auto &record : m_allocationRateCallbackRecords) {
+    if (allocationRate >= record.second.Threshold &&
+        currentTime > record.second.LastNotificationTime + record.second.MinCallbackInterval) {
+      m_callbackMessageQueueThread->runOnQueue(
+          [callback = record.second.Callback, statistics] { callback(statistics); });
+      record.second.LastNotificationTime = currentTime;
+    }
+  }
 }
 
 MemoryTrackerImpl::ThresholdCallbackRecord::ThresholdCallbackRecord(
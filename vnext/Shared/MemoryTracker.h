@@ -3,8 +3,11 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <functional>
+#include <vector>
 
 #include <cxxreact/MessageQueueThread.h>
 
@@ -23,6 +26,61 @@ using MemoryThresholdCallback = std::function<void(size_t currentlyUsedMemory)>;
  */
 using CallbackRegistrationCookie = size_t;
 
+/**
+ * @brief Number of buckets of the allocation size histogram. Bucket i counts
+ * allocations of [2^i, 2^(i+1)) bytes, the last bucket also counts all larger
+ * allocations.
+ */
+constexpr size_t MemoryAllocationHistogramBucketCount = 32;
+
+/**
+ * @brief Allocation statistics collected while detailed tracking is enabled,
+ * @see MemoryTracker::SetDetailedTrackingEnabled.
+ */
+struct MemoryAllocationStatistics {
+  std::array<uint64_t, MemoryAllocationHistogramBucketCount> AllocationSizeHistogram{};
+  uint64_t AllocationCount{0};
+  uint64_t AllocatedBytes{0};
+  uint64_t DeallocationCount{0};
+  uint64_t DeallocatedBytes{0};
+
+  // Number of bytes allocated per second over the sliding window, @see MemoryAllocationRateWindow.
+  size_t AllocationRate{0};
+};
+
+/**
+ * @brief Memory usage recorded when the JS engine starts a garbage collection.
+ */
+struct MemoryGarbageCollectionSnapshot {
+  uint64_t Cycle{0};
+  std::chrono::steady_clock::time_point Time;
+  size_t MemoryUsage{0};
+  uint64_t AllocatedBytesSinceLastCycle{0};
+  uint64_t DeallocatedBytesSinceLastCycle{0};
+
+  // Change of the memory usage since the previous cycle. A usage that keeps
+  // growing across many cycles points to a leak, while a large amount of
+  // bytes allocated and freed between cycles points to transient churn.
+  int64_t MemoryUsageDelta{0};
+};
+
+/**
+ * @brief Length of the sliding window over which the allocation rate is
+ * computed.
+ */
+constexpr std::chrono::milliseconds MemoryAllocationRateWindow{1000};
+
+/**
+ * @brief Number of garbage collection snapshots kept by the memory tracker.
+ */
+constexpr size_t MemoryGarbageCollectionSnapshotCapacity = 64;
+
+/**
+ * @brief Type of allocation rate event handlers, @see
+ * MemoryTracker::AddAllocationRateCallback
+ */
+using MemoryAllocationRateCallback = std::function<void(const MemoryAllocationStatistics &statistics)>;
+
 /**
  * @class MemoryTracker
  *
@@ -90,6 +148,47 @@ class MemoryTracker {
    */
   virtual bool RemoveThresholdCallback(CallbackRegistrationCookie cookie) noexcept = 0;
 
+  /**
+   * @brief Enables or disables detailed tracking, which collects allocation
+   * size histograms, the allocation rate and garbage collection snapshots.
+   * It is disabled by default because it adds work to every allocation.
+   *
+   * While it is enabled, the allocation rate and garbage collection snapshots
+   * are also written to the trace sink, @see tracing::SetTraceSink.
+   */
+  virtual void SetDetailedTrackingEnabled(bool isEnabled) noexcept = 0;
+
+  virtual bool IsDetailedTrackingEnabled() const noexcept = 0;
+
+  /**
+   * @brief Gets the statistics collected since detailed tracking was enabled.
+   */
+  virtual MemoryAllocationStatistics GetAllocationStatistics() const noexcept = 0;
+
+  /**
+   * @brief Gets the most recent garbage collection snapshots, oldest first.
+   */
+  virtual std::vector<MemoryGarbageCollectionSnapshot> GetGarbageCollectionSnapshots() const noexcept = 0;
+
+  /**
+   * @brief Adds an allocation rate callback.
+   *
+   * The callback is invoked when a) detailed tracking is enabled, b) the JS
+   * engine allocates memory faster than the specified rate and c) the
+   * specified amount of time has passed since the last callback invocation.
+   *
+   * @param threshold Allocation rate threshold (number of bytes per second).
+   * @param minCallbackInterval Minimal time that needs to pass between callback
+   * invocations.
+   *
+   * @returns Identifier that can be used to remove the callback via @see
+   * RemoveThresholdCallback.
+   */
+  virtual CallbackRegistrationCookie AddAllocationRateCallback(
+      size_t threshold,
+      std::chrono::milliseconds minCallbackInterval,
+      MemoryAllocationRateCallback &&callback) noexcept = 0;
+
   /**
    * @brief Initializes memory tracking.
    *
@@ -120,6 +219,14 @@ class MemoryTracker {
    * ReactNative users.
    */
   virtual void OnDeallocation(size_t size) noexcept = 0;
+
+  /**
+   * @brief Tracks the start of a garbage collection by the JS engine.
+   *
+   * @remarks This a ReactNative internal method and not meant be called by
+   * ReactNative users.
+   */
+  virtual void OnGarbageCollection() noexcept = 0;
 };
 
 /**
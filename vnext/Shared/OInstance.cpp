@@ -37,6 +37,7 @@
 #include <DevSettings.h>
 #include <DevSupportManager.h>
 #include <IReactRootView.h>
+#include <JSBundleCache.h>
 #include <RuntimeOptions.h>
 #include <Shlwapi.h>
 #include <WebSocketJSExecutorFactory.h>
@@ -53,6 +54,8 @@
 #include <ReactCommon/TurboModuleBinding.h>
 #include "ChakraRuntimeHolder.h"
 
+#include <tracing/SamplingProfiler.h>
+#include <tracing/TraceSink.h>
 #include <tracing/tracing.h>
 namespace fs = std::filesystem;
 
@@ -180,6 +183,11 @@ class OJSIExecutorFactory : public JSExecutorFactory {
         [isProfiling = isProfilingEnabled_]([[maybe_unused]] jsi::Runtime &runtime) {
 #ifdef ENABLE_JS_SYSTRACE_TO_ETW
           facebook::react::tracing::initializeJSHooks(runtime, isProfiling);
+#else
+          // The JS trace hooks also feed the in-memory trace sink when one is set.
+          if (facebook::react::tracing::GetTraceSink()) {
+            facebook::react::tracing::initializeJSHooks(runtime, isProfiling);
+          }
 #endif
         });
   }
@@ -297,6 +305,25 @@ InstanceImpl::InstanceImpl(
   facebook::react::tracing::initializeETW();
 #endif
 
+  if (Microsoft::React::GetRuntimeOptionBool("Tracing.RingBufferSink") && !facebook::react::tracing::GetTraceSink()) {
+    auto capacity = Microsoft::React::GetRuntimeOptionInt("Tracing.RingBufferSinkCapacity");
+    facebook::react::tracing::SetTraceSink(std::make_shared<facebook::react::tracing::RingBufferTraceSink>(
+        capacity > 0 ? static_cast<size_t>(capacity)
+                     : facebook::react::tracing::RingBufferTraceSink::DefaultCapacityPerThread));
+  }
+
+  if (m_devSettings->memoryTracker && Microsoft::React::GetRuntimeOptionBool("MemoryTracker.DetailedTracking")) {
+    m_devSettings->memoryTracker->SetDetailedTrackingEnabled(true);
+  }
+
+  if (m_devSettings->samplingProfiler && m_devSettings->memoryTracker) {
+    m_jsHeapCounterCookie = m_devSettings->samplingProfiler->AddCounter(
+        "JSHeap.CurrentUsage", [weakMemoryTracker = std::weak_ptr<MemoryTracker>(m_devSettings->memoryTracker)]() {
+          auto memoryTracker = weakMemoryTracker.lock();
+          return memoryTracker ? static_cast<int64_t>(memoryTracker->GetCurrentMemoryUsage()) : 0;
+        });
+  }
+
   if (m_devSettings->useDirectDebugger && !m_devSettings->useWebDebugger) {
     m_devManager->StartInspector(m_devSettings->sourceBundleHost, m_devSettings->sourceBundlePort);
   }
@@ -484,7 +511,19 @@ void InstanceImpl::loadBundleInternal(std::string &&jsBundleRelativePath, bool s
 #else
       std::string bundlePath = (fs::path(m_devSettings->bundleRootPath) / (jsBundleRelativePath + ".bundle")).string();
 
-      auto bundleString = std::make_unique<::Microsoft::ReactNative::StorageFileBigString>(bundlePath);
+      std::unique_ptr<const JSBigString> bundleString;
+      if (m_devSettings->useJSBundleCache) {
+        // Other instances using the same bundle get it from the cache instead of the package storage.
+        // The cached bundle is loaded again when the bundle file was updated.
+        bundleString = JSBundleCache::Instance().GetOrLoad(
+            bundlePath,
+            [&bundlePath]() {
+              return ::Microsoft::ReactNative::LocalBundleReader::GetBundleVersionAsync(bundlePath).get();
+            },
+            [&bundlePath]() { return std::make_unique<::Microsoft::ReactNative::StorageFileBigString>(bundlePath); });
+      } else {
+        bundleString = std::make_unique<::Microsoft::ReactNative::StorageFileBigString>(bundlePath);
+      }
       m_innerInstance->loadScriptFromString(std::move(bundleString), jsBundleRelativePath, synchronously);
 #endif
     }
@@ -504,6 +543,9 @@ void InstanceImpl::loadBundleInternal(std::string &&jsBundleRelativePath, bool s
 }
 
 InstanceImpl::~InstanceImpl() {
+  if (m_jsHeapCounterCookie) {
+    m_devSettings->samplingProfiler->RemoveCounter(*m_jsHeapCounterCookie);
+  }
   m_devManager->StopInspector();
   m_nativeQueue->quitSynchronous();
 }
@@ -6,11 +6,13 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include <TurboModuleManager.h>
 #include <cxxreact/Instance.h>
+#include <tracing/SamplingProfiler.h>
 #include "InstanceManager.h"
 
 namespace facebook {
@@ -103,6 +105,7 @@ class InstanceImpl final : public InstanceWrapper, private ::std::enable_shared_
 
   std::shared_ptr<IDevSupportManager> m_devManager;
   std::shared_ptr<DevSettings> m_devSettings;
+  std::optional<tracing::SamplingProfiler::CounterCookie> m_jsHeapCounterCookie;
   bool m_isInError{false};
 };
 
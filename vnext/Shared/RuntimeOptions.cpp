@@ -42,4 +42,13 @@ const int32_t __cdecl GetRuntimeOptionInt(const string &name) noexcept {
   return 0;
 }
 
+std::optional<int32_t> __cdecl TryGetRuntimeOptionInt(const string &name) noexcept {
+  lock_guard<mutex> guard{g_runtimeOptionsMutex};
+  auto itr = g_runtimeOptions.find(name);
+  if (itr != g_runtimeOptions.end())
+    return itr->second;
+
+  return std::nullopt;
+}
+
 } // namespace Microsoft::React
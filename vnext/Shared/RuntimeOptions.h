@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <optional>
 #include <string>
 
 namespace Microsoft::React {
@@ -33,4 +34,11 @@ const bool __cdecl GetRuntimeOptionBool(const std::string &name) noexcept;
 /// <returns>Value stored for the given key, or 0 if the entry doesn't exist (default)</returns>
 const std::int32_t __cdecl GetRuntimeOptionInt(const std::string &name) noexcept;
 
+/// <summary>
+/// Retrieves a global signed integer value for the given key, if it is set.
+/// </summary>
+/// <param name="name">Global key</param>
+/// <returns>Value stored for the given key, or std::nullopt if the entry doesn't exist</returns>
+std::optional<std::int32_t> __cdecl TryGetRuntimeOptionInt(const std::string &name) noexcept;
+
 } // namespace Microsoft::React
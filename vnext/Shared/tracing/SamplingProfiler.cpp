@@ -0,0 +1,222 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "tracing/SamplingProfiler.h"
+#include "tracing/TraceJson.h"
+#include "tracing/TraceSink.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace facebook {
+namespace react {
+namespace tracing {
+
+namespace {
+
+std::atomic<int> s_runningProfilerCount{0};
+
+struct ActiveNativeCall {
+  const NativeCallScope *Scope;
+  const char *ModuleName;
+  const char *MethodName;
+};
+
+std::mutex &ActiveNativeCallsMutex() noexcept {
+  static std::mutex s_mutex;
+  return s_mutex;
+}
+
+std::vector<ActiveNativeCall> &ActiveNativeCalls() noexcept {
+  static std::vector<ActiveNativeCall> s_calls;
+  return s_calls;
+}
+
+} // namespace
+
+//=============================================================================================
+// NativeCallScope implementation
+//=============================================================================================
+
+NativeCallScope::NativeCallScope(const char *moduleName, const char *methodName) noexcept {
+  if (SamplingProfiler::IsNativeCallTrackingEnabled()) {
+    std::scoped_lock lock{ActiveNativeCallsMutex()};
+    ActiveNativeCalls().push_back(ActiveNativeCall{this, moduleName, methodName});
+    m_isTracked = true;
+  }
+}
+
+NativeCallScope::~NativeCallScope() noexcept {
+  if (m_isTracked) {
+    std::scoped_lock lock{ActiveNativeCallsMutex()};
+    auto &calls = ActiveNativeCalls();
+    auto it = std::find_if(calls.begin(), calls.end(), [this](const ActiveNativeCall &call) noexcept {
+      return call.Scope == this;
+    });
+    if (it != calls.end()) {
+      calls.erase(it);
+    }
+  }
+}
+
+//=============================================================================================
+// SamplingProfiler implementation
+//=============================================================================================
+
+SamplingProfiler::SamplingProfiler(std::chrono::milliseconds interval, size_t capacity) noexcept
+    : m_interval{interval}, m_capacity{std::max<size_t>(capacity, 1)}, m_origin{Clock::now()} {}
+
+SamplingProfiler::~SamplingProfiler() noexcept {
+  Stop();
+}
+
+SamplingProfiler::CounterCookie SamplingProfiler::AddCounter(std::string name, CounterCallback &&callback) noexcept {
+  std::scoped_lock lock{m_countersMutex};
+  CounterCookie cookie = m_nextCookie++;
+  m_counters.emplace(cookie, std::make_pair(std::move(name), std::move(callback)));
+  return cookie;
+}
+
+bool SamplingProfiler::RemoveCounter(CounterCookie cookie) noexcept {
+  std::scoped_lock lock{m_countersMutex};
+  return m_counters.erase(cookie) == 1;
+}
+
+void SamplingProfiler::Start() noexcept {
+  std::scoped_lock lock{m_mutex};
+  if (m_thread.joinable()) {
+    return;
+  }
+
+  m_isStopRequested = false;
+  ++s_runningProfilerCount;
+  m_thread = std::thread([this]() noexcept { Run(); });
+}
+
+void SamplingProfiler::Stop() noexcept {
+  std::thread thread;
+  {
+    std::scoped_lock lock{m_mutex};
+    if (!m_thread.joinable()) {
+      return;
+    }
+
+    m_isStopRequested = true;
+    thread = std::move(m_thread);
+  }
+
+  m_stopCondition.notify_all();
+  thread.join();
+  --s_runningProfilerCount;
+}
+
+bool SamplingProfiler::IsRunning() const noexcept {
+  std::scoped_lock lock{m_mutex};
+  return m_thread.joinable();
+}
+
+void SamplingProfiler::Run() noexcept {
+  std::unique_lock lock{m_mutex};
+  while (!m_isStopRequested) {
+    lock.unlock();
+    SampleNow();
+    lock.lock();
+    m_stopCondition.wait_for(lock, m_interval, [this]() noexcept { return m_isStopRequested; });
+  }
+}
+
+void SamplingProfiler::SampleNow() noexcept {
+  Sample sample;
+  sample.Timestamp = Clock::now() - m_origin;
+
+  {
+    std::scoped_lock lock{m_countersMutex};
+    sample.Counters.reserve(m_counters.size());
+    for (const auto &entry : m_counters) {
+      const auto &[name, callback] = entry.second;
+      int64_t value = callback();
+      sample.Counters.emplace_back(name, value);
+      WriteTraceEvent(TraceEventType::Counter, name, 0, value);
+    }
+  }
+
+  {
+    std::scoped_lock lock{ActiveNativeCallsMutex()};
+    for (const auto &call : ActiveNativeCalls()) {
+      sample.NativeCalls.push_back(NativeCall{call.ModuleName, call.MethodName});
+    }
+  }
+
+  std::scoped_lock lock{m_mutex};
+  if (m_samples.size() == m_capacity) {
+    m_samples.pop_front();
+  }
+  m_samples.push_back(std::move(sample));
+}
+
+std::vector<SamplingProfiler::Sample> SamplingProfiler::GetSamples() const noexcept {
+  std::scoped_lock lock{m_mutex};
+  return {m_samples.begin(), m_samples.end()};
+}
+
+void SamplingProfiler::Clear() noexcept {
+  std::scoped_lock lock{m_mutex};
+  m_samples.clear();
+}
+
+std::string SamplingProfiler::ToCollapsedStacks() const noexcept {
+  std::map<std::string, size_t> stackCounts;
+  for (const auto &sample : GetSamples()) {
+    if (sample.NativeCalls.empty()) {
+      ++stackCounts["Idle"];
+    }
+
+    for (const auto &call : sample.NativeCalls) {
+      ++stackCounts["NativeModules;" + call.ModuleName + ";" + call.MethodName];
+    }
+  }
+
+  std::string result;
+  for (const auto &entry : stackCounts) {
+    result += entry.first;
+    result += ' ';
+    result += std::to_string(entry.second);
+    result += '\n';
+  }
+
+  return result;
+}
+
+std::string SamplingProfiler::ToChromeTraceJson() const noexcept {
+  std::string json = "{\"traceEvents\":[";
+  bool isFirst = true;
+  for (const auto &sample : GetSamples()) {
+    for (const auto &counter : sample.Counters) {
+      if (!isFirst) {
+        json += ',';
+      }
+      isFirst = false;
+
+      json += "{\"name\":";
+      AppendJsonString(json, counter.first);
+      json += ",\"cat\":\"sampling\",\"ph\":\"C\",\"ts\":";
+      AppendJsonMicroseconds(json, sample.Timestamp);
+      json += ",\"pid\":0,\"args\":{\"value\":";
+      json += std::to_string(counter.second);
+      json += "}}";
+    }
+  }
+  json += "],\"displayTimeUnit\":\"ms\"}";
+
+  return json;
+}
+
+/*static*/ bool SamplingProfiler::IsNativeCallTrackingEnabled() noexcept {
+  return s_runningProfilerCount.load(std::memory_order_relaxed) > 0;
+}
+
+} // namespace tracing
+} // namespace react
+} // namespace facebook
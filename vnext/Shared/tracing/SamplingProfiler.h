@@ -0,0 +1,153 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace facebook {
+namespace react {
+namespace tracing {
+
+/**
+ * @brief Marks a native module method call as in flight for the duration of
+ * the scope, so that it shows up in SamplingProfiler samples. It does nothing
+ * unless a profiler is running.
+ *
+ * @remarks The names must stay valid until the scope ends.
+ */
+class NativeCallScope {
+ public:
+  NativeCallScope(const char *moduleName, const char *methodName) noexcept;
+  ~NativeCallScope() noexcept;
+
+  NativeCallScope(const NativeCallScope &) = delete;
+  NativeCallScope &operator=(const NativeCallScope &) = delete;
+
+ private:
+  bool m_isTracked{false};
+};
+
+/**
+ * @class SamplingProfiler
+ *
+ * @brief Periodically samples registered counters, such as queue lengths and
+ * JS heap usage, together with the native module calls that are in flight.
+ *
+ * Samples are kept in a bounded buffer that drops the oldest sample when it is
+ * full. They can be exported in the collapsed stack format consumed by flame
+ * graph tools, or as Chrome trace counters. Each sample is also written to the
+ * process wide trace sink, @see SetTraceSink.
+ */
+class SamplingProfiler {
+ public:
+  using Clock = std::chrono::steady_clock;
+  using CounterCallback = std::function<int64_t()>;
+  using CounterCookie = size_t;
+
+  struct NativeCall {
+    std::string ModuleName;
+    std::string MethodName;
+  };
+
+  struct Sample {
+    Clock::duration Timestamp{};
+    std::vector<std::pair<std::string, int64_t>> Counters;
+    std::vector<NativeCall> NativeCalls;
+  };
+
+  static constexpr std::chrono::milliseconds DefaultInterval{10};
+  static constexpr size_t DefaultCapacity = 6000;
+
+  explicit SamplingProfiler(
+      std::chrono::milliseconds interval = DefaultInterval,
+      size_t capacity = DefaultCapacity) noexcept;
+  ~SamplingProfiler() noexcept;
+
+  SamplingProfiler(const SamplingProfiler &) = delete;
+  SamplingProfiler &operator=(const SamplingProfiler &) = delete;
+
+  /**
+   * @brief Adds a counter that is read on the sampling thread.
+   * The callback must be thread safe, must not block and must not add or
+   * remove counters.
+   */
+  CounterCookie AddCounter(std::string name, CounterCallback &&callback) noexcept;
+
+  /**
+   * @brief Removes a counter. The callback is not running and is never called
+   * again once this method returns.
+   */
+  bool RemoveCounter(CounterCookie cookie) noexcept;
+
+  /**
+   * @brief Starts sampling on a background thread. Does nothing if the
+   * profiler is already running.
+   */
+  void Start() noexcept;
+
+  /**
+   * @brief Stops sampling and waits for the sampling thread to exit.
+   * Collected samples are kept.
+   */
+  void Stop() noexcept;
+
+  bool IsRunning() const noexcept;
+
+  /**
+   * @brief Takes one sample on the calling thread.
+   */
+  void SampleNow() noexcept;
+
+  std::vector<Sample> GetSamples() const noexcept;
+  void Clear() noexcept;
+
+  /**
+   * @brief Exports in-flight native calls in the collapsed stack format
+   * ("NativeModules;Module;method count" per line). Samples without native
+   * calls are reported as "Idle".
+   */
+  std::string ToCollapsedStacks() const noexcept;
+
+  /**
+   * @brief Exports counter values as Chrome trace counter events.
+   */
+  std::string ToChromeTraceJson() const noexcept;
+
+  /**
+   * @brief Returns true while at least one profiler is running, in which case
+   * NativeCallScope records calls.
+   */
+  static bool IsNativeCallTrackingEnabled() noexcept;
+
+ private:
+  void Run() noexcept;
+
+  const std::chrono::milliseconds m_interval;
+  const size_t m_capacity;
+  const Clock::time_point m_origin;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_stopCondition;
+  bool m_isStopRequested{false};
+  std::thread m_thread;
+  std::deque<Sample> m_samples;
+
+  // Held while the counters are read, so that they are not removed in the middle of a sample.
+  std::mutex m_countersMutex;
+  CounterCookie m_nextCookie{0};
+  std::map<CounterCookie, std::pair<std::string, CounterCallback>> m_counters;
+};
+
+} // namespace tracing
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,132 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "tracing/StartupTimeline.h"
+#include "tracing/TraceJson.h"
+
+#include <functional>
+#include <thread>
+
+namespace facebook {
+namespace react {
+namespace tracing {
+
+StartupTimeline::StartupTimeline() noexcept : m_origin{Clock::now()} {}
+
+void StartupTimeline::BeginPhase(const char *name) noexcept {
+  auto now = Clock::now();
+  std::scoped_lock lock{m_mutex};
+  for (const auto &phase : m_phases) {
+    if (!phase.IsComplete && phase.Name == name) {
+      return;
+    }
+  }
+
+  Phase phase;
+  phase.Name = name;
+  phase.Start = now - m_origin;
+  phase.ThreadId = CurrentThreadId();
+  m_phases.push_back(std::move(phase));
+}
+
+void StartupTimeline::EndPhase(const char *name) noexcept {
+  auto now = Clock::now();
+  std::scoped_lock lock{m_mutex};
+  for (auto it = m_phases.rbegin(); it != m_phases.rend(); ++it) {
+    if (!it->IsComplete && it->Name == name) {
+      it->Duration = (now - m_origin) - it->Start;
+      it->IsComplete = true;
+      return;
+    }
+  }
+}
+
+void StartupTimeline::Mark(const char *name) noexcept {
+  auto now = Clock::now();
+  std::scoped_lock lock{m_mutex};
+  Phase phase;
+  phase.Name = name;
+  phase.Start = now - m_origin;
+  phase.ThreadId = CurrentThreadId();
+  phase.IsComplete = true;
+  phase.IsInstant = true;
+  m_phases.push_back(std::move(phase));
+}
+
+std::vector<StartupTimeline::Phase> StartupTimeline::GetPhases() const noexcept {
+  std::scoped_lock lock{m_mutex};
+  return m_phases;
+}
+
+std::optional<StartupTimeline::Clock::duration> StartupTimeline::GetPhaseDuration(const char *name) const noexcept {
+  std::scoped_lock lock{m_mutex};
+  for (const auto &phase : m_phases) {
+    if (phase.IsComplete && phase.Name == name) {
+      return phase.Duration;
+    }
+  }
+
+  return std::nullopt;
+}
+
+StartupTimeline::Clock::duration StartupTimeline::GetTotalDuration() const noexcept {
+  std::scoped_lock lock{m_mutex};
+  Clock::duration total{};
+  for (const auto &phase : m_phases) {
+    if (phase.IsComplete && phase.Start + phase.Duration > total) {
+      total = phase.Start + phase.Duration;
+    }
+  }
+
+  return total;
+}
+
+std::string StartupTimeline::ToChromeTraceJson() const noexcept {
+  auto phases = GetPhases();
+
+  std::string json = "{\"traceEvents\":[";
+  bool isFirst = true;
+  for (const auto &phase : phases) {
+    if (!phase.IsComplete) {
+      continue;
+    }
+
+    if (!isFirst) {
+      json += ',';
+    }
+    isFirst = false;
+
+    json += "{\"name\":";
+    AppendJsonString(json, phase.Name);
+    json += ",\"cat\":\"startup\",\"ph\":";
+    json += phase.IsInstant ? "\"i\",\"s\":\"p\"" : "\"X\"";
+    json += ",\"ts\":";
+    AppendJsonMicroseconds(json, phase.Start);
+    if (!phase.IsInstant) {
+      json += ",\"dur\":";
+      AppendJsonMicroseconds(json, phase.Duration);
+    }
+    json += ",\"pid\":0,\"tid\":";
+    json += std::to_string(phase.ThreadId);
+    json += '}';
+  }
+  json += "],\"displayTimeUnit\":\"ms\"}";
+
+  return json;
+}
+
+void StartupTimeline::Reset() noexcept {
+  std::scoped_lock lock{m_mutex};
+  m_phases.clear();
+  m_origin = Clock::now();
+}
+
+/*static*/ uint64_t StartupTimeline::CurrentThreadId() noexcept {
+  return static_cast<uint64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+}
+
+} // namespace tracing
+} // namespace react
+} // namespace facebook
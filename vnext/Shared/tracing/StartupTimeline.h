@@ -0,0 +1,128 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace facebook {
+namespace react {
+namespace tracing {
+
+/**
+ * @class StartupTimeline
+ *
+ * @brief Records named startup phases of a React instance with monotonic
+ * timestamps and the id of the thread they ran on.
+ *
+ * Unlike the ETW events written by tracing.cpp, the timeline is kept in
+ * process, so it can be queried after the instance is loaded and exported as
+ * Chrome trace JSON on hosts without an ETW session.
+ */
+class StartupTimeline {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Phase {
+    std::string Name;
+    Clock::duration Start{};
+    Clock::duration Duration{};
+    uint64_t ThreadId{0};
+    // False while the phase has been started but not yet ended.
+    bool IsComplete{false};
+    // True for point-in-time markers added by Mark().
+    bool IsInstant{false};
+  };
+
+  StartupTimeline() noexcept;
+
+  /**
+   * @brief Starts a phase on the calling thread.
+   *
+   * Phases may nest and may end on a different thread than the one they
+   * started on. Starting a phase with the name of an open phase is ignored.
+   */
+  void BeginPhase(const char *name) noexcept;
+
+  /**
+   * @brief Ends the most recently started open phase with the given name.
+   */
+  void EndPhase(const char *name) noexcept;
+
+  /**
+   * @brief Records a point-in-time event, such as the first UI batch.
+   */
+  void Mark(const char *name) noexcept;
+
+  /**
+   * @brief Gets the recorded phases in the order they were started.
+   */
+  std::vector<Phase> GetPhases() const noexcept;
+
+  /**
+   * @brief Gets the duration of the first completed phase with the given name.
+   */
+  std::optional<Clock::duration> GetPhaseDuration(const char *name) const noexcept;
+
+  /**
+   * @brief Gets the time passed between the timeline creation and the end of
+   * the last completed phase or marker.
+   */
+  Clock::duration GetTotalDuration() const noexcept;
+
+  /**
+   * @brief Serializes the timeline in the Chrome trace event format, which
+   * can be loaded by chrome://tracing and Perfetto.
+   */
+  std::string ToChromeTraceJson() const noexcept;
+
+  /**
+   * @brief Removes all phases and restarts the timeline at the current time.
+   */
+  void Reset() noexcept;
+
+  /**
+   * @brief Gets a numeric id of the calling thread.
+   */
+  static uint64_t CurrentThreadId() noexcept;
+
+ private:
+  mutable std::mutex m_mutex;
+  Clock::time_point m_origin;
+  std::vector<Phase> m_phases;
+};
+
+/**
+ * @brief Starts a phase in the constructor and ends it in the destructor.
+ * The timeline may be null, in which case nothing is recorded.
+ */
+class StartupTimelineScope {
+ public:
+  StartupTimelineScope(StartupTimeline *timeline, const char *name) noexcept : m_timeline{timeline}, m_name{name} {
+    if (m_timeline) {
+      m_timeline->BeginPhase(m_name);
+    }
+  }
+
+  ~StartupTimelineScope() noexcept {
+    if (m_timeline) {
+      m_timeline->EndPhase(m_name);
+    }
+  }
+
+  StartupTimelineScope(const StartupTimelineScope &) = delete;
+  StartupTimelineScope &operator=(const StartupTimelineScope &) = delete;
+
+ private:
+  StartupTimeline *m_timeline;
+  const char *m_name;
+};
+
+} // namespace tracing
+} // namespace react
+} // namespace facebook
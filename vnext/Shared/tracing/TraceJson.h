@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+// Helpers shared by the Chrome trace event format exporters.
+namespace facebook {
+namespace react {
+namespace tracing {
+
+inline void AppendJsonString(std::string &out, std::string_view value) noexcept {
+  out += '"';
+  for (char ch : value) {
+    switch (ch) {
+      case '"':
+        out += "\\\"";
+        break;
+      case '\\':
+        out += "\\\\";
+        break;
+      case '\n':
+        out += "\\n";
+        break;
+      case '\r':
+        out += "\\r";
+        break;
+      case '\t':
+        out += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(ch) < 0x20) {
+          char buffer[8];
+          snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned int>(ch));
+          out += buffer;
+        } else {
+          out += ch;
+        }
+        break;
+    }
+  }
+  out += '"';
+}
+
+// Chrome trace timestamps are in microseconds.
+template <typename Rep, typename Period>
+inline void AppendJsonMicroseconds(std::string &out, std::chrono::duration<Rep, Period> value) noexcept {
+  char buffer[32];
+  snprintf(
+      buffer,
+      sizeof(buffer),
+      "%.3f",
+      std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(value).count());
+  out += buffer;
+}
+
+} // namespace tracing
+} // namespace react
+} // namespace facebook
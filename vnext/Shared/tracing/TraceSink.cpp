@@ -0,0 +1,349 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "tracing/TraceSink.h"
+#include "tracing/TraceJson.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <thread>
+
+namespace facebook {
+namespace react {
+namespace tracing {
+
+namespace {
+
+constexpr uint8_t TraceFormatMagic[] = {'R', 'N', 'W', 'T'};
+constexpr uint32_t TraceFormatVersion = 1;
+
+std::atomic<uint64_t> s_nextSinkId{1};
+std::atomic<ITraceSink *> s_traceSink{nullptr};
+
+uint32_t CurrentThreadId() noexcept {
+  return static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+}
+
+size_t RoundUpToPowerOfTwo(size_t value) noexcept {
+  size_t result = 1;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+template <typename T>
+void AppendLittleEndian(std::vector<uint8_t> &out, T value) noexcept {
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    out.push_back(static_cast<uint8_t>(static_cast<uint64_t>(value) >> (8 * i)));
+  }
+}
+
+template <typename T>
+bool ReadLittleEndian(const uint8_t *&data, const uint8_t *end, T &value) noexcept {
+  if (static_cast<size_t>(end - data) < sizeof(T)) {
+    return false;
+  }
+
+  uint64_t result = 0;
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    result |= static_cast<uint64_t>(data[i]) << (8 * i);
+  }
+  value = static_cast<T>(result);
+  data += sizeof(T);
+  return true;
+}
+
+} // namespace
+
+void TraceEvent::SetName(std::string_view name) noexcept {
+  size_t length = std::min(name.size(), TraceEventNameCapacity - 1);
+  memcpy(Name, name.data(), length);
+  Name[length] = '\0';
+}
+
+//=============================================================================================
+// RingBufferTraceSink implementation
+//=============================================================================================
+
+struct RingBufferTraceSink::ThreadBuffer {
+  // The sequence is the ring index of the event plus one when the slot is
+  // fully written, and zero while the owning thread is writing it.
+  struct Slot {
+    std::atomic<uint64_t> Sequence{0};
+    TraceEvent Event;
+  };
+
+  ThreadBuffer(std::thread::id owner, size_t capacity) noexcept
+      : Owner{owner}, Slots{std::make_unique<Slot[]>(capacity)} {}
+
+  const std::thread::id Owner;
+  const std::unique_ptr<Slot[]> Slots;
+  std::atomic<uint64_t> WriteIndex{0};
+  // Events below this index were dropped by Clear().
+  std::atomic<uint64_t> ClearIndex{0};
+};
+
+RingBufferTraceSink::RingBufferTraceSink(size_t capacityPerThread) noexcept
+    : m_id{s_nextSinkId++}, m_capacity{RoundUpToPowerOfTwo(std::max<size_t>(capacityPerThread, 1))} {}
+
+RingBufferTraceSink::~RingBufferTraceSink() noexcept = default;
+
+RingBufferTraceSink::ThreadBuffer *RingBufferTraceSink::GetThreadBuffer() noexcept {
+  struct ThreadBufferCache {
+    uint64_t SinkId;
+    ThreadBuffer *Buffer;
+  };
+  thread_local ThreadBufferCache t_cache{0, nullptr};
+
+  if (t_cache.SinkId == m_id) {
+    return t_cache.Buffer;
+  }
+
+  auto owner = std::this_thread::get_id();
+  ThreadBuffer *buffer = nullptr;
+  {
+    std::scoped_lock lock{m_buffersMutex};
+    for (const auto &existing : m_buffers) {
+      if (existing->Owner == owner) {
+        buffer = existing.get();
+        break;
+      }
+    }
+
+    if (!buffer) {
+      m_buffers.push_back(std::make_unique<ThreadBuffer>(owner, m_capacity));
+      buffer = m_buffers.back().get();
+    }
+  }
+
+  t_cache = {m_id, buffer};
+  return buffer;
+}
+
+void RingBufferTraceSink::Write(const TraceEvent &event) noexcept {
+  ThreadBuffer *buffer = GetThreadBuffer();
+
+  // Only the owning thread writes to the buffer, so a relaxed load is enough.
+  uint64_t index = buffer->WriteIndex.load(std::memory_order_relaxed);
+  auto &slot = buffer->Slots[index & (m_capacity - 1)];
+  slot.Sequence.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.Event = event;
+  slot.Sequence.store(index + 1, std::memory_order_release);
+  buffer->WriteIndex.store(index + 1, std::memory_order_release);
+}
+
+std::vector<TraceEvent> RingBufferTraceSink::Snapshot() const noexcept {
+  std::vector<TraceEvent> events;
+
+  std::scoped_lock lock{m_buffersMutex};
+  for (const auto &buffer : m_buffers) {
+    uint64_t end = buffer->WriteIndex.load(std::memory_order_acquire);
+    uint64_t begin = std::max(end > m_capacity ? end - m_capacity : 0, buffer->ClearIndex.load());
+
+    for (uint64_t index = begin; index < end; ++index) {
+      const auto &slot = buffer->Slots[index & (m_capacity - 1)];
+      if (slot.Sequence.load(std::memory_order_acquire) != index + 1) {
+        continue; // Overwritten by a newer event.
+      }
+
+      TraceEvent event = slot.Event;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.Sequence.load(std::memory_order_relaxed) != index + 1) {
+        continue; // Overwritten while we were copying it.
+      }
+
+      events.push_back(event);
+    }
+  }
+
+  std::stable_sort(events.begin(), events.end(), [](const TraceEvent &left, const TraceEvent &right) {
+    return left.Timestamp < right.Timestamp;
+  });
+
+  return events;
+}
+
+void RingBufferTraceSink::Clear() noexcept {
+  std::scoped_lock lock{m_buffersMutex};
+  for (const auto &buffer : m_buffers) {
+    buffer->ClearIndex.store(buffer->WriteIndex.load(std::memory_order_acquire));
+  }
+}
+
+//=============================================================================================
+// Process wide sink
+//=============================================================================================
+
+uint64_t TraceTimestamp() noexcept {
+  static const auto s_origin = std::chrono::steady_clock::now();
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_origin).count());
+}
+
+void SetTraceSink(std::shared_ptr<ITraceSink> sink) noexcept {
+  // Intentionally leaked: writers may still use a replaced sink during process shutdown.
+  static auto *s_sinks = new std::vector<std::shared_ptr<ITraceSink>>();
+  static std::mutex s_sinksMutex;
+
+  std::scoped_lock lock{s_sinksMutex};
+  s_traceSink.store(sink.get(), std::memory_order_release);
+  if (sink) {
+    s_sinks->push_back(std::move(sink));
+  }
+}
+
+ITraceSink *GetTraceSink() noexcept {
+  return s_traceSink.load(std::memory_order_acquire);
+}
+
+void WriteTraceEvent(TraceEventType type, std::string_view name, uint64_t tag, int64_t value) noexcept {
+  ITraceSink *sink = GetTraceSink();
+  if (!sink) {
+    return;
+  }
+
+  TraceEvent event;
+  event.Timestamp = TraceTimestamp();
+  event.Tag = tag;
+  event.Value = value;
+  event.ThreadId = CurrentThreadId();
+  event.Type = type;
+  event.SetName(name);
+  sink->Write(event);
+}
+
+//=============================================================================================
+// Export
+//=============================================================================================
+
+std::vector<uint8_t> SerializeTraceEvents(const std::vector<TraceEvent> &events) noexcept {
+  std::vector<uint8_t> result;
+  result.reserve(16 + events.size() * 40);
+  result.insert(result.end(), std::begin(TraceFormatMagic), std::end(TraceFormatMagic));
+  AppendLittleEndian(result, TraceFormatVersion);
+  AppendLittleEndian(result, static_cast<uint64_t>(events.size()));
+
+  for (const auto &event : events) {
+    auto nameLength = static_cast<uint8_t>(strnlen(event.Name, TraceEventNameCapacity - 1));
+    AppendLittleEndian(result, event.Timestamp);
+    AppendLittleEndian(result, event.Tag);
+    AppendLittleEndian(result, event.Value);
+    AppendLittleEndian(result, event.ThreadId);
+    AppendLittleEndian(result, static_cast<uint8_t>(event.Type));
+    AppendLittleEndian(result, nameLength);
+    result.insert(result.end(), event.Name, event.Name + nameLength);
+  }
+
+  return result;
+}
+
+bool DeserializeTraceEvents(const uint8_t *data, size_t size, std::vector<TraceEvent> &events) noexcept {
+  const uint8_t *end = data + size;
+  if (size < sizeof(TraceFormatMagic) || memcmp(data, TraceFormatMagic, sizeof(TraceFormatMagic)) != 0) {
+    return false;
+  }
+  data += sizeof(TraceFormatMagic);
+
+  uint32_t version = 0;
+  uint64_t count = 0;
+  if (!ReadLittleEndian(data, end, version) || version != TraceFormatVersion || !ReadLittleEndian(data, end, count)) {
+    return false;
+  }
+
+  events.clear();
+  for (uint64_t i = 0; i < count; ++i) {
+    TraceEvent event;
+    uint8_t type = 0;
+    uint8_t nameLength = 0;
+    if (!ReadLittleEndian(data, end, event.Timestamp) || !ReadLittleEndian(data, end, event.Tag) ||
+        !ReadLittleEndian(data, end, event.Value) || !ReadLittleEndian(data, end, event.ThreadId) ||
+        !ReadLittleEndian(data, end, type) || !ReadLittleEndian(data, end, nameLength) ||
+        type > static_cast<uint8_t>(TraceEventType::Instant) || static_cast<size_t>(end - data) < nameLength) {
+      return false;
+    }
+
+    event.Type = static_cast<TraceEventType>(type);
+    event.SetName(std::string_view{reinterpret_cast<const char *>(data), nameLength});
+    data += nameLength;
+    events.push_back(event);
+  }
+
+  return true;
+}
+
+std::string TraceEventsToChromeJson(const std::vector<TraceEvent> &events) noexcept {
+  std::string json = "{\"traceEvents\":[";
+  bool isFirst = true;
+  for (const auto &event : events) {
+    if (!isFirst) {
+      json += ',';
+    }
+    isFirst = false;
+
+    json += "{\"name\":";
+    AppendJsonString(json, event.Name);
+    json += ",\"cat\":\"react\",\"ph\":";
+    switch (event.Type) {
+      case TraceEventType::SectionBegin:
+        json += "\"B\"";
+        break;
+      case TraceEventType::SectionEnd:
+        json += "\"E\"";
+        break;
+      case TraceEventType::AsyncSectionBegin:
+        json += "\"b\"";
+        break;
+      case TraceEventType::AsyncSectionEnd:
+        json += "\"e\"";
+        break;
+      case TraceEventType::AsyncFlowBegin:
+        json += "\"s\"";
+        break;
+      case TraceEventType::AsyncFlowEnd:
+        json += "\"f\",\"bp\":\"e\"";
+        break;
+      case TraceEventType::Counter:
+        json += "\"C\"";
+        break;
+      case TraceEventType::Instant:
+        json += "\"i\",\"s\":\"t\"";
+        break;
+    }
+
+    json += ",\"ts\":";
+    AppendJsonMicroseconds(json, std::chrono::nanoseconds{event.Timestamp});
+    json += ",\"pid\":0,\"tid\":";
+    json += std::to_string(event.ThreadId);
+
+    switch (event.Type) {
+      case TraceEventType::AsyncSectionBegin:
+      case TraceEventType::AsyncSectionEnd:
+      case TraceEventType::AsyncFlowBegin:
+      case TraceEventType::AsyncFlowEnd:
+        json += ",\"id\":";
+        json += std::to_string(event.Value);
+        break;
+      case TraceEventType::Counter:
+        json += ",\"args\":{\"value\":";
+        json += std::to_string(event.Value);
+        json += '}';
+        break;
+      default:
+        break;
+    }
+    json += '}';
+  }
+  json += "],\"displayTimeUnit\":\"ms\"}";
+
+  return json;
+}
+
+} // namespace tracing
+} // namespace react
+} // namespace facebook
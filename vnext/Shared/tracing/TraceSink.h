@@ -0,0 +1,146 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace facebook {
+namespace react {
+namespace tracing {
+
+enum class TraceEventType : uint8_t {
+  SectionBegin = 0,
+  SectionEnd = 1,
+  AsyncSectionBegin = 2,
+  AsyncSectionEnd = 3,
+  AsyncFlowBegin = 4,
+  AsyncFlowEnd = 5,
+  Counter = 6,
+  Instant = 7,
+};
+
+// Longer names are truncated so that every event has the same size.
+constexpr size_t TraceEventNameCapacity = 48;
+
+/**
+ * @brief Fixed size trace record. It does not own any heap memory, so that
+ * writing it into a ring buffer never allocates.
+ */
+struct TraceEvent {
+  // Nanoseconds since the trace origin, @see TraceTimestamp.
+  uint64_t Timestamp{0};
+  uint64_t Tag{0};
+  // Cookie of async sections and flows, or the value of a counter.
+  int64_t Value{0};
+  uint32_t ThreadId{0};
+  TraceEventType Type{TraceEventType::Instant};
+  char Name[TraceEventNameCapacity]{};
+
+  void SetName(std::string_view name) noexcept;
+};
+
+/**
+ * @brief Receives trace events from the fbsystrace sections and the JS trace
+ * hooks. Implementations must be thread safe; Write is called on the hot path.
+ */
+struct ITraceSink {
+  virtual ~ITraceSink() = default;
+  virtual void Write(const TraceEvent &event) noexcept = 0;
+};
+
+/**
+ * @class RingBufferTraceSink
+ *
+ * @brief Keeps the most recent trace events in memory, so tracing can stay on
+ * in production and be flushed only when it is needed, e.g. for a jank report.
+ *
+ * Each writer thread gets its own single-producer ring buffer on first use.
+ * Writes never lock or allocate: when a buffer is full the oldest events are
+ * overwritten. Snapshot() may run concurrently with writers and drops events
+ * that were overwritten while it was copying them.
+ */
+class RingBufferTraceSink final : public ITraceSink {
+ public:
+  static constexpr size_t DefaultCapacityPerThread = 4096;
+
+  // The capacity is rounded up to a power of two.
+  explicit RingBufferTraceSink(size_t capacityPerThread = DefaultCapacityPerThread) noexcept;
+  ~RingBufferTraceSink() noexcept override;
+
+  void Write(const TraceEvent &event) noexcept override;
+
+  /**
+   * @brief Copies the buffered events of all threads ordered by timestamp.
+   */
+  std::vector<TraceEvent> Snapshot() const noexcept;
+
+  /**
+   * @brief Drops all buffered events.
+   */
+  void Clear() noexcept;
+
+ private:
+  struct ThreadBuffer;
+  ThreadBuffer *GetThreadBuffer() noexcept;
+
+  const uint64_t m_id;
+  const size_t m_capacity;
+  mutable std::mutex m_buffersMutex;
+  std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+};
+
+/**
+ * @brief Gets the number of nanoseconds passed since the process wide trace
+ * origin, which is set the first time this function is called.
+ */
+uint64_t TraceTimestamp() noexcept;
+
+/**
+ * @brief Sets the process wide sink that receives trace events in addition to
+ * ETW. Pass nullptr to stop collecting events.
+ *
+ * @remarks Replaced sinks are kept alive until the process exits, because
+ * writers do not take a reference on the sink.
+ */
+void SetTraceSink(std::shared_ptr<ITraceSink> sink) noexcept;
+
+/**
+ * @brief Gets the current trace sink, or nullptr if none is set.
+ */
+ITraceSink *GetTraceSink() noexcept;
+
+/**
+ * @brief Writes an event stamped with the current time and thread to the
+ * current sink if there is one.
+ */
+void WriteTraceEvent(TraceEventType type, std::string_view name, uint64_t tag = 0, int64_t value = 0) noexcept;
+
+/**
+ * @brief Serializes events into a compact little-endian binary format:
+ * a "RNWT" magic, a format version and event count, followed by the events.
+ */
+std::vector<uint8_t> SerializeTraceEvents(const std::vector<TraceEvent> &events) noexcept;
+
+/**
+ * @brief Reads events written by SerializeTraceEvents.
+ *
+ * @returns False if the buffer is not in the expected format.
+ */
+bool DeserializeTraceEvents(const uint8_t *data, size_t size, std::vector<TraceEvent> &events) noexcept;
+
+/**
+ * @brief Exports events in the Chrome trace event format, which can be loaded
+ * by chrome://tracing and Perfetto.
+ */
+std::string TraceEventsToChromeJson(const std::vector<TraceEvent> &events) noexcept;
+
+} // namespace tracing
+} // namespace react
+} // namespace facebook
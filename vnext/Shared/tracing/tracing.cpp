@@ -6,6 +6,7 @@
 #include <TraceLoggingProvider.h>
 #include <jsi/jsi.h>
 #include <winmeta.h>
+#include "tracing/TraceSink.h"
 #include "tracing/fbsystrace.h"
 
 #include <array>
@@ -34,6 +35,9 @@ std::mutex g_pages_mutex;
     s_tracker_[cookie] = std::chrono::high_resolution_clock::now();
   }
 
+  facebook::react::tracing::WriteTraceEvent(
+      facebook::react::tracing::TraceEventType::AsyncFlowBegin, name, tag, cookie);
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceNativeAsyncFlow",
@@ -59,6 +63,9 @@ std::mutex g_pages_mutex;
     }
   }
 
+  facebook::react::tracing::WriteTraceEvent(
+      facebook::react::tracing::TraceEventType::AsyncFlowEnd, name, tag, cookie);
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceNativeAsyncFlow",
@@ -84,6 +91,8 @@ void trace_begin_section(
     const std::string &profile_name,
     std::array<std::string, SYSTRACE_SECTION_MAX_ARGS> &&args,
     uint8_t size) {
+  WriteTraceEvent(TraceEventType::SectionBegin, profile_name, tag);
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceNativeSection",
@@ -101,6 +110,8 @@ void trace_begin_section(
 }
 
 void trace_end_section(uint64_t id, uint64_t tag, const std::string &profile_name, double duration) {
+  WriteTraceEvent(TraceEventType::SectionEnd, profile_name, tag);
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceNativeSection",
@@ -111,6 +122,8 @@ void trace_end_section(uint64_t id, uint64_t tag, const std::string &profile_nam
 }
 
 void syncSectionBeginJSHook(uint64_t tag, const std::string &profile_name, const std::string &args) {
+  WriteTraceEvent(TraceEventType::SectionBegin, profile_name, tag);
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceJSSection",
@@ -121,11 +134,15 @@ void syncSectionBeginJSHook(uint64_t tag, const std::string &profile_name, const
 }
 
 void syncSectionEndJSHook(uint64_t tag) {
+  WriteTraceEvent(TraceEventType::SectionEnd, {}, tag);
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider, "SystraceJSSection", TraceLoggingString("end", "op"), TraceLoggingUInt64(tag, "tag"));
 }
 
 void asyncSectionBeginJSHook(uint64_t tag, const std::string &profile_name, int cookie) {
+  WriteTraceEvent(TraceEventType::AsyncSectionBegin, profile_name, tag, cookie);
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceJSAsyncSection",
@@ -136,6 +153,8 @@ void asyncSectionBeginJSHook(uint64_t tag, const std::string &profile_name, int
 }
 
 void asyncSectionEndJSHook(uint64_t tag, const std::string &profile_name, int cookie) {
+  WriteTraceEvent(TraceEventType::AsyncSectionEnd, profile_name, tag, cookie);
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceJSAsyncSection",
@@ -146,6 +165,8 @@ void asyncSectionEndJSHook(uint64_t tag, const std::string &profile_name, int co
 }
 
 void asyncFlowBeginJSHook(uint64_t tag, const std::string &profile_name, int cookie) {
+  WriteTraceEvent(TraceEventType::AsyncFlowBegin, profile_name, tag, cookie);
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceJSAsyncFlow",
@@ -156,6 +177,8 @@ void asyncFlowBeginJSHook(uint64_t tag, const std::string &profile_name, int coo
 }
 
 void asyncFlowEndJSHook(uint64_t tag, const std::string &profile_name, int cookie) {
+  WriteTraceEvent(TraceEventType::AsyncFlowEnd, profile_name, tag, cookie);
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceJSAsyncFlow",
@@ -166,6 +189,8 @@ void asyncFlowEndJSHook(uint64_t tag, const std::string &profile_name, int cooki
 }
 
 void counterJSHook(uint64_t tag, const std::string &profile_name, int value) {
+  WriteTraceEvent(TraceEventType::Counter, profile_name, tag, value);
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceCounter",